@@ -32,6 +32,7 @@
 // Includes
 
 #include "rtl_log.h"
+#include "profiler.h"
 #include "sl_bt_api.h"
 #include "sli_bgapi_trace.h"
 #include "sl_status.h"
@@ -78,6 +79,10 @@ static void cs_on_error(uint8_t conn_handle,
 
 static sl_status_t handle_initiator_action(const cs_acp_initiator_action_cmd_data_t *initiator_action_data);
 static void cs_get_target_config_response(cs_acp_get_target_config_rsp_t *rsp_data);
+#if PROFILER_ENABLE
+static sl_status_t cs_get_profile_response(const cs_acp_get_profile_cmd_data_t *cmd_data,
+                                           cs_acp_get_profile_rsp_t *rsp_data);
+#endif // PROFILER_ENABLE
 
 // -----------------------------------------------------------------------------
 // Public function definitions
@@ -88,6 +93,9 @@ static void cs_get_target_config_response(cs_acp_get_target_config_rsp_t *rsp_da
 void app_init(void)
 {
   app_log_iostream_set(iostream_bgapi_trace_handle);
+#if PROFILER_ENABLE
+  profiler_init();
+#endif // PROFILER_ENABLE
   /////////////////////////////////////////////////////////////////////////////
   // Put your additional application init code here!                         //
   // This is called once during start-up.                                    //
@@ -99,7 +107,10 @@ void app_init(void)
  *****************************************************************************/
 void app_process_action(void)
 {
+  PROFILER_BEGIN(PROFILER_PROBE_APP_PROCESS_ACTION);
   extended_result_step();
+  rtl_log_step();
+  PROFILER_END(PROFILER_PROBE_APP_PROCESS_ACTION);
   /////////////////////////////////////////////////////////////////////////////
   // Put your additional application code here!                              //
   // This is called infinitely.                                              //
@@ -114,10 +125,12 @@ void app_process_action(void)
  * - activate/deactivate CS initiator device instance on the NCP-target
  * - activate/deactivate CS reflector device instance on the NCP-target
  * - configure antenna on the NCP-target
+ * - read the execution time statistics of the NCP-target
  * and send response back accordingly.
  *****************************************************************************/
 void sl_ncp_user_cs_cmd_message_to_target_cb(const void *data)
 {
+  PROFILER_BEGIN(PROFILER_PROBE_ACP_COMMAND);
   cs_acp_cmd_t *cs_cmd;
   sl_status_t sc = SL_STATUS_NOT_SUPPORTED;
 
@@ -125,7 +138,8 @@ void sl_ncp_user_cs_cmd_message_to_target_cb(const void *data)
   cs_cmd = (cs_acp_cmd_t *)(data_arr->data);
 
   uint8_t rsp_len = 0;
-  uint8_t rsp_data[sizeof(cs_acp_get_target_config_rsp_t)];
+  uint8_t rsp_data[SL_MAX(sizeof(cs_acp_get_target_config_rsp_t),
+                          sizeof(cs_acp_get_profile_rsp_t))];
 
   switch (cs_cmd->cmd_id) {
 #ifdef SL_CATALOG_CS_INITIATOR_CLIENT_PRESENT
@@ -180,11 +194,21 @@ void sl_ncp_user_cs_cmd_message_to_target_cb(const void *data)
       rsp_len = sizeof(cs_acp_get_target_config_rsp_t);
       sc = SL_STATUS_OK;
       break;
+#if PROFILER_ENABLE
+    case CS_ACP_CMD_GET_PROFILE:
+      sc = cs_get_profile_response(&cs_cmd->data.get_profile_data,
+                                   (cs_acp_get_profile_rsp_t *)rsp_data);
+      if (sc == SL_STATUS_OK) {
+        rsp_len = sizeof(cs_acp_get_profile_rsp_t);
+      }
+      break;
+#endif // PROFILER_ENABLE
     default:
       // Unknown command, leave the default value of sc unchanged.
       break;
   }
   sl_bt_send_rsp_user_cs_service_message_to_target((uint16_t)sc, rsp_len, rsp_data);
+  PROFILER_END(PROFILER_PROBE_ACP_COMMAND);
 }
 
 // -----------------------------------------------------------------------------
@@ -205,6 +229,7 @@ static void cs_on_result(const uint8_t conn_handle,
   (void)ranging_data;
   (void)ranging_counter;
 
+  PROFILER_BEGIN(PROFILER_PROBE_CS_ON_RESULT);
   cs_acp_event_t cs_user_event;
 
   cs_user_event.acp_evt_id = CS_ACP_EVT_RESULT_ID;
@@ -216,6 +241,7 @@ static void cs_on_result(const uint8_t conn_handle,
 
   sl_bt_send_evt_user_cs_service_message_to_host(RESULT_MSG_LEN(result_data->size),
                                                  (uint8_t *)&cs_user_event);
+  PROFILER_END(PROFILER_PROBE_CS_ON_RESULT);
 }
 
 /******************************************************************************
@@ -270,6 +296,35 @@ static void cs_get_target_config_response(cs_acp_get_target_config_rsp_t *rsp_da
   rsp_data->max_bluetooth_connections = SL_BT_CONFIG_MAX_CONNECTIONS;
 }
 
+#if PROFILER_ENABLE
+/******************************************************************************
+ * Compile 'get profile' response message payload
+ *****************************************************************************/
+static sl_status_t cs_get_profile_response(const cs_acp_get_profile_cmd_data_t *cmd_data,
+                                           cs_acp_get_profile_rsp_t *rsp_data)
+{
+  profiler_stats_t stats;
+
+  if (cmd_data->probe >= PROFILER_PROBE_COUNT) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  profiler_get_stats((profiler_probe_t)cmd_data->probe, &stats);
+  if (cmd_data->reset != 0) {
+    profiler_reset((profiler_probe_t)cmd_data->probe);
+  }
+  rsp_data->tick_hz = profiler_get_tick_hz();
+  rsp_data->count = stats.count;
+  rsp_data->min_ticks = stats.min_ticks;
+  rsp_data->max_ticks = stats.max_ticks;
+  rsp_data->mean_ticks = (stats.count > 0) ? (uint32_t)(stats.total_ticks / stats.count) : 0;
+  memset(rsp_data->histogram, 0, sizeof(rsp_data->histogram));
+  for (uint32_t i = 0; i < SL_MIN(PROFILER_HISTOGRAM_BINS, CS_ACP_PROFILE_HISTOGRAM_BINS); i++) {
+    rsp_data->histogram[i] = stats.histogram[i];
+  }
+  return SL_STATUS_OK;
+}
+#endif // PROFILER_ENABLE
+
 /******************************************************************************
  * Function to realize CS initiator actions according to the incoming user
  * command data from host.
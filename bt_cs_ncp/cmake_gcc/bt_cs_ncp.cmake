@@ -221,6 +221,7 @@ add_library(slc OBJECT
     "../extended_result.c"
     "../main.c"
     "../ncp_user_cmd.c"
+    "../profiler.c"
     "../rtl_log.c"
 )
 
@@ -61,6 +61,8 @@
 #define CS_ACP_FRAGMENTS_LEFT_MASK 0x7F
 /// Bitmask for the RAS mode bit in the target config
 #define CS_ACP_TARGET_CONFIG_RAS_MODE_BIT_POS 0x00
+/// Number of log2 histogram bins in the profile response
+#define CS_ACP_PROFILE_HISTOGRAM_BINS 24
 
 // -----------------------------------------------------------------------------
 // Enums, structs, typedefs
@@ -75,7 +77,8 @@ SL_ENUM(cs_acp_cmd_id_t) {
   CS_ACP_CMD_REFLECTOR_ACTION = 3,  ///< Reflector action (eg. delete instance)
   CS_ACP_CMD_ANTENNA_CONFIGURE = 4, ///< Configure antenna
   CS_ACP_CMD_ENABLE_TRACE = 5,      ///< Enable BGAPI trace feature
-  CS_ACP_CMD_GET_TARGET_CONFIG = 6  ///< Get ACP target configuration
+  CS_ACP_CMD_GET_TARGET_CONFIG = 6, ///< Get ACP target configuration
+  CS_ACP_CMD_GET_PROFILE = 7        ///< Get execution time statistics of a probe
 };
 
 /// @name ACP initiator actions
@@ -154,6 +157,33 @@ typedef struct {
 } SL_ATTRIBUTE_PACKED cs_acp_get_target_config_rsp_t;
 SL_PACK_END()
 
+SL_PACK_START(1)
+/// @name Get profile command data
+/// @struct cs_acp_get_profile_cmd_data_t
+/// @brief Data structure that selects the probe to read.
+typedef struct {
+  uint8_t probe; ///< Probe index, see profiler_probe_t
+  uint8_t reset; ///< Clear the statistics of the probe after reading
+} SL_ATTRIBUTE_PACKED cs_acp_get_profile_cmd_data_t;
+SL_PACK_END()
+
+SL_PACK_START(1)
+/// @name ACP profile response data
+/// @struct cs_acp_get_profile_rsp_t
+/// @brief Data structure that contains the execution time statistics of a
+///        probe. Times are in ticks of tick_hz, bin n of the histogram counts
+///        durations of 2^n to 2^(n+1) - 1 ticks, the last bin also counts
+///        everything longer.
+typedef struct {
+  uint32_t tick_hz;                                   ///< Tick frequency in Hz
+  uint32_t count;                                     ///< Number of recorded runs
+  uint32_t min_ticks;                                 ///< Shortest run
+  uint32_t max_ticks;                                 ///< Longest run
+  uint32_t mean_ticks;                                ///< Mean run time
+  uint32_t histogram[CS_ACP_PROFILE_HISTOGRAM_BINS];  ///< Log2 histogram of run times
+} SL_ATTRIBUTE_PACKED cs_acp_get_profile_rsp_t;
+SL_PACK_END()
+
 SL_PACK_START(1)
 /// @name ACP command data
 /// @struct cs_acp_cmd_t
@@ -172,6 +202,7 @@ typedef struct {
 #endif // SL_CATALOG_CS_REFLECTOR_CONFIG_PRESENT
     uint8_t antenna_config_wired;                             ///< Antenna configuration for wired offset
     uint8_t enable_trace;                                     ///< Enable BGAPI trace feature
+    cs_acp_get_profile_cmd_data_t get_profile_data;           ///< Get profile command data
   } data;
 } SL_ATTRIBUTE_PACKED cs_acp_cmd_t;
 SL_PACK_END()
@@ -36,12 +36,14 @@
 #include "sl_status.h"
 #include "sl_common.h"
 #include "sl_power_manager.h"
+#include "sl_sleeptimer.h"
 #include "sl_bt_api.h"
 #include "app_log.h"
 #include "cs_acp.h"
 #include "cs_result.h"
 #include "cs_initiator_config.h"
 #include "extended_result.h"
+#include "profiler.h"
 
 // -----------------------------------------------------------------------------
 // Macros
@@ -58,17 +60,35 @@
 #define EVT_OVERHEAD             (sizeof(cs_acp_event_id_t) + 3)
 #define EVT_MAX_DATA             (UINT8_MAX - EVT_OVERHEAD)
 
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Serialized procedure waiting for fragmentation.
+// The serialized data starts after EVT_OVERHEAD bytes of headroom. Fragments
+// are sent in place: the event header of each fragment is written into the
+// bytes right before it, which is either the headroom or the tail of the
+// fragment that has already been sent.
+typedef struct {
+  uint8_t connection;
+  size_t len;
+  uint32_t queued_tick;
+  uint8_t buffer[EVT_OVERHEAD + EVT_DATA_BUFFER_MAX_SIZE];
+} evt_data_slot_t;
+
 // -----------------------------------------------------------------------------
 // Static variables
 
-static uint8_t evt_data_buffer[EVT_DATA_BUFFER_MAX_SIZE];
-static size_t evt_data_buffer_len = 0;
-static uint8_t *evt_data_ptr;
-static uint8_t connection;
+static evt_data_slot_t evt_data_queue[EXTENDED_RESULT_QUEUE_SIZE];
+static uint8_t queue_head = 0;  // Slot being fragmented
+static uint8_t queue_count = 0;
+static size_t evt_data_offset = 0;
+static uint8_t held_passes = 0;  // Passes in a row that held the fragments back
+static extended_result_stats_t stats;
 
 // -----------------------------------------------------------------------------
 // Static function declarations
 
+static void send_fragment(void);
 static sl_status_t serialize_extended_result(const uint16_t ranging_counter,
                                              const uint8_t*result,
                                              uint8_t result_size,
@@ -81,7 +101,7 @@ static sl_status_t serialize_extended_result(const uint16_t ranging_counter,
 // Public function definitions
 
 /******************************************************************************
- * Add extended result data to the ACP event buffer.
+ * Add extended result data to the ACP event queue.
  *****************************************************************************/
 void cs_on_extended_result(const uint8_t conn_handle,
                            const uint16_t ranging_counter,
@@ -91,32 +111,46 @@ void cs_on_extended_result(const uint8_t conn_handle,
                            const void *user_data)
 {
   sl_status_t sc;
-  size_t data_len;
+  evt_data_slot_t *slot;
 
   (void)user_data;
 
-  if (evt_data_buffer_len > 0) {
-    app_log_error("Event data buffer busy" APP_LOG_NL);
+  PROFILER_BEGIN(PROFILER_PROBE_CS_ON_EXTENDED_RESULT);
+  if (queue_count >= EXTENDED_RESULT_QUEUE_SIZE) {
+    stats.dropped_queue_full++;
+    app_log_error("Event data queue full, procedure of connection %u dropped" APP_LOG_NL,
+                  conn_handle);
+    PROFILER_END(PROFILER_PROBE_CS_ON_EXTENDED_RESULT);
     return;
   }
 
+  slot = &evt_data_queue[(queue_head + queue_count) % EXTENDED_RESULT_QUEUE_SIZE];
   sc = serialize_extended_result(ranging_counter,
                                  result,
                                  result_metadata->size,
                                  ranging_data,
-                                 sizeof(evt_data_buffer),
-                                 &data_len,
-                                 evt_data_buffer);
+                                 sizeof(slot->buffer) - EVT_OVERHEAD,
+                                 &slot->len,
+                                 &slot->buffer[EVT_OVERHEAD]);
   if (sc != SL_STATUS_OK) {
+    stats.dropped_serialization++;
     app_log_status_error_f(sc, "Event data serialization failed" APP_LOG_NL);
+    PROFILER_END(PROFILER_PROBE_CS_ON_EXTENDED_RESULT);
     return;
   }
 
-  connection = conn_handle;
-  evt_data_buffer_len = data_len;
-  evt_data_ptr = evt_data_buffer;
-  // Keep the MCU awake until all fragments are sent.
-  sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+  slot->connection = conn_handle;
+  slot->queued_tick = sl_sleeptimer_get_tick_count();
+  if (queue_count == 0) {
+    // Keep the MCU awake until all fragments of all queued procedures are sent.
+    sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+  }
+  queue_count++;
+  stats.queued++;
+  if (queue_count > stats.high_watermark) {
+    stats.high_watermark = queue_count;
+  }
+  PROFILER_END(PROFILER_PROBE_CS_ON_EXTENDED_RESULT);
 }
 
 /******************************************************************************
@@ -124,36 +158,99 @@ void cs_on_extended_result(const uint8_t conn_handle,
  *****************************************************************************/
 void extended_result_step(void)
 {
-  if (evt_data_buffer_len == 0) {
-    return;
+  size_t bytes_sent = 0;
+  uint8_t max_fragments = EXTENDED_RESULT_STEP_MAX_FRAGMENTS;
+
+  PROFILER_BEGIN(PROFILER_PROBE_EXTENDED_RESULT_STEP);
+  // Events left in the stack since the previous pass mean that the NCP
+  // transport has not caught up. Hold the fragments back then, so they do not
+  // pile up in the Bluetooth buffer memory. The UART is the bottleneck in
+  // that case, so this does not delay the procedure on the host side. One
+  // fragment still goes out after EXTENDED_RESULT_STEP_MAX_HELD_PASSES held
+  // passes in a row, so the queue drains even if the stack always has events
+  // pending.
+  if (queue_count > 0 && sl_bt_event_pending()) {
+    if (held_passes < EXTENDED_RESULT_STEP_MAX_HELD_PASSES) {
+      held_passes++;
+      max_fragments = 0;
+      stats.throttled_passes++;
+    } else {
+      held_passes = 0;
+      max_fragments = 1;
+    }
+  } else {
+    held_passes = 0;
   }
+  // Send fragments back to back until the budget of this pass is spent.
+  for (uint8_t i = 0; i < max_fragments && queue_count > 0; i++) {
+    size_t fragment_size = SL_MIN(evt_data_queue[queue_head].len - evt_data_offset,
+                                  (size_t)EVT_MAX_DATA) + EVT_OVERHEAD;
+    if (i > 0 && bytes_sent + fragment_size > EXTENDED_RESULT_STEP_MAX_BYTES) {
+      break;
+    }
+    bytes_sent += fragment_size;
+    send_fragment();
+  }
+  PROFILER_END(PROFILER_PROBE_EXTENDED_RESULT_STEP);
+}
+
+/******************************************************************************
+ * Get extended result queue statistics.
+ *****************************************************************************/
+void extended_result_get_stats(extended_result_stats_t *stats_out)
+{
+  *stats_out = stats;
+  stats_out->depth = queue_count;
+}
 
-  // Avoid big buffer allocation on the stack by using static variable.
-  static uint8_t evt_data[UINT8_MAX];
-  uint8_t evt_data_len = (uint8_t)SL_MIN(evt_data_buffer_len, (size_t)EVT_MAX_DATA);
-  cs_acp_event_t *evt = (cs_acp_event_t *)evt_data;
-  evt->connection_id = connection;
+// -----------------------------------------------------------------------------
+// Internal function definitions
+
+/******************************************************************************
+ * Send the next fragment of the procedure at the head of the queue.
+ *****************************************************************************/
+static void send_fragment(void)
+{
+  evt_data_slot_t *slot = &evt_data_queue[queue_head];
+  size_t evt_data_left = slot->len - evt_data_offset;
+  uint8_t evt_data_len = (uint8_t)SL_MIN(evt_data_left, (size_t)EVT_MAX_DATA);
+  // The header ends right where the fragment content starts. It overwrites
+  // the tail of the previous fragment, which is safe only because
+  // sl_bt_send_evt_user_cs_service_message_to_host() copies the message into
+  // the BGAPI event buffer before it returns. A transport that sends from the
+  // caller's buffer later would need a separate event buffer again.
+  cs_acp_event_t *evt = (cs_acp_event_t *)&slot->buffer[evt_data_offset];
+  evt->connection_id = slot->connection;
   evt->acp_evt_id = CS_ACP_EVT_EXTENDED_RESULT_ID;
-  memcpy(evt->data.ext_result.fragment.data, evt_data_ptr, evt_data_len);
   evt->data.ext_result.fragment.len = evt_data_len;
-  evt_data_buffer_len -= evt_data_len;
+  evt_data_left -= evt_data_len;
   // Calculate remaining number of fragments using ceiling division.
-  evt->data.ext_result.fragments_left = (uint8_t)((evt_data_buffer_len + EVT_MAX_DATA - 1) / EVT_MAX_DATA);
-  if (evt_data_ptr == evt_data_buffer) {
+  evt->data.ext_result.fragments_left = (uint8_t)((evt_data_left + EVT_MAX_DATA - 1) / EVT_MAX_DATA);
+  if (evt_data_offset == 0) {
     // First fragment
     evt->data.ext_result.fragments_left |= CS_ACP_FIRST_FRAGMENT_MASK;
   }
-  evt_data_ptr += evt_data_len;
-  sl_bt_send_evt_user_cs_service_message_to_host(evt_data_len + EVT_OVERHEAD, evt_data);
+  evt_data_offset += evt_data_len;
+  sl_bt_send_evt_user_cs_service_message_to_host(evt_data_len + EVT_OVERHEAD, (uint8_t *)evt);
 
-  if (evt_data_buffer_len == 0) {
+  if (evt_data_left > 0) {
+    return;
+  }
+
+  // Procedure sent, continue with the next one.
+  uint32_t drain_time_ms = sl_sleeptimer_tick_to_ms(sl_sleeptimer_get_tick_count() - slot->queued_tick);
+  stats.last_drain_time_ms = drain_time_ms;
+  if (drain_time_ms > stats.max_drain_time_ms) {
+    stats.max_drain_time_ms = drain_time_ms;
+  }
+  evt_data_offset = 0;
+  queue_head = (queue_head + 1) % EXTENDED_RESULT_QUEUE_SIZE;
+  queue_count--;
+  if (queue_count == 0) {
     sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
   }
 }
 
-// -----------------------------------------------------------------------------
-// Internal function definitions
-
 /******************************************************************************
  * Serialize extended result data.
  *****************************************************************************/
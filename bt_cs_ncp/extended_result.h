@@ -33,9 +33,54 @@
 
 #include "sl_rtl_clib_api.h"
 #include "cs_initiator.h"
+#include "cs_initiator_config.h"
+
+// Number of serialized procedures that can wait for fragmentation. Each slot
+// holds a full procedure including both RAS ranging data buffers, about
+// 2 * CS_INITIATOR_MAX_RANGING_DATA_SIZE + CS_MAX_STEP_COUNT
+// + CS_RESULT_MAX_BUFFER_SIZE bytes: 4.1 kB with the default configuration.
+// Two slots let one procedure be queued while another one is sent. Raise it
+// up to CS_INITIATOR_MAX_CONNECTIONS if several connections finish their
+// procedures at the same time and the RAM is available.
+#ifndef EXTENDED_RESULT_QUEUE_SIZE
+#define EXTENDED_RESULT_QUEUE_SIZE 2
+#endif
+
+// Maximum number of fragments sent by one extended_result_step() call. No
+// fragment is sent while events of the previous pass are still waiting for
+// the NCP transport, see EXTENDED_RESULT_STEP_MAX_HELD_PASSES.
+#ifndef EXTENDED_RESULT_STEP_MAX_FRAGMENTS
+#define EXTENDED_RESULT_STEP_MAX_FRAGMENTS 4
+#endif
+
+// Maximum number of extended_result_step() calls in a row that hold the
+// fragments back because events are pending. The next call sends one
+// fragment, so the queue drains even if the stack always has events pending.
+// 0..255.
+#ifndef EXTENDED_RESULT_STEP_MAX_HELD_PASSES
+#define EXTENDED_RESULT_STEP_MAX_HELD_PASSES 16
+#endif
+
+// Maximum number of event bytes queued to the BGAPI event buffer by one
+// extended_result_step() call. At least one fragment is always sent.
+#ifndef EXTENDED_RESULT_STEP_MAX_BYTES
+#define EXTENDED_RESULT_STEP_MAX_BYTES     1024
+#endif
+
+// Extended result queue statistics
+typedef struct {
+  uint32_t queued;                ///< Procedures accepted into the queue
+  uint32_t dropped_queue_full;    ///< Procedures dropped because the queue was full
+  uint32_t dropped_serialization; ///< Procedures dropped because they did not fit a slot
+  uint8_t high_watermark;         ///< Highest number of procedures queued at once
+  uint8_t depth;                  ///< Number of procedures currently queued
+  uint32_t last_drain_time_ms;    ///< Time from queuing to last fragment of the latest procedure
+  uint32_t max_drain_time_ms;     ///< Longest time from queuing to last fragment
+  uint32_t throttled_passes;      ///< Passes without fragments because events were pending
+} extended_result_stats_t;
 
 /**************************************************************************//**
- * Add extended result data to the ACP event buffer.
+ * Add extended result data to the ACP event queue.
  *****************************************************************************/
 void cs_on_extended_result(const uint8_t conn_handle,
                            const uint16_t ranging_counter,
@@ -49,4 +94,10 @@ void cs_on_extended_result(const uint8_t conn_handle,
  *****************************************************************************/
 void extended_result_step(void);
 
+/**************************************************************************//**
+ * Get extended result queue statistics.
+ * @param[out] stats Statistics since boot.
+ *****************************************************************************/
+void extended_result_get_stats(extended_result_stats_t *stats);
+
 #endif // EXTENDED_RESULT_H
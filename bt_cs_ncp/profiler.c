@@ -0,0 +1,198 @@
+/***************************************************************************//**
+ * @file
+ * @brief Execution time probes for the hot paths of the application.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#if !defined(__arm__) && !defined(_POSIX_C_SOURCE)
+// clock_gettime() on the host
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <string.h>
+#include "sl_component_catalog.h"
+#include "profiler.h"
+
+#if defined(__arm__)
+#include "em_device.h"
+#else
+#include <time.h>
+#endif
+
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#include "sl_core.h"
+#endif
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define NSEC_PER_SEC              1000000000u
+
+// With a kernel the probes run in more than one task, so a task switch could
+// split the update of a probe. Without a kernel every probe runs in the main
+// loop and no lock is needed.
+#if defined(SL_CATALOG_KERNEL_PRESENT)
+#define PROFILER_LOCK()           CORE_DECLARE_IRQ_STATE; CORE_ENTER_ATOMIC()
+#define PROFILER_UNLOCK()         CORE_EXIT_ATOMIC()
+#else
+#define PROFILER_LOCK()
+#define PROFILER_UNLOCK()
+#endif
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static profiler_stats_t probes[PROFILER_PROBE_COUNT];
+
+static const char *const probe_names[PROFILER_PROBE_COUNT] = {
+  "cs_on_result",
+  "cs_on_extended_result",
+  "extended_result_step",
+  "app_process_action",
+  "rtl_log_callback",
+  "acp_command"
+};
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Start the tick counter and clear the statistics.
+ *****************************************************************************/
+void profiler_init(void)
+{
+#if defined(__arm__)
+#if defined(DCB)
+  DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+#else
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#endif
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif // __arm__
+  for (uint32_t i = 0u; i < PROFILER_PROBE_COUNT; i++) {
+    profiler_reset((profiler_probe_t)i);
+  }
+}
+
+/******************************************************************************
+ * Get the tick counter.
+ *****************************************************************************/
+uint32_t profiler_get_ticks(void)
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  struct timespec now;
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * NSEC_PER_SEC + (uint64_t)now.tv_nsec);
+#endif
+}
+
+/******************************************************************************
+ * Get the frequency of the tick counter in Hz.
+ *****************************************************************************/
+uint32_t profiler_get_tick_hz(void)
+{
+#if defined(__arm__)
+  return SystemCoreClockGet();
+#else
+  return NSEC_PER_SEC;
+#endif
+}
+
+/******************************************************************************
+ * Add a duration to the statistics of a probe.
+ *****************************************************************************/
+void profiler_record(profiler_probe_t probe, uint32_t ticks)
+{
+  if (probe >= PROFILER_PROBE_COUNT) {
+    return;
+  }
+  profiler_stats_t *stats = &probes[probe];
+  uint32_t bin = (ticks == 0u) ? 0u : (31u - (uint32_t)__builtin_clz(ticks));
+
+  if (bin >= PROFILER_HISTOGRAM_BINS) {
+    bin = PROFILER_HISTOGRAM_BINS - 1u;
+  }
+  PROFILER_LOCK();
+  if (stats->count < UINT32_MAX) {
+    stats->count++;
+    stats->total_ticks += ticks;
+    stats->histogram[bin]++;
+  }
+  if (ticks < stats->min_ticks) {
+    stats->min_ticks = ticks;
+  }
+  if (ticks > stats->max_ticks) {
+    stats->max_ticks = ticks;
+  }
+  PROFILER_UNLOCK();
+}
+
+/******************************************************************************
+ * Get the statistics of a probe.
+ *****************************************************************************/
+void profiler_get_stats(profiler_probe_t probe, profiler_stats_t *stats)
+{
+  if (probe >= PROFILER_PROBE_COUNT) {
+    memset(stats, 0, sizeof(*stats));
+    return;
+  }
+  PROFILER_LOCK();
+  *stats = probes[probe];
+  PROFILER_UNLOCK();
+  if (stats->count == 0u) {
+    stats->min_ticks = 0u;
+  }
+}
+
+/******************************************************************************
+ * Clear the statistics of a probe.
+ *****************************************************************************/
+void profiler_reset(profiler_probe_t probe)
+{
+  if (probe >= PROFILER_PROBE_COUNT) {
+    return;
+  }
+  PROFILER_LOCK();
+  memset(&probes[probe], 0, sizeof(probes[probe]));
+  probes[probe].min_ticks = UINT32_MAX;
+  PROFILER_UNLOCK();
+}
+
+/******************************************************************************
+ * Get the name of a probe.
+ *****************************************************************************/
+const char *profiler_get_probe_name(profiler_probe_t probe)
+{
+  return (probe < PROFILER_PROBE_COUNT) ? probe_names[probe] : "unknown";
+}
@@ -0,0 +1,89 @@
+/***************************************************************************//**
+ * @file
+ * @brief Algorithm mode selection of a tag from its movement.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "algo_switch.h"
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the selection.
+ *****************************************************************************/
+void algo_switch_init(algo_switch_t *sw)
+{
+  sw->mode = ALGO_SWITCH_MODE_FAST;
+  sw->still_results = 0u;
+  sw->transitions = 0u;
+}
+
+/******************************************************************************
+ * Feed the movement state of a result to the selection.
+ *****************************************************************************/
+bool algo_switch_update(algo_switch_t *sw, bool moving)
+{
+  algo_switch_mode_t mode = sw->mode;
+
+  if (moving) {
+    sw->still_results = 0u;
+    mode = ALGO_SWITCH_MODE_FAST;
+  } else if (sw->still_results < CS_INITIATOR_AUTO_ALGO_STILL_RESULTS) {
+    sw->still_results++;
+  }
+  if (sw->still_results >= CS_INITIATOR_AUTO_ALGO_STILL_RESULTS) {
+    mode = ALGO_SWITCH_MODE_STATIC;
+  }
+
+  if (mode == sw->mode) {
+    return false;
+  }
+  sw->mode = mode;
+  sw->transitions++;
+  return true;
+}
+
+/******************************************************************************
+ * Get the current mode.
+ *****************************************************************************/
+algo_switch_mode_t algo_switch_get_mode(const algo_switch_t *sw)
+{
+  return sw->mode;
+}
+
+/******************************************************************************
+ * Get the number of mode changes since initialization.
+ *****************************************************************************/
+uint32_t algo_switch_get_transitions(const algo_switch_t *sw)
+{
+  return sw->transitions;
+}
@@ -0,0 +1,89 @@
+/***************************************************************************//**
+ * @file
+ * @brief Algorithm mode selection of a tag from its movement.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef ALGO_SWITCH_H
+#define ALGO_SWITCH_H
+
+// The selection has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Algorithm mode of a tag
+typedef enum {
+  ALGO_SWITCH_MODE_FAST,      ///< Moving tag, REAL_TIME_FAST
+  ALGO_SWITCH_MODE_STATIC     ///< Still tag, STATIC_HIGH_ACCURACY
+} algo_switch_mode_t;
+
+/// Algorithm mode selection of an initiator instance
+typedef struct {
+  algo_switch_mode_t mode;    ///< Current mode
+  uint8_t still_results;      ///< Consecutive results without movement
+  uint32_t transitions;       ///< Number of mode changes
+} algo_switch_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the selection. A new tag is taken as moving.
+ * @param[out] sw Selection.
+ *****************************************************************************/
+void algo_switch_init(algo_switch_t *sw);
+
+/**************************************************************************//**
+ * Feed the movement state of a result to the selection.
+ * A moving tag switches to the fast mode at once, a tag switches to the
+ * static mode after CS_INITIATOR_AUTO_ALGO_STILL_RESULTS results without
+ * movement.
+ * @param[in,out] sw     Selection.
+ * @param[in]     moving The tag moves.
+ * @return true if the mode has changed.
+ *****************************************************************************/
+bool algo_switch_update(algo_switch_t *sw, bool moving);
+
+/**************************************************************************//**
+ * Get the current mode.
+ * @param[in] sw Selection.
+ * @return Current mode.
+ *****************************************************************************/
+algo_switch_mode_t algo_switch_get_mode(const algo_switch_t *sw);
+
+/**************************************************************************//**
+ * Get the number of mode changes since initialization.
+ * @param[in] sw Selection.
+ * @return Number of mode changes.
+ *****************************************************************************/
+uint32_t algo_switch_get_transitions(const algo_switch_t *sw);
+
+#endif // ALGO_SWITCH_H
@@ -31,6 +31,7 @@
 // Includes
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <math.h>
 #include "sl_bluetooth.h"
 #include "sl_component_catalog.h"
@@ -40,12 +41,33 @@
 #include "sl_main_init.h"
 #include "app.h"
 #include "trace.h"
+#include "rtl_log.h"
 #include "app_config.h"
 #include "app_timer.h"
+#include "output_frame.h"
+#include "milestone.h"
+#include "profiler.h"
+#include "sl_sleeptimer.h"
+#include "sl_memory_manager.h"
+#include "sl_common.h"
 
 // initiator content
 #include "cs_antenna.h"
 #include "cs_result.h"
+#include "cs_result_decode.h"
+#include "cs_result_queue.h"
+#include "tag_rotation.h"
+#include "reconnect_cache.h"
+#include "cs_recovery.h"
+#include "motion.h"
+#include "interval_control.h"
+#include "algo_switch.h"
+#include "initiator_profile.h"
+#include "priority_schedule.h"
+#include "ranging_data_size.h"
+#include "output_policy.h"
+#include "distance_filter.h"
+#include "config_check.h"
 #include "cs_initiator.h"
 #include "cs_initiator_client.h"
 #include "cs_initiator_config.h"
@@ -60,9 +82,22 @@
 #include "ble_peer_manager_connections.h"
 #include "ble_peer_manager_central.h"
 #include "ble_peer_manager_filter.h"
+#include "ble_peer_manager_common_config.h"
+#include "sl_bluetooth_connection_config.h"
+
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+#include "sl_btctrl_anchor_selection_config.h"
+#if (SL_BTCTRL_ANCHOR_SELECTION_ALGORITHM != SL_BTCTRL_ANCHOR_SELECTION_ALGORITHM_EVEN)
+#warning "Priority scheduling expects the even anchor selection to keep the CS events of the tags apart"
+#endif
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
 
 #ifdef SL_CATALOG_CS_INITIATOR_CLI_PRESENT
 #include "cs_initiator_cli.h"
+#if CS_INITIATOR_OUTPUT_POLICY || PROFILER_ENABLE
+#include "sl_cli.h"
+#include "sl_cli_instances.h"
+#endif // CS_INITIATOR_OUTPUT_POLICY || PROFILER_ENABLE
 #endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
 
 #ifdef SL_CATALOG_SIMPLE_BUTTON_PRESENT
@@ -70,6 +105,11 @@
 #include "sl_simple_button_instances.h"
 #endif // SL_CATALOG_SIMPLE_BUTTON_PRESENT
 
+#if (CS_INITIATOR_OUTPUT_FORMAT == CS_INITIATOR_OUTPUT_FORMAT_BINARY)
+#include "sl_iostream.h"
+#include "sl_iostream_handles.h"
+#endif // CS_INITIATOR_OUTPUT_FORMAT
+
 // -----------------------------------------------------------------------------
 // Macros
 
@@ -81,34 +121,69 @@
 #define BT_ADDR_LEN                      sizeof(bd_addr)
 #define DISPLAY_REFRESH_RATE             1000u // ms
 #define ABS(x)                           ((x < 0) ? ((-1) * x) : x)
+#define INSTANCE_NUM_INVALID             UINT8_MAX
+#define CONN_HANDLE_COUNT                (UINT8_MAX + 1u)
+// Movement of the tags is tracked
+#define MOTION_CONTROL                   (CS_INITIATOR_ADAPTIVE_INTERVAL || CS_INITIATOR_AUTO_ALGO_MODE)
+// Connections the application can use. The CS initiator component, the peer
+// manager and the Bluetooth stack size their connection tables at compile
+// time, and the CS initiator component supports at most 4 connections.
+#define CONNECTION_LIMIT                 SL_MIN(SL_MIN(CS_INITIATOR_MAX_CONNECTIONS,                    \
+                                                       BLE_PEER_MANAGER_COMMON_MAX_ALLOWED_CONN_COUNT), \
+                                                SL_BT_CONFIG_MAX_CONNECTIONS)
+// Heap taken by one tag, see allocate_instances()
+#define TAG_HEAP_SIZE                    sizeof(cs_initiator_instances_t)
+// RAM needed by one more tag: its heap, the initiator and reflector ranging
+// data buffers of the CS initiator component and one more connection of the
+// Bluetooth stack and the peer manager
+#define TAG_RAM_COST                     (TAG_HEAP_SIZE                              \
+                                          + 2u * CS_INITIATOR_MAX_RANGING_DATA_SIZE \
+                                          + CS_INITIATOR_CONNECTION_RAM_COST)
 
 // -----------------------------------------------------------------------------
 // Enums, structs, typedef
 
-// Measurement structure
-typedef struct {
-  float distance_filtered;
-  float distance_raw;
-  float likeliness;
-  float distance_estimate_rssi;
-  float velocity;
-  float bit_error_rate;
-} cs_measurement_data_t;
-
 // CS initiator instance
 typedef struct {
   uint8_t conn_handle;
   uint32_t measurement_cnt;
   uint32_t ranging_counter;
+  uint32_t timestamp_ms;
   cs_measurement_data_t measurement_mainmode;
   cs_measurement_data_t measurement_submode;
   cs_intermediate_result_t measurement_progress;
-  bool measurement_arrived;
+  cs_result_queue_t result_queue;
+  uint32_t overflow_reported;
   bool measurement_progress_changed;
   bool read_remote_capabilities;
+  bool fast_reconnect;
   uint8_t number_of_measurements;
+  cs_initiator_config_t config;
+  rtl_config_t rtl_config;
+  bool recovery_pending;
+  cs_recovery_instance_t recovery;
+  app_timer_t recovery_timer;
+  motion_t motion;
+  interval_control_t interval_control;
+  algo_switch_t algo_switch;
+  uint32_t motion_restarts;
+  uint8_t priority;
+  uint16_t base_procedure_interval;
+#if CS_INITIATOR_OUTPUT_POLICY
+  output_policy_t output_policy;
+#endif // CS_INITIATOR_OUTPUT_POLICY
+#if CS_INITIATOR_DISTANCE_FILTER
+  distance_filter_t distance_filter;
+  distance_filter_t rssi_filter;
+#endif // CS_INITIATOR_DISTANCE_FILTER
 } cs_initiator_instances_t;
 
+// Open time of a connection, kept until its first result
+typedef struct {
+  uint8_t conn_handle;
+  uint32_t opened_ms;
+} connection_timing_t;
+
 // -----------------------------------------------------------------------------
 // Static function declarations
 
@@ -128,9 +203,84 @@ static void cs_on_error(uint8_t conn_handle,
                         sl_status_t sc);
 static sl_status_t get_instance_number(uint8_t conn_handle, uint8_t *instance_num);
 static void check_cli_values(void);
-static sl_status_t create_new_initiator_instance(uint8_t conn_handle);
+static sl_status_t create_new_initiator_instance(uint8_t conn_handle,
+                                                 const cs_initiator_config_t *config,
+                                                 const rtl_config_t *instance_rtl_config);
 static void delete_initiator_instance(uint8_t conn_handle);
+static void recover_initiator_instance(uint8_t conn_handle, cs_error_event_t err_evt, sl_status_t sc);
+static void recovery_timer_callback(app_timer_t *timer, void *data);
+static void restart_initiator(uint8_t instance_num);
+#if MOTION_CONTROL
+static void apply_motion_control(uint8_t instance_num);
+#endif // MOTION_CONTROL
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+static uint8_t get_instance_priority(uint8_t conn_handle);
+static void schedule_procedures(void);
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
 static void app_timer_callback(app_timer_t *timer, void *data);
+static uint8_t allocate_instances(void);
+static uint32_t get_time_ms(void);
+static sl_status_t start_scanning(void);
+static void get_instance_config(uint8_t connection,
+                                cs_initiator_config_t *config,
+                                rtl_config_t *instance_rtl_config);
+static void start_initiator(uint8_t connection,
+                            cs_initiator_config_t *config,
+                            const rtl_config_t *instance_rtl_config,
+                            uint8_t remote_num_antennas,
+                            bool cached_intervals);
+static uint32_t get_ranging_data_size(const cs_initiator_config_t *config,
+                                      uint8_t remote_num_antennas);
+static void connection_timing_start(uint8_t conn_handle);
+static bool connection_timing_stop(uint8_t conn_handle, uint32_t *elapsed_ms);
+#if CS_INITIATOR_RECONNECT_CACHE
+static uint32_t get_config_signature(const cs_initiator_config_t *config,
+                                     const rtl_config_t *instance_rtl_config);
+static bool find_reconnect_cache(uint8_t connection,
+                                 const cs_initiator_config_t *config,
+                                 const rtl_config_t *instance_rtl_config,
+                                 reconnect_cache_entry_t *entry);
+static bool try_fast_reconnect(uint8_t connection);
+static bool apply_reconnect_cache(uint8_t connection,
+                                  uint8_t remote_num_antennas,
+                                  cs_initiator_config_t *config,
+                                  const rtl_config_t *instance_rtl_config);
+static void drop_reconnect_cache(uint8_t conn_handle, cs_error_event_t err_evt);
+static void store_reconnect_cache(uint8_t connection,
+                                  const cs_initiator_config_t *config,
+                                  const rtl_config_t *instance_rtl_config,
+                                  uint8_t remote_num_antennas);
+#endif // CS_INITIATOR_RECONNECT_CACHE
+#if CS_INITIATOR_TAG_ROTATION
+static void rotation_timer_callback(app_timer_t *timer, void *data);
+#endif // CS_INITIATOR_TAG_ROTATION
+static bool process_results(uint8_t instance_num);
+static int32_t distance_to_mm(float distance);
+static uint16_t likeliness_to_fixed(float likeliness);
+static void output_measurement(uint8_t instance_num);
+static void output_tag(uint8_t instance_num, const bd_addr *address);
+#if CS_INITIATOR_DISTANCE_FILTER
+static bool check_distance_filter_gate(const cs_measurement_data_t *measurement);
+static void apply_distance_filter(uint8_t instance_num);
+#endif // CS_INITIATOR_DISTANCE_FILTER
+#if CS_INITIATOR_OUTPUT_POLICY
+static void apply_output_policy(uint8_t instance_num);
+static void output_zone(uint8_t instance_num, uint8_t previous_zone);
+static void init_output_policy_config(void);
+#if defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+static void cli_output_policy(sl_cli_command_arg_t *arguments);
+#endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#endif // CS_INITIATOR_OUTPUT_POLICY
+#if APP_MILESTONES
+static void log_milestones(uint8_t conn_handle);
+#endif // APP_MILESTONES
+#if PROFILER_ENABLE
+static void profiler_timer_callback(app_timer_t *timer, void *data);
+static void log_profile(void);
+#if defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+static void cli_profiler(sl_cli_command_arg_t *arguments);
+#endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#endif // PROFILER_ENABLE
 
 // -----------------------------------------------------------------------------
 // Static variables
@@ -140,8 +290,77 @@ static bool antenna_set_rtt = false;
 static cs_initiator_config_t initiator_config = INITIATOR_CONFIG_DEFAULT;
 static rtl_config_t rtl_config = RTL_CONFIG_DEFAULT;
 static uint8_t num_reflector_connections = 0u;
-static cs_initiator_instances_t cs_initiator_instances[CS_INITIATOR_MAX_CONNECTIONS];
+// Instance pool allocated at boot, see allocate_instances()
+static cs_initiator_instances_t *cs_initiator_instances = NULL;
+static uint8_t max_instances = 0u;
+// Instance number of each connection handle, INSTANCE_NUM_INVALID if none
+static uint8_t instance_by_conn_handle[CONN_HANDLE_COUNT];
+// Stack of unused instance numbers
+static uint8_t free_instances[CONNECTION_LIMIT];
+static uint8_t free_instance_count = 0u;
 static app_timer_t display_timer;
+#if PROFILER_ENABLE
+static app_timer_t profiler_timer;
+#endif // PROFILER_ENABLE
+static connection_timing_t connection_timing[CONNECTION_LIMIT];
+#if APP_MILESTONES
+static milestone_tracker_t milestones;
+static milestone_record_t milestone_records[CONNECTION_LIMIT];
+#endif // APP_MILESTONES
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+// Work tables of schedule_procedures()
+static priority_schedule_tag_t schedule_tags[CONNECTION_LIMIT];
+static uint16_t schedule_intervals[CONNECTION_LIMIT];
+static uint8_t schedule_instance_nums[CONNECTION_LIMIT];
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
+#if CS_INITIATOR_TAG_ROTATION
+// Connect timeout while a tag is selected, otherwise wait for the next due tag
+static app_timer_t rotation_timer;
+static bd_addr rotation_address;
+static bool rotation_connecting = false;
+static bool rotation_scanning = false;
+#endif // CS_INITIATOR_TAG_ROTATION
+#if CS_INITIATOR_OUTPUT_POLICY
+// Output policy of new tags, see the output_policy CLI command
+static output_policy_config_t output_policy_config;
+#if defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+static const sl_cli_command_info_t cli_cmd_output_policy =
+  SL_CLI_COMMAND(cli_output_policy,
+                 "Set the output policy of a tag",
+                 "Tag index, 255 for all tags" SL_CLI_UNIT_SEPARATOR
+                 "Deadband [mm]" SL_CLI_UNIT_SEPARATOR
+                 "Heartbeat [ms]" SL_CLI_UNIT_SEPARATOR
+                 "Zone hysteresis [mm]" SL_CLI_UNIT_SEPARATOR
+                 "Zone boundaries [mm], ascending",
+                 { SL_CLI_ARG_UINT8, SL_CLI_ARG_UINT32, SL_CLI_ARG_UINT32, SL_CLI_ARG_UINT32,
+                   SL_CLI_ARG_UINT32OPT, SL_CLI_ARG_END, });
+static sl_cli_command_entry_t cli_output_policy_table[] = {
+  { "output_policy", &cli_cmd_output_policy, false },
+  { NULL, NULL, false },
+};
+static sl_cli_command_group_t cli_output_policy_group = {
+  { NULL },
+  false,
+  cli_output_policy_table
+};
+#endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#endif // CS_INITIATOR_OUTPUT_POLICY
+#if PROFILER_ENABLE && defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+static const sl_cli_command_info_t cli_cmd_profiler =
+  SL_CLI_COMMAND(cli_profiler,
+                 "Log the execution time statistics",
+                 "1 to clear the statistics after logging them",
+                 { SL_CLI_ARG_UINT8OPT, SL_CLI_ARG_END, });
+static sl_cli_command_entry_t cli_profiler_table[] = {
+  { "profiler", &cli_cmd_profiler, false },
+  { NULL, NULL, false },
+};
+static sl_cli_command_group_t cli_profiler_group = {
+  { NULL },
+  false,
+  cli_profiler_table
+};
+#endif // PROFILER_ENABLE && SL_CATALOG_CS_INITIATOR_CLI_PRESENT
 
 /******************************************************************************
  * Application Init
@@ -152,18 +371,45 @@ void app_init(void)
 
   trace_init();
 
+  max_instances = allocate_instances();
+  if (max_instances == 0u) {
+    log_error(APP_PREFIX "Not enough RAM for an initiator instance, no tag is served!" NL);
+  }
+
+#if CS_INITIATOR_OUTPUT_POLICY
+  init_output_policy_config();
+#endif // CS_INITIATOR_OUTPUT_POLICY
+
   // initialize initiator instances
-  for (uint32_t i = 0u; i < CS_INITIATOR_MAX_CONNECTIONS; i++) {
+  for (uint32_t i = 0u; i < max_instances; i++) {
     cs_initiator_instances[i].conn_handle = SL_BT_INVALID_CONNECTION_HANDLE;
     cs_initiator_instances[i].measurement_cnt = 0u;
     cs_initiator_instances[i].ranging_counter = 0u;
     memset(&cs_initiator_instances[i].measurement_mainmode, 0u, sizeof(cs_measurement_data_t));
     memset(&cs_initiator_instances[i].measurement_submode, 0u, sizeof(cs_measurement_data_t));
     memset(&cs_initiator_instances[i].measurement_progress, 0u, sizeof(cs_intermediate_result_t));
-    cs_initiator_instances[i].measurement_arrived = false;
+    cs_result_queue_init(&cs_initiator_instances[i].result_queue);
+    cs_initiator_instances[i].overflow_reported = 0u;
     cs_initiator_instances[i].measurement_progress_changed = false;
     cs_initiator_instances[i].read_remote_capabilities = false;
+    cs_initiator_instances[i].fast_reconnect = false;
     cs_initiator_instances[i].number_of_measurements = 0u;
+    cs_initiator_instances[i].config = initiator_config;
+    cs_initiator_instances[i].rtl_config = rtl_config;
+    cs_initiator_instances[i].recovery_pending = false;
+    cs_recovery_instance_init(&cs_initiator_instances[i].recovery);
+#if CS_INITIATOR_OUTPUT_POLICY
+    output_policy_init(&cs_initiator_instances[i].output_policy, &output_policy_config);
+#endif // CS_INITIATOR_OUTPUT_POLICY
+  }
+  for (uint32_t i = 0u; i < CONNECTION_LIMIT; i++) {
+    connection_timing[i].conn_handle = SL_BT_INVALID_CONNECTION_HANDLE;
+  }
+  memset(instance_by_conn_handle, INSTANCE_NUM_INVALID, sizeof(instance_by_conn_handle));
+  // Push in reverse order so that the lowest instance number is used first
+  free_instance_count = 0u;
+  for (uint32_t i = max_instances; i > 0u; i--) {
+    free_instances[free_instance_count++] = (uint8_t)(i - 1u);
   }
 
   // Set configuration parameters
@@ -180,6 +426,28 @@ void app_init(void)
     app_log_info(APP_PREFIX "Channel map preset set to high" APP_LOG_NL);
   }
 
+  // The ranging data buffers of the CS initiator component are reserved
+  // twice per connection at the build time size
+  {
+    uint32_t ranging_data_size = get_ranging_data_size(&initiator_config, 0u);
+    log_info(APP_PREFIX "Ranging data size: %lu bytes, CS_INITIATOR_MAX_RANGING_DATA_SIZE: %u bytes" NL,
+             (unsigned long)ranging_data_size,
+             CS_INITIATOR_MAX_RANGING_DATA_SIZE);
+    if (ranging_data_size < CS_INITIATOR_MAX_RANGING_DATA_SIZE) {
+      log_info(APP_PREFIX "Lowering it to the ranging data size would free %lu bytes per connection" NL,
+               (unsigned long)(2u * (CS_INITIATOR_MAX_RANGING_DATA_SIZE - ranging_data_size)));
+    }
+  }
+
+#if CS_INITIATOR_OUTPUT_POLICY && defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+  app_assert(sl_cli_command_add_command_group(sl_cli_default_handle, &cli_output_policy_group),
+             APP_PREFIX "Failed to add the output_policy CLI command!" NL);
+#endif // CS_INITIATOR_OUTPUT_POLICY && SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#if PROFILER_ENABLE && defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+  app_assert(sl_cli_command_add_command_group(sl_cli_default_handle, &cli_profiler_group),
+             APP_PREFIX "Failed to add the profiler CLI command!" NL);
+#endif // PROFILER_ENABLE && SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+
   // Log configuration parameters
   // log_info("+-[CS initiator by Silicon Labs]--------------------------+" NL);
   // log_info("+---------------------------------------------------------+" NL);
@@ -224,6 +492,33 @@ void app_init(void)
   cs_initiator_display_set_measurement_mode(initiator_config.cs_main_mode, rtl_config.algo_mode);
   app_timer_start(&display_timer, DISPLAY_REFRESH_RATE, app_timer_callback, NULL, true);
 
+#if PROFILER_ENABLE
+  profiler_init();
+  app_timer_start(&profiler_timer,
+                  CS_INITIATOR_PROFILER_LOG_PERIOD_MS,
+                  profiler_timer_callback,
+                  NULL,
+                  true);
+#endif // PROFILER_ENABLE
+
+  cs_recovery_init(get_time_ms());
+
+#if CS_INITIATOR_RECONNECT_CACHE
+  reconnect_cache_init();
+#endif // CS_INITIATOR_RECONNECT_CACHE
+
+#if CS_INITIATOR_TAG_ROTATION
+  tag_rotation_init(get_time_ms());
+  log_info(APP_PREFIX "Tag rotation over %u tag(s), %u result(s) per visit, revisit period: %lu ms" NL,
+           tag_rotation_get_count(),
+           CS_INITIATOR_TAG_ROTATION_PROCEDURES,
+           (unsigned long)CS_INITIATOR_TAG_ROTATION_REVISIT_MS);
+#endif // CS_INITIATOR_TAG_ROTATION
+
+#if CS_INITIATOR_PROFILES
+  log_info(APP_PREFIX "%u configuration profile(s)" NL, initiator_profile_get_count());
+#endif // CS_INITIATOR_PROFILES
+
   /////////////////////////////////////////////////////////////////////////////
   // Put your additional application init code here!                         //
   // This is called once during start-up.                                    //
@@ -235,10 +530,11 @@ void app_init(void)
  *****************************************************************************/
 void app_process_action(void)
 {
-  for (uint8_t i = 0u; i < CS_INITIATOR_MAX_CONNECTIONS; i++) {
-    if (cs_initiator_instances[i].measurement_arrived) {
-      // write results to the display & to the iostream
-      cs_initiator_instances[i].measurement_arrived = false;
+  PROFILER_BEGIN(PROFILER_PROBE_APP_PROCESS_ACTION);
+  rtl_log_step();
+  for (uint8_t i = 0u; i < max_instances; i++) {
+    if (process_results(i)) {
+      // write the latest result to the display
       // log_info(APP_INSTANCE_PREFIX "# %04lu --- Ranging Counter = %04lu" NL,
       //          cs_initiator_instances[i].conn_handle,
       //          cs_initiator_instances[i].measurement_cnt,
@@ -262,18 +558,6 @@ void app_process_action(void)
       //            cs_initiator_instances[i].conn_handle,
       //            (uint32_t)(cs_initiator_instances[i].measurement_submode.distance_filtered * 1000.f));
       // }
-      
-      const bd_addr *bt_address = ble_peer_manager_get_bt_address(cs_initiator_instances[i].conn_handle);
-      log_info("{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"distance\": %lu}\r\n",
-               bt_address->addr[5],
-               bt_address->addr[4],
-               bt_address->addr[3],
-               bt_address->addr[2],
-               bt_address->addr[1],
-               bt_address->addr[0],
-              (uint32_t)(cs_initiator_instances[i].measurement_mainmode.distance_filtered * 1000.f));
-
-              
 
       // log_info(APP_INSTANCE_PREFIX "Raw main mode distance: %lu mm" NL,
       //          cs_initiator_instances[i].conn_handle,
@@ -327,8 +611,8 @@ void app_process_action(void)
                                        cs_initiator_instances[i].measurement_mainmode.bit_error_rate,
                                        cs_initiator_instances[i].measurement_mainmode.distance_raw,
                                        cs_initiator_instances[i].measurement_progress.progress_percentage,
-                                       rtl_config.algo_mode,
-                                       initiator_config.cs_main_mode);
+                                       cs_initiator_instances[i].rtl_config.algo_mode,
+                                       cs_initiator_instances[i].config.cs_main_mode);
     } else if (cs_initiator_instances[i].measurement_progress_changed) {
       // write measurement progress to the display without changing the last valid
       // measurement results
@@ -351,10 +635,11 @@ void app_process_action(void)
                                        cs_initiator_instances[i].measurement_mainmode.bit_error_rate,
                                        cs_initiator_instances[i].measurement_mainmode.distance_raw,
                                        cs_initiator_instances[i].measurement_progress.progress_percentage,
-                                       rtl_config.algo_mode,
-                                       initiator_config.cs_main_mode);
+                                       cs_initiator_instances[i].rtl_config.algo_mode,
+                                       cs_initiator_instances[i].config.cs_main_mode);
     }
   }
+  PROFILER_END(PROFILER_PROBE_APP_PROCESS_ACTION);
 
   /////////////////////////////////////////////////////////////////////////////
   // Put your additional application code here!                              //
@@ -373,6 +658,549 @@ static void app_timer_callback(app_timer_t *timer, void *data)
   cs_initiator_display_update();
 }
 
+#if PROFILER_ENABLE
+/******************************************************************************
+ * Profiler timer callback
+ *****************************************************************************/
+static void profiler_timer_callback(app_timer_t *timer, void *data)
+{
+  (void)timer;
+  (void)data;
+  log_profile();
+}
+
+/******************************************************************************
+ * Log the execution time statistics of every probe that has run
+ *****************************************************************************/
+static void log_profile(void)
+{
+  profiler_stats_t stats;
+  uint64_t tick_hz = profiler_get_tick_hz();
+  char histogram_str[PROFILER_HISTOGRAM_BINS * 12u];
+
+  for (uint32_t probe = 0u; probe < PROFILER_PROBE_COUNT; probe++) {
+    profiler_get_stats((profiler_probe_t)probe, &stats);
+    if (stats.count == 0u) {
+      continue;
+    }
+    size_t len = 0u;
+    histogram_str[0] = '\0';
+    for (uint32_t bin = 0u; bin < PROFILER_HISTOGRAM_BINS && len < sizeof(histogram_str); bin++) {
+      if (stats.histogram[bin] != 0u) {
+        int written = snprintf(&histogram_str[len], sizeof(histogram_str) - len, " %lu:%lu",
+                               (unsigned long)bin,
+                               (unsigned long)stats.histogram[bin]);
+        len += (written > 0) ? (size_t)written : 0u;
+      }
+    }
+    log_info(APP_PREFIX "Profile %s: n=%lu min=%lu mean=%lu max=%lu us, log2(ticks):count%s" NL,
+             profiler_get_probe_name((profiler_probe_t)probe),
+             (unsigned long)stats.count,
+             (unsigned long)((uint64_t)stats.min_ticks * 1000000u / tick_hz),
+             (unsigned long)(stats.total_ticks / stats.count * 1000000u / tick_hz),
+             (unsigned long)((uint64_t)stats.max_ticks * 1000000u / tick_hz),
+             histogram_str);
+  }
+}
+
+#if defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+/******************************************************************************
+ * CLI command: profiler [reset]
+ * Logs the statistics right away, and clears them if reset is 1.
+ *****************************************************************************/
+static void cli_profiler(sl_cli_command_arg_t *arguments)
+{
+  bool reset = (sl_cli_get_argument_count(arguments) > 0)
+               && (sl_cli_get_argument_uint8(arguments, 0) == 1u);
+
+  log_profile();
+  if (reset) {
+    for (uint32_t probe = 0u; probe < PROFILER_PROBE_COUNT; probe++) {
+      profiler_reset((profiler_probe_t)probe);
+    }
+    log_info(APP_PREFIX "Profile cleared" NL);
+  }
+}
+#endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#endif // PROFILER_ENABLE
+
+/******************************************************************************
+ * Allocate the instance pool from the heap left after the Bluetooth stack
+ * and the other components have been initialized. The pool is as large as
+ * the RAM budget allows, capped by the connection limit of the CS initiator
+ * component, the peer manager and the Bluetooth stack. The tables that have
+ * one entry per tag are static arrays of CONNECTION_LIMIT entries.
+ * @return Number of allocated instances, 0 if not even one fits.
+ *****************************************************************************/
+static uint8_t allocate_instances(void)
+{
+  size_t free_heap = sl_memory_get_free_heap_size();
+  size_t budget = (free_heap > CS_INITIATOR_RAM_RESERVE) ? (free_heap - CS_INITIATOR_RAM_RESERVE) : 0u;
+  size_t ram_tag_count = budget / TAG_HEAP_SIZE;
+  uint8_t count = (uint8_t)SL_MIN(ram_tag_count, (size_t)CONNECTION_LIMIT);
+  void *pool = NULL;
+
+  while (count > 0u
+         && sl_memory_alloc(count * TAG_HEAP_SIZE,
+                            BLOCK_TYPE_LONG_TERM,
+                            &pool) != SL_STATUS_OK) {
+    count--;
+  }
+  cs_initiator_instances = (cs_initiator_instances_t *)pool;
+
+  log_info(APP_PREFIX "Free heap: %lu bytes, reserve: %lu bytes, tag: %lu bytes" NL,
+           (unsigned long)free_heap,
+           (unsigned long)CS_INITIATOR_RAM_RESERVE,
+           (unsigned long)TAG_HEAP_SIZE);
+  log_info(APP_PREFIX "Maximum tag count: %u (connection limit: %u, "
+                      "the CS initiator component supports at most 4)" NL,
+           count,
+           CONNECTION_LIMIT);
+  // Static buffers, computed at build time in config_check.h
+  log_info(APP_PREFIX "Static buffers: %lu bytes (ranging data: %lu, %lu needed by the default "
+                      "configuration, RAS server: %lu, Bluetooth stack: %lu)" NL,
+           CONFIG_CHECK_RAM_TOTAL,
+           CONFIG_CHECK_RAM_RANGING_DATA,
+           CONFIG_CHECK_RAM_RANGING_DATA_NEEDED,
+           CONFIG_CHECK_RAM_RAS_SERVER,
+           CONFIG_CHECK_RAM_BT_BUFFER);
+  // Tell how far the compile time limits could be raised with the RAM left
+  budget = (budget > count * TAG_HEAP_SIZE) ? (budget - count * TAG_HEAP_SIZE) : 0u;
+  log_info(APP_PREFIX "Remaining RAM fits %lu more tag(s) at %lu bytes each, "
+                      "%lu of them for the Bluetooth stack and the peer manager" NL,
+           (unsigned long)(budget / TAG_RAM_COST),
+           (unsigned long)TAG_RAM_COST,
+           (unsigned long)CS_INITIATOR_CONNECTION_RAM_COST);
+  return count;
+}
+
+/******************************************************************************
+ * Get the time since boot in milliseconds, wrapping around every 49 days
+ *****************************************************************************/
+static uint32_t get_time_ms(void)
+{
+  uint64_t ms = 0u;
+  (void)sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(), &ms);
+  return (uint32_t)ms;
+}
+
+/******************************************************************************
+ * Start scanning for the next reflector.
+ * With tag rotation the scanner is pointed at the tag that has been waiting
+ * the longest. If no tag is due yet, scanning is postponed until it is.
+ *****************************************************************************/
+static sl_status_t start_scanning(void)
+{
+#if CS_INITIATOR_TAG_ROTATION
+  sl_status_t sc;
+  uint32_t wait_ms;
+
+  // One tag is connecting at a time; every visiting tag holds a slot from
+  // selection until it is skipped or disconnected.
+  if (rotation_connecting || tag_rotation_get_visiting_count() >= max_instances) {
+    return SL_STATUS_OK;
+  }
+  sc = tag_rotation_select(get_time_ms(), &rotation_address, &wait_ms);
+  if (sc == SL_STATUS_NOT_READY) {
+    return app_timer_start(&rotation_timer, wait_ms, rotation_timer_callback, NULL, false);
+  } else if (sc != SL_STATUS_OK) {
+    // Every tag is visited right now or the list is empty
+    return SL_STATUS_OK;
+  }
+  log_info(APP_PREFIX "Visiting tag %02X:%02X:%02X:%02X:%02X:%02X" NL,
+           rotation_address.addr[5],
+           rotation_address.addr[4],
+           rotation_address.addr[3],
+           rotation_address.addr[2],
+           rotation_address.addr[1],
+           rotation_address.addr[0]);
+  // A running scan picks up the new address. The name and RAS service
+  // filters set at boot stay in place.
+  sc = ble_peer_manager_set_filter_bt_address(&rotation_address);
+  if (sc != SL_STATUS_OK) {
+    return sc;
+  }
+  rotation_connecting = true;
+  MILESTONE_SCAN_STARTED(&milestones, get_time_ms());
+  sc = app_timer_start(&rotation_timer,
+                       CS_INITIATOR_TAG_ROTATION_CONNECT_TIMEOUT_MS,
+                       rotation_timer_callback,
+                       NULL,
+                       false);
+  if (sc != SL_STATUS_OK || rotation_scanning) {
+    return sc;
+  }
+  sc = ble_peer_manager_central_create_connection();
+  rotation_scanning = (sc == SL_STATUS_OK);
+  return sc;
+#else
+  sl_status_t sc;
+
+  // Without an instance no connection could be served
+  if (max_instances == 0u) {
+    return SL_STATUS_OK;
+  }
+  sc = ble_peer_manager_central_create_connection();
+  if (sc == SL_STATUS_OK) {
+    MILESTONE_SCAN_STARTED(&milestones, get_time_ms());
+  }
+  return sc;
+#endif // CS_INITIATOR_TAG_ROTATION
+}
+
+#if CS_INITIATOR_TAG_ROTATION
+/******************************************************************************
+ * Skip the selected tag if it was not found in time, then move on to the
+ * next due tag
+ *****************************************************************************/
+static void rotation_timer_callback(app_timer_t *timer, void *data)
+{
+  (void)timer;
+  (void)data;
+  if (rotation_connecting) {
+    log_info(APP_PREFIX "Tag %02X:%02X:%02X:%02X:%02X:%02X not found, skipping" NL,
+             rotation_address.addr[5],
+             rotation_address.addr[4],
+             rotation_address.addr[3],
+             rotation_address.addr[2],
+             rotation_address.addr[1],
+             rotation_address.addr[0]);
+    tag_rotation_on_connect_failed(&rotation_address, get_time_ms());
+    rotation_connecting = false;
+  }
+  (void)start_scanning();
+}
+#endif // CS_INITIATOR_TAG_ROTATION
+
+/******************************************************************************
+ * Output every queued result of an instance in arrival order.
+ * Results of a previous connection on the same instance are discarded.
+ * @return true if at least one result has been output.
+ *****************************************************************************/
+static bool process_results(uint8_t instance_num)
+{
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  const cs_result_queue_entry_t *entry;
+  bool output = false;
+#if MOTION_CONTROL
+  bool restart = false;
+#endif // MOTION_CONTROL
+
+  while ((entry = cs_result_queue_peek(&instance->result_queue)) != NULL) {
+    if (entry->conn_handle == instance->conn_handle
+#if CS_INITIATOR_DISTANCE_FILTER
+        && check_distance_filter_gate(&entry->mainmode)
+#endif // CS_INITIATOR_DISTANCE_FILTER
+        ) {
+      instance->ranging_counter = entry->ranging_counter;
+      instance->timestamp_ms = entry->timestamp_ms;
+      instance->measurement_mainmode = entry->mainmode;
+      instance->measurement_submode = entry->submode;
+#if CS_INITIATOR_DISTANCE_FILTER
+      apply_distance_filter(instance_num);
+#endif // CS_INITIATOR_DISTANCE_FILTER
+#if CS_INITIATOR_OUTPUT_POLICY
+      apply_output_policy(instance_num);
+#else
+      output_measurement(instance_num);
+#endif // CS_INITIATOR_OUTPUT_POLICY
+      output = true;
+#if MOTION_CONTROL
+      if (!isnan(instance->measurement_mainmode.distance_filtered)) {
+        // Velocity is zero if it is not measured
+        bool moving = motion_update(&instance->motion,
+                                    distance_to_mm(instance->measurement_mainmode.distance_filtered),
+                                    (uint32_t)(fabsf(instance->measurement_mainmode.velocity) * 1000.f));
+#if CS_INITIATOR_ADAPTIVE_INTERVAL
+        restart |= interval_control_update(&instance->interval_control, moving, instance->timestamp_ms);
+#endif // CS_INITIATOR_ADAPTIVE_INTERVAL
+#if CS_INITIATOR_AUTO_ALGO_MODE
+        restart |= algo_switch_update(&instance->algo_switch, moving);
+#endif // CS_INITIATOR_AUTO_ALGO_MODE
+      }
+#endif // MOTION_CONTROL
+    }
+    cs_result_queue_release(&instance->result_queue);
+  }
+#if MOTION_CONTROL
+  if (restart) {
+    apply_motion_control(instance_num);
+  }
+#endif // MOTION_CONTROL
+
+  uint32_t overflow_count = cs_result_queue_get_overflow_count(&instance->result_queue);
+  if (overflow_count != instance->overflow_reported) {
+    log_error(APP_INSTANCE_PREFIX "Result queue full, %lu result(s) dropped" NL,
+              instance->conn_handle,
+              (unsigned long)(overflow_count - instance->overflow_reported));
+    instance->overflow_reported = overflow_count;
+  }
+  return output;
+}
+
+/******************************************************************************
+ * Convert a distance in m to mm. Values beyond the int32_t range are
+ * saturated, NaN gives 0.
+ *****************************************************************************/
+static int32_t distance_to_mm(float distance)
+{
+  float distance_mm = distance * 1000.f;
+
+  if (isnan(distance_mm)) {
+    return 0;
+  }
+  if (distance_mm >= 2147483647.f) {
+    return INT32_MAX;
+  }
+  if (distance_mm <= -2147483648.f) {
+    return INT32_MIN;
+  }
+  return (int32_t)distance_mm;
+}
+
+/******************************************************************************
+ * Convert a likeliness of 0..1 to 0..10000. NaN gives 0, values outside of
+ * the range are clamped.
+ *****************************************************************************/
+static uint16_t likeliness_to_fixed(float likeliness)
+{
+  if (isnan(likeliness) || likeliness <= 0.f) {
+    return 0u;
+  }
+  if (likeliness >= 1.f) {
+    return 10000u;
+  }
+  return (uint16_t)(likeliness * 10000.f);
+}
+
+/******************************************************************************
+ * Write a measurement result to the output in the configured format.
+ * Results without a distance are not output.
+ *****************************************************************************/
+static void output_measurement(uint8_t instance_num)
+{
+  const cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  if (isnan(instance->measurement_mainmode.distance_filtered)) {
+    return;
+  }
+#if (CS_INITIATOR_OUTPUT_FORMAT == CS_INITIATOR_OUTPUT_FORMAT_BINARY)
+  uint8_t frame[OUTPUT_FRAME_MAX_LEN];
+  output_frame_measurement_t measurement = {
+    .tag_index = instance_num,
+    .ranging_counter = (uint16_t)instance->ranging_counter,
+    .timestamp_ms = instance->timestamp_ms,
+    .distance_mm = distance_to_mm(instance->measurement_mainmode.distance_filtered),
+    .likeliness = likeliness_to_fixed(instance->measurement_mainmode.likeliness),
+    .rssi_distance_mm = distance_to_mm(instance->measurement_mainmode.distance_estimate_rssi)
+  };
+  size_t frame_len = output_frame_encode_measurement(&measurement, frame);
+  (void)sl_iostream_write(sl_iostream_recommended_console_stream, frame, frame_len);
+#else
+  const bd_addr *bt_address = ble_peer_manager_get_bt_address(instance->conn_handle);
+  log_output("{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"distance\": %ld}\r\n",
+             bt_address->addr[5],
+             bt_address->addr[4],
+             bt_address->addr[3],
+             bt_address->addr[2],
+             bt_address->addr[1],
+             bt_address->addr[0],
+             (long)distance_to_mm(instance->measurement_mainmode.distance_filtered));
+#endif // CS_INITIATOR_OUTPUT_FORMAT
+}
+
+/******************************************************************************
+ * Announce the Bluetooth address behind a tag index of the binary output.
+ * A NULL address announces that the tag index has been released.
+ *****************************************************************************/
+static void output_tag(uint8_t instance_num, const bd_addr *address)
+{
+#if (CS_INITIATOR_OUTPUT_FORMAT == CS_INITIATOR_OUTPUT_FORMAT_BINARY)
+  uint8_t frame[OUTPUT_FRAME_MAX_LEN];
+  output_frame_tag_t tag = { .tag_index = instance_num };
+  if (address != NULL) {
+    memcpy(tag.address, address->addr, sizeof(tag.address));
+  } else {
+    memset(tag.address, 0, sizeof(tag.address));
+  }
+  size_t frame_len = output_frame_encode_tag(&tag, frame);
+  (void)sl_iostream_write(sl_iostream_recommended_console_stream, frame, frame_len);
+#else
+  (void)instance_num;
+  (void)address;
+#endif // CS_INITIATOR_OUTPUT_FORMAT
+}
+
+#if CS_INITIATOR_DISTANCE_FILTER
+/******************************************************************************
+ * Check if a result may enter the distance filter. Results without a distance
+ * or with a likeliness below CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS are
+ * dropped.
+ *****************************************************************************/
+static bool check_distance_filter_gate(const cs_measurement_data_t *measurement)
+{
+#if (CS_INITIATOR_DISTANCE_FILTER_INPUT == DISTANCE_FILTER_INPUT_RAW)
+  float distance = measurement->distance_raw;
+#else
+  float distance = measurement->distance_filtered;
+#endif // CS_INITIATOR_DISTANCE_FILTER_INPUT
+
+  if (isnan(distance)) {
+    return false;
+  }
+  return distance_filter_check_likeliness(likeliness_to_fixed(measurement->likeliness));
+}
+
+/******************************************************************************
+ * Replace the filtered and the RSSI based distance of the latest result of an
+ * instance by the output of its distance filters
+ *****************************************************************************/
+static void apply_distance_filter(uint8_t instance_num)
+{
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  cs_measurement_data_t *measurement = &instance->measurement_mainmode;
+#if (CS_INITIATOR_DISTANCE_FILTER_INPUT == DISTANCE_FILTER_INPUT_RAW)
+  float distance = measurement->distance_raw;
+#else
+  float distance = measurement->distance_filtered;
+#endif // CS_INITIATOR_DISTANCE_FILTER_INPUT
+
+  int32_t distance_mm = distance_filter_update(&instance->distance_filter,
+                                               distance_to_mm(distance));
+  measurement->distance_filtered = (float)distance_mm / 1000.f;
+  if (!isnan(measurement->distance_estimate_rssi)) {
+    int32_t rssi_distance_mm = distance_filter_update(&instance->rssi_filter,
+                                                      distance_to_mm(measurement->distance_estimate_rssi));
+    measurement->distance_estimate_rssi = (float)rssi_distance_mm / 1000.f;
+  }
+}
+#endif // CS_INITIATOR_DISTANCE_FILTER
+
+#if CS_INITIATOR_OUTPUT_POLICY
+/******************************************************************************
+ * Output the latest result of an instance as far as its output policy asks.
+ * Results without a distance are not output.
+ *****************************************************************************/
+static void apply_output_policy(uint8_t instance_num)
+{
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  float distance = instance->measurement_mainmode.distance_filtered;
+  uint8_t previous_zone = OUTPUT_POLICY_ZONE_UNKNOWN;
+
+  if (isnan(distance)) {
+    return;
+  }
+  uint8_t events = output_policy_update(&instance->output_policy,
+                                        distance_to_mm(distance),
+                                        instance->timestamp_ms,
+                                        &previous_zone);
+  if (events & OUTPUT_POLICY_EVENT_ZONE) {
+    output_zone(instance_num, previous_zone);
+  }
+  if (events & OUTPUT_POLICY_EVENT_DISTANCE) {
+    output_measurement(instance_num);
+  }
+}
+
+/******************************************************************************
+ * Write a zone change to the output in the configured format
+ *****************************************************************************/
+static void output_zone(uint8_t instance_num, uint8_t previous_zone)
+{
+  const cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+#if (CS_INITIATOR_OUTPUT_FORMAT == CS_INITIATOR_OUTPUT_FORMAT_BINARY)
+  uint8_t frame[OUTPUT_FRAME_MAX_LEN];
+  output_frame_zone_t zone = {
+    .tag_index = instance_num,
+    .timestamp_ms = instance->timestamp_ms,
+    .zone = instance->output_policy.zone,
+    .previous_zone = previous_zone,
+    .distance_mm = distance_to_mm(instance->measurement_mainmode.distance_filtered)
+  };
+  size_t frame_len = output_frame_encode_zone(&zone, frame);
+  (void)sl_iostream_write(sl_iostream_recommended_console_stream, frame, frame_len);
+#else
+  const bd_addr *bt_address = ble_peer_manager_get_bt_address(instance->conn_handle);
+  log_output("{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"zone\": %u, \"previous_zone\": %u}\r\n",
+             bt_address->addr[5],
+             bt_address->addr[4],
+             bt_address->addr[3],
+             bt_address->addr[2],
+             bt_address->addr[1],
+             bt_address->addr[0],
+             instance->output_policy.zone,
+             previous_zone);
+#endif // CS_INITIATOR_OUTPUT_FORMAT
+}
+
+/******************************************************************************
+ * Set the output policy of new tags from app_config.h
+ *****************************************************************************/
+static void init_output_policy_config(void)
+{
+  const uint32_t zone_list[OUTPUT_POLICY_MAX_ZONES] = CS_INITIATOR_OUTPUT_ZONE_LIST;
+
+  output_policy_config.deadband_mm = CS_INITIATOR_OUTPUT_DEADBAND_MM;
+  output_policy_config.heartbeat_ms = CS_INITIATOR_OUTPUT_HEARTBEAT_MS;
+  output_policy_config.hysteresis_mm = CS_INITIATOR_OUTPUT_ZONE_HYSTERESIS_MM;
+  output_policy_config.zone_count = 0u;
+  while (output_policy_config.zone_count < OUTPUT_POLICY_MAX_ZONES
+         && zone_list[output_policy_config.zone_count] != 0u) {
+    output_policy_config.zone_mm[output_policy_config.zone_count] =
+      zone_list[output_policy_config.zone_count];
+    output_policy_config.zone_count++;
+  }
+  app_assert(output_policy_check_config(&output_policy_config),
+             APP_PREFIX "CS_INITIATOR_OUTPUT_ZONE_LIST must ascend!" NL);
+}
+
+#if defined(SL_CATALOG_CS_INITIATOR_CLI_PRESENT)
+/******************************************************************************
+ * CLI command: output_policy <tag> <deadband> <heartbeat> <hysteresis> [zones]
+ * Tag 255 changes every connected tag and the tags connecting later.
+ *****************************************************************************/
+static void cli_output_policy(sl_cli_command_arg_t *arguments)
+{
+  output_policy_config_t config;
+  uint8_t tag = sl_cli_get_argument_uint8(arguments, 0);
+  int argument_count = sl_cli_get_argument_count(arguments);
+
+  config.deadband_mm = sl_cli_get_argument_uint32(arguments, 1);
+  config.heartbeat_ms = sl_cli_get_argument_uint32(arguments, 2);
+  config.hysteresis_mm = sl_cli_get_argument_uint32(arguments, 3);
+  config.zone_count = 0u;
+  for (int n = 4; n < argument_count; n++) {
+    if (config.zone_count == OUTPUT_POLICY_MAX_ZONES) {
+      log_error(APP_PREFIX "At most %u zone boundaries" NL, OUTPUT_POLICY_MAX_ZONES);
+      return;
+    }
+    config.zone_mm[config.zone_count++] = sl_cli_get_argument_uint32(arguments, n);
+  }
+  if (!output_policy_check_config(&config)) {
+    log_error(APP_PREFIX "Zone boundaries must ascend" NL);
+    return;
+  }
+  if (tag == UINT8_MAX) {
+    output_policy_config = config;
+    for (uint8_t i = 0u; i < max_instances; i++) {
+      output_policy_set_config(&cs_initiator_instances[i].output_policy, &config);
+    }
+  } else if (tag < max_instances) {
+    output_policy_set_config(&cs_initiator_instances[tag].output_policy, &config);
+  } else {
+    log_error(APP_PREFIX "No tag %u" NL, tag);
+    return;
+  }
+  log_info(APP_PREFIX "Output policy of tag %u: deadband %lu mm, heartbeat %lu ms, "
+                      "%u zone boundaries, hysteresis %lu mm" NL,
+           tag,
+           (unsigned long)config.deadband_mm,
+           (unsigned long)config.heartbeat_ms,
+           config.zone_count,
+           (unsigned long)config.hysteresis_mm);
+}
+#endif // SL_CATALOG_CS_INITIATOR_CLI_PRESENT
+#endif // CS_INITIATOR_OUTPUT_POLICY
+
 /******************************************************************************
  * Return runtime configurable value for object tracking mode
  *****************************************************************************/
@@ -450,13 +1278,11 @@ static const char *algo_mode_to_str(uint8_t algo_mode)
  *****************************************************************************/
 static sl_status_t get_instance_number(uint8_t conn_handle, uint8_t *instance_num)
 {
-  for (uint8_t i = 0u; i < CS_INITIATOR_MAX_CONNECTIONS; i++) {
-    if (cs_initiator_instances[i].conn_handle == conn_handle) {
-      *instance_num = i;
-      return SL_STATUS_OK;
-    }
+  if (instance_by_conn_handle[conn_handle] == INSTANCE_NUM_INVALID) {
+    return SL_STATUS_FAIL;
   }
-  return SL_STATUS_FAIL;
+  *instance_num = instance_by_conn_handle[conn_handle];
+  return SL_STATUS_OK;
 }
 
 /******************************************************************************
@@ -473,126 +1299,91 @@ static void cs_on_result(const uint8_t conn_handle,
   (void)user_data;
   uint8_t initiator_num;
 
+  PROFILER_BEGIN(PROFILER_PROBE_CS_ON_RESULT);
   if (result != NULL) {
     sl_status_t sc = get_instance_number(conn_handle, &initiator_num);
     if (sc != SL_STATUS_OK) {
       log_error(APP_INSTANCE_PREFIX "Failed to get instance number for connection! [sc: 0x%lx]" NL,
                 conn_handle,
                 sc);
+      PROFILER_END(PROFILER_PROBE_CS_ON_RESULT);
       return;
     }
 
-    sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                 CS_RESULT_FIELD_DISTANCE_MAINMODE,
-                                 (uint8_t *)result,
-                                 (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.distance_filtered);
-    if (sc != SL_STATUS_OK) {
-      log_error(APP_INSTANCE_PREFIX "Failed to extract distance! [sc: 0x%lx]" NL,
-                conn_handle,
-                sc);
-    }
+    const cs_initiator_config_t *config = &cs_initiator_instances[initiator_num].config;
+    uint32_t field_mask = CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_MAINMODE)
+                          | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE)
+                          | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_LIKELINESS_MAINMODE)
+                          | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RSSI);
 
-    if (initiator_config.cs_sub_mode != sl_bt_cs_submode_disabled) {
-      sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                   CS_RESULT_FIELD_DISTANCE_SUBMODE,
-                                   (uint8_t *)result,
-                                   (uint8_t *)&cs_initiator_instances[initiator_num].measurement_submode.distance_filtered);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to extract sub mode distance! [sc: 0x%lx]" NL,
-                  conn_handle,
-                  sc);
-      }
+    if (config->cs_sub_mode != sl_bt_cs_submode_disabled) {
+      field_mask |= CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_SUBMODE)
+                    | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE)
+                    | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_LIKELINESS_SUBMODE);
     }
 
-    sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                 CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE,
-                                 (uint8_t *)result,
-                                 (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.distance_raw);
-    if (sc != SL_STATUS_OK) {
-      log_error(APP_INSTANCE_PREFIX "Failed to extract RAW distance! [sc: 0x%lx]" NL,
-                conn_handle,
-                sc);
+    if (cs_initiator_instances[initiator_num].rtl_config.algo_mode == SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST
+        && config->cs_main_mode == sl_bt_cs_mode_pbr
+        && (config->channel_map_preset == CS_CHANNEL_MAP_PRESET_HIGH
+            || config->channel_map_preset == CS_CHANNEL_MAP_PRESET_MEDIUM)) {
+      field_mask |= CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_VELOCITY_MAINMODE);
     }
 
-    if (initiator_config.cs_sub_mode != sl_bt_cs_submode_disabled) {
-      sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                   CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE,
-                                   (uint8_t *)result,
-                                   (uint8_t *)&cs_initiator_instances[initiator_num].measurement_submode.distance_raw);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to extract sub mode RAW distance! [sc: 0x%lx]" NL,
-                  conn_handle,
-                  sc);
-      }
+    // BER is only for RTT
+    if (config->cs_main_mode == sl_bt_cs_mode_rtt) {
+      field_mask |= CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_BIT_ERROR_RATE);
     }
 
-    sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                 CS_RESULT_FIELD_LIKELINESS_MAINMODE,
-                                 (uint8_t *)result,
-                                 (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.likeliness);
-    if (sc != SL_STATUS_OK) {
-      log_error(APP_INSTANCE_PREFIX "Failed to extract likeliness! [sc: 0x%lx]" NL,
-                conn_handle,
-                sc);
+    cs_initiator_instances[initiator_num].measurement_cnt++;
+    cs_recovery_on_result(&cs_initiator_instances[initiator_num].recovery);
+#if APP_MILESTONES
+    if (milestone_mark(&milestones, conn_handle, MILESTONE_FIRST_RESULT, get_time_ms())) {
+      log_milestones(conn_handle);
     }
-
-    if (initiator_config.cs_sub_mode != sl_bt_cs_submode_disabled) {
-      sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                   CS_RESULT_FIELD_LIKELINESS_SUBMODE,
-                                   (uint8_t *)result,
-                                   (uint8_t *)&cs_initiator_instances[initiator_num].measurement_submode.likeliness);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to extract sub mode likeliness! [sc: 0x%lx]" NL,
-                  conn_handle,
-                  sc);
-      }
+#endif // APP_MILESTONES
+    uint32_t elapsed_ms;
+    if (connection_timing_stop(conn_handle, &elapsed_ms)) {
+      log_info(APP_INSTANCE_PREFIX "Time to first distance: %lu ms%s" NL,
+               conn_handle,
+               (unsigned long)elapsed_ms,
+               cs_initiator_instances[initiator_num].fast_reconnect ? " (reconnect cache hit)" : "");
     }
-
-    if (rtl_config.algo_mode == SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST
-        && initiator_config.cs_main_mode == sl_bt_cs_mode_pbr
-        && (initiator_config.channel_map_preset == CS_CHANNEL_MAP_PRESET_HIGH
-            || initiator_config.channel_map_preset == CS_CHANNEL_MAP_PRESET_MEDIUM)) {
-      sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                   CS_RESULT_FIELD_VELOCITY_MAINMODE,
-                                   (uint8_t *)result,
-                                   (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.velocity);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to extract velocity! [sc: 0x%lx]" NL,
-                  conn_handle,
-                  sc);
-      }
+#if CS_INITIATOR_TAG_ROTATION
+    if (cs_initiator_instances[initiator_num].measurement_cnt == CS_INITIATOR_TAG_ROTATION_PROCEDURES) {
+      // Visit complete, free the connection for the next tag
+      (void)ble_peer_manager_central_close_connection(conn_handle);
     }
-
-    // BER is only for RTT
-    if (initiator_config.cs_main_mode == sl_bt_cs_mode_rtt) {
-      sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                   CS_RESULT_FIELD_BIT_ERROR_RATE,
-                                   (uint8_t *)result,
-                                   (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.bit_error_rate);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to extract BER! [sc: 0x%lx]" NL,
-                  conn_handle,
-                  sc);
-      }
+#endif // CS_INITIATOR_TAG_ROTATION
+    // The result is dropped and counted if the main loop fell behind
+    cs_result_queue_entry_t *entry = cs_result_queue_reserve(&cs_initiator_instances[initiator_num].result_queue);
+    if (entry == NULL) {
+      PROFILER_END(PROFILER_PROBE_CS_ON_RESULT);
+      return;
     }
-
-    // Extract RSSI distance always
-    sc = cs_result_extract_field((cs_result_session_data_t *)result_data,
-                                 CS_RESULT_FIELD_DISTANCE_RSSI,
-                                 (uint8_t *)result,
-                                 (uint8_t *)&cs_initiator_instances[initiator_num].measurement_mainmode.distance_estimate_rssi);
+    memset(&entry->mainmode, 0u, sizeof(cs_measurement_data_t));
+    memset(&entry->submode, 0u, sizeof(cs_measurement_data_t));
+
+    uint32_t missing_mask;
+    sc = cs_result_decode(result_data,
+                          result,
+                          field_mask,
+                          &entry->mainmode,
+                          &entry->submode,
+                          &missing_mask);
     if (sc != SL_STATUS_OK) {
-      log_error(APP_INSTANCE_PREFIX "Failed to extract RSSI distance! [sc: 0x%lx]" NL,
+      log_error(APP_INSTANCE_PREFIX "Failed to extract result fields! [missing: 0x%lx]" NL,
                 conn_handle,
-                sc);
+                (unsigned long)missing_mask);
     }
-    cs_initiator_instances[initiator_num].measurement_arrived = true;
-    cs_initiator_instances[initiator_num].measurement_cnt++;
-    cs_initiator_instances[initiator_num].ranging_counter = ranging_counter;
+    entry->conn_handle = conn_handle;
+    entry->ranging_counter = ranging_counter;
+    entry->timestamp_ms = get_time_ms();
+    cs_result_queue_commit(&cs_initiator_instances[initiator_num].result_queue);
   } else {
     log_error(APP_INSTANCE_PREFIX "Null result reference!" NL,
               conn_handle);
   }
+  PROFILER_END(PROFILER_PROBE_CS_ON_RESULT);
 }
 
 /******************************************************************************
@@ -651,45 +1442,73 @@ static void check_cli_values(void)
 
 /******************************************************************************
  * Create new initiator instance
+ * @param[in] conn_handle Connection handle.
+ * @param[in] config Initiator configuration of the instance.
+ * @param[in] instance_rtl_config RTL configuration of the instance.
+ * @return SL_STATUS_OK if created. Otherwise the caller closes the connection.
  *****************************************************************************/
-static sl_status_t create_new_initiator_instance(uint8_t conn_handle)
+static sl_status_t create_new_initiator_instance(uint8_t conn_handle,
+                                                 const cs_initiator_config_t *config,
+                                                 const rtl_config_t *instance_rtl_config)
 {
   sl_status_t sc;
   cs_intermediate_result_t measurement_progress;
   // Check if we can accept one more reflector connection
-  if (num_reflector_connections >= CS_INITIATOR_MAX_CONNECTIONS) {
+  if (num_reflector_connections >= max_instances || free_instance_count == 0u) {
     log_error(APP_PREFIX "Maximum number of initiator instances (%u) reached, "
                          "dropping connection..." NL,
-              CS_INITIATOR_MAX_CONNECTIONS);
+              max_instances);
     return SL_STATUS_FULL;
   }
   // Store the new initiator instance
-  for (uint32_t i = 0u; i < CS_INITIATOR_MAX_CONNECTIONS; i++) {
-    if (cs_initiator_instances[i].conn_handle == SL_BT_INVALID_CONNECTION_HANDLE) {
-      cs_initiator_instances[i].conn_handle = conn_handle;
-      cs_initiator_instances[i].measurement_cnt = 0u;
-      memset(&cs_initiator_instances[i].measurement_mainmode, 0u, sizeof(cs_measurement_data_t));
-      memset(&cs_initiator_instances[i].measurement_submode, 0u, sizeof(cs_measurement_data_t));
-      memset(&cs_initiator_instances[i].measurement_progress, 0u, sizeof(measurement_progress));
-      num_reflector_connections++;
-      break;
-    }
-  }
+  uint8_t i = free_instances[--free_instance_count];
+  instance_by_conn_handle[conn_handle] = i;
+  cs_initiator_instances[i].conn_handle = conn_handle;
+  cs_initiator_instances[i].measurement_cnt = 0u;
+  memset(&cs_initiator_instances[i].measurement_mainmode, 0u, sizeof(cs_measurement_data_t));
+  memset(&cs_initiator_instances[i].measurement_submode, 0u, sizeof(cs_measurement_data_t));
+  memset(&cs_initiator_instances[i].measurement_progress, 0u, sizeof(measurement_progress));
+  cs_initiator_instances[i].config = *config;
+  cs_initiator_instances[i].rtl_config = *instance_rtl_config;
+#if CS_INITIATOR_AUTO_ALGO_MODE
+  // A new tag is taken as moving
+  cs_initiator_instances[i].rtl_config.algo_mode = SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST;
+#endif // CS_INITIATOR_AUTO_ALGO_MODE
+  cs_initiator_instances[i].recovery_pending = false;
+  cs_recovery_instance_init(&cs_initiator_instances[i].recovery);
+  num_reflector_connections++;
+  output_tag(i, ble_peer_manager_get_bt_address(conn_handle));
+#if CS_INITIATOR_OUTPUT_POLICY
+  output_policy_init(&cs_initiator_instances[i].output_policy, &output_policy_config);
+#endif // CS_INITIATOR_OUTPUT_POLICY
+#if CS_INITIATOR_DISTANCE_FILTER
+  distance_filter_init(&cs_initiator_instances[i].distance_filter);
+  distance_filter_init(&cs_initiator_instances[i].rssi_filter);
+#endif // CS_INITIATOR_DISTANCE_FILTER
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+  cs_initiator_instances[i].priority = get_instance_priority(conn_handle);
+  cs_initiator_instances[i].base_procedure_interval = config->max_procedure_interval;
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
 
   sc = cs_initiator_create(conn_handle,
-                           &initiator_config,
-                           &rtl_config,
+                           &cs_initiator_instances[i].config,
+                           &cs_initiator_instances[i].rtl_config,
                            cs_on_result,
                            cs_on_intermediate_result,
                            cs_on_error,
                            NULL);
   if (sc != SL_STATUS_OK) {
-    log_error(APP_INSTANCE_PREFIX "Failed to create initiator instance, "
-                                  "error:0x%lx" NL,
-              conn_handle,
-              sc);
-    (void)ble_peer_manager_central_close_connection(conn_handle);
+    return sc;
+  }
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+  // Make room for the new tag. The new instance has been created with its
+  // base interval, so recreate it if the schedule gives it another one.
+  schedule_procedures();
+  if (cs_initiator_instances[i].config.max_procedure_interval
+      != cs_initiator_instances[i].base_procedure_interval) {
+    restart_initiator(i);
   }
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
   return sc;
 }
 
@@ -698,37 +1517,708 @@ static sl_status_t create_new_initiator_instance(uint8_t conn_handle)
  *****************************************************************************/
 static void delete_initiator_instance(uint8_t conn_handle)
 {
-  for (uint32_t i = 0u; i < CS_INITIATOR_MAX_CONNECTIONS; i++) {
-    if (cs_initiator_instances[i].conn_handle == conn_handle) {
-      cs_initiator_instances[i].conn_handle = SL_BT_INVALID_CONNECTION_HANDLE;
-      cs_initiator_instances[i].measurement_cnt = 0u;
-      memset(&cs_initiator_instances[i].measurement_mainmode, 0u, sizeof(cs_measurement_data_t));
-      memset(&cs_initiator_instances[i].measurement_submode, 0u, sizeof(cs_measurement_data_t));
-      memset(&cs_initiator_instances[i].measurement_progress, 0u, sizeof(cs_intermediate_result_t));
-      cs_initiator_instances[i].measurement_arrived = false;
-      cs_initiator_instances[i].measurement_progress_changed = false;
-      cs_initiator_instances[i].read_remote_capabilities = false;
-      num_reflector_connections--;
+  uint8_t i = instance_by_conn_handle[conn_handle];
+  if (i == INSTANCE_NUM_INVALID) {
+    return;
+  }
+  instance_by_conn_handle[conn_handle] = INSTANCE_NUM_INVALID;
+  cs_initiator_instances[i].conn_handle = SL_BT_INVALID_CONNECTION_HANDLE;
+  cs_initiator_instances[i].measurement_cnt = 0u;
+  memset(&cs_initiator_instances[i].measurement_mainmode, 0u, sizeof(cs_measurement_data_t));
+  memset(&cs_initiator_instances[i].measurement_submode, 0u, sizeof(cs_measurement_data_t));
+  memset(&cs_initiator_instances[i].measurement_progress, 0u, sizeof(cs_intermediate_result_t));
+  cs_initiator_instances[i].measurement_progress_changed = false;
+  cs_initiator_instances[i].read_remote_capabilities = false;
+  cs_initiator_instances[i].fast_reconnect = false;
+  if (cs_initiator_instances[i].recovery_pending) {
+    (void)app_timer_stop(&cs_initiator_instances[i].recovery_timer);
+    cs_initiator_instances[i].recovery_pending = false;
+  }
+  free_instances[free_instance_count++] = i;
+  num_reflector_connections--;
+  output_tag(i, NULL);
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+  // Give the airtime of the tag to the others
+  schedule_procedures();
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
+}
+
+/******************************************************************************
+ * Get the initiator configuration of a new instance: the default
+ * configuration with the settings of the matching profile, if any.
+ * @param[in]  connection Connection handle.
+ * @param[out] config Initiator configuration of the instance.
+ * @param[out] instance_rtl_config RTL configuration of the instance.
+ *****************************************************************************/
+static void get_instance_config(uint8_t connection,
+                                cs_initiator_config_t *config,
+                                rtl_config_t *instance_rtl_config)
+{
+  *config = initiator_config;
+  *instance_rtl_config = rtl_config;
+#if CS_INITIATOR_PROFILES
+  uint8_t profile_index;
+  const bd_addr *address = ble_peer_manager_get_bt_address(connection);
+  const initiator_profile_t *profile = (address != NULL)
+                                       ? initiator_profile_find(address, &profile_index)
+                                       : NULL;
+  if (profile == NULL) {
+    return;
+  }
+  log_info(APP_INSTANCE_PREFIX "Using configuration profile %u" NL, connection, profile_index);
+  if (profile->procedure_interval != 0u) {
+    // A fixed interval replaces the optimization
+    config->procedure_scheduling = CS_PROCEDURE_SCHEDULING_CUSTOM;
+    config->min_procedure_interval = profile->procedure_interval;
+    config->max_procedure_interval = profile->procedure_interval;
+  }
+  if (profile->channel_map_preset != INITIATOR_PROFILE_KEEP) {
+    config->channel_map_preset = profile->channel_map_preset;
+    cs_initiator_apply_channel_map_preset(config->channel_map_preset, config->channel_map.data);
+  }
+  if (profile->algo_mode != INITIATOR_PROFILE_KEEP) {
+    instance_rtl_config->algo_mode = profile->algo_mode;
+  }
+#else
+  (void)connection;
+#endif // CS_INITIATOR_PROFILES
+}
+
+/******************************************************************************
+ * Get the size of the ranging data of one procedure
+ * @param[in] config Initiator configuration.
+ * @param[in] remote_num_antennas Number of antennas of the reflector, 0 if
+ *                                not known yet.
+ * @return Size in bytes.
+ *****************************************************************************/
+static uint32_t get_ranging_data_size(const cs_initiator_config_t *config,
+                                      uint8_t remote_num_antennas)
+{
+  ranging_data_size_config_t size_config = {
+    .channel_map = config->channel_map.data,
+    .channel_map_repetition = config->channel_map_repetition,
+    .mode0_steps = config->mode0_step,
+    .main_mode = config->cs_main_mode,
+    .sub_mode = (config->cs_sub_mode != sl_bt_cs_submode_disabled),
+    .main_mode_steps = config->min_main_mode_steps,
+    .antenna_paths = ranging_data_size_get_antenna_paths(config->cs_tone_antenna_config_idx_req)
+  };
+  // The antennas of both devices limit the paths
+  uint32_t paths = (uint32_t)config->num_antennas * remote_num_antennas;
+  if (remote_num_antennas != 0u && paths != 0u && paths < size_config.antenna_paths) {
+    size_config.antenna_paths = (uint8_t)paths;
+  }
+  return ranging_data_size_get(&size_config, RANGING_DATA_SIZE_INITIATOR);
+}
+
+/******************************************************************************
+ * Create the initiator instance of a connection once the remote capabilities
+ * are known and restart scanning if there is room for more reflectors.
+ * @param[in] connection Connection handle.
+ * @param[in] config Initiator configuration of the instance, see
+ *                   get_instance_config().
+ * @param[in] instance_rtl_config RTL configuration of the instance.
+ * @param[in] remote_num_antennas Number of antennas of the reflector.
+ * @param[in] cached_intervals The intervals of config have been restored
+ *                             from the reconnect cache.
+ *****************************************************************************/
+static void start_initiator(uint8_t connection,
+                            cs_initiator_config_t *config,
+                            const rtl_config_t *instance_rtl_config,
+                            uint8_t remote_num_antennas,
+                            bool cached_intervals)
+{
+  sl_status_t sc;
+  uint8_t instance_num;
+  uint16_t proc_interval;
+  uint16_t conn_interval;
+  sc = sl_bt_cs_read_local_supported_capabilities(NULL,
+                                                  NULL,
+                                                  &config->num_antennas,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL,
+                                                  NULL);
+  app_assert_status(sc);
+  if (config->max_procedure_count == 0) {
+    if (cached_intervals) {
+      log_info(APP_INSTANCE_PREFIX "Using cached connection interval and procedure interval." NL, connection);
+    } else {
+      sc = cs_initiator_get_intervals(config->cs_main_mode,
+                                      config->cs_sub_mode,
+                                      config->procedure_scheduling,
+                                      config->channel_map_preset,
+                                      instance_rtl_config->algo_mode,
+                                      config->cs_tone_antenna_config_idx,
+                                      config->use_real_time_ras_mode,
+                                      &conn_interval,
+                                      &proc_interval);
+      if (sc == SL_STATUS_NOT_SUPPORTED) {
+        log_info(APP_INSTANCE_PREFIX "Parameter optimization is not supported with the given input parameters" NL, connection);
+      } else if (sc == SL_STATUS_IDLE) {
+        log_info(APP_PREFIX "No optimization - using custom procedure scheduling" NL);
+      } else if (sc == SL_STATUS_OK) {
+        config->max_connection_interval = config->min_connection_interval = conn_interval;
+        config->max_procedure_interval = config->min_procedure_interval = proc_interval;
+        log_info(APP_INSTANCE_PREFIX "Optimized parameters for connection interval and procedure interval." NL, connection);
+      } else {
+        log_error(APP_INSTANCE_PREFIX "Invalid input, cannot optimize parameters." NL, connection);
+      }
+    }
+    float period_ms = config->max_connection_interval * 1.25f * config->max_procedure_interval;
+    log_info(APP_INSTANCE_PREFIX "Connection interval: %u  Procedure interval: %u  Period: %d ms  Frequency: %u.%03u Hz" NL,
+             connection,
+             config->max_connection_interval,
+             config->max_procedure_interval,
+             (int)period_ms,
+             (uint16_t)(1000.0f / period_ms),
+             (((uint16_t)(1000000.0f / period_ms)) % 1000));
+    // put remote antenna num into cs_tone_antenna_config_idx
+    config->cs_tone_antenna_config_idx = remote_num_antennas;
+  }
+  // A procedure larger than the ranging data buffers would be cut short
+  uint32_t ranging_data_size = get_ranging_data_size(config, remote_num_antennas);
+  if (ranging_data_size > CS_INITIATOR_MAX_RANGING_DATA_SIZE) {
+    log_error(APP_INSTANCE_PREFIX "Ranging data size %lu exceeds CS_INITIATOR_MAX_RANGING_DATA_SIZE (%u), "
+                                  "closing connection" NL,
+              connection,
+              (unsigned long)ranging_data_size,
+              CS_INITIATOR_MAX_RANGING_DATA_SIZE);
+    (void)ble_peer_manager_central_close_connection(connection);
+    return;
+  }
+  log_info(APP_INSTANCE_PREFIX "Ranging data size: %lu bytes" NL,
+           connection,
+           (unsigned long)ranging_data_size);
+  sc = create_new_initiator_instance(connection, config, instance_rtl_config);
+  if (sc != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to create initiator instance, "
+                                  "error:0x%lx" NL,
+              connection,
+              sc);
+#if CS_INITIATOR_RECONNECT_CACHE
+    if (cached_intervals) {
+      const bd_addr *address = ble_peer_manager_get_bt_address(connection);
+      if (address != NULL) {
+        reconnect_cache_remove(address);
+      }
+    }
+#endif // CS_INITIATOR_RECONNECT_CACHE
+    // The only close request of the connection. Scanning restarts once it
+    // is closed.
+    (void)ble_peer_manager_central_close_connection(connection);
+    return;
+  }
+  log_info(APP_INSTANCE_PREFIX "New initiator instance created" NL,
+           connection);
+#if CS_INITIATOR_RECONNECT_CACHE
+  if (!cached_intervals) {
+    store_reconnect_cache(connection, config, instance_rtl_config, remote_num_antennas);
+  }
+#endif // CS_INITIATOR_RECONNECT_CACHE
+  sc = get_instance_number(connection, &instance_num);
+  if (sc != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to get instance number for connection" NL,
+              connection);
+    return;
+  }
+  cs_initiator_instances[instance_num].read_remote_capabilities = true;
+  cs_initiator_instances[instance_num].fast_reconnect = cached_intervals;
+  motion_init(&cs_initiator_instances[instance_num].motion);
+  interval_control_init(&cs_initiator_instances[instance_num].interval_control,
+                        cs_initiator_instances[instance_num].config.max_procedure_interval);
+  algo_switch_init(&cs_initiator_instances[instance_num].algo_switch);
+  cs_initiator_instances[instance_num].motion_restarts = 0u;
+  // Scan for new reflector connections if we have room for more
+  if (num_reflector_connections < max_instances) {
+    sc = start_scanning();
+    app_assert_status(sc);
+    cs_initiator_display_start_scanning();
+    log_info(APP_PREFIX "Scanning restarted for new reflector connections..." NL);
+  }
+}
+
+/******************************************************************************
+ * Recover an initiator instance from a failed CS procedure. Only the instance
+ * of the affected connection is recreated, the other connections keep ranging.
+ *****************************************************************************/
+static void recover_initiator_instance(uint8_t conn_handle, cs_error_event_t err_evt, sl_status_t sc)
+{
+  sl_status_t status;
+  uint8_t instance_num;
+  uint32_t delay_ms = 0u;
+  cs_recovery_reason_t reason = (err_evt == CS_ERROR_EVENT_CS_PROCEDURE_STOP_TIMER_FAILED)
+                                ? CS_RECOVERY_REASON_STOP_TIMER_FAILED
+                                : CS_RECOVERY_REASON_UNEXPECTED_DATA;
+
+  status = get_instance_number(conn_handle, &instance_num);
+  if (status != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to get instance number for connection! [sc: 0x%lx]" NL,
+              conn_handle,
+              status);
+    return;
+  }
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  // Errors of the failed procedure may keep coming until the instance is recreated
+  if (instance->recovery_pending) {
+    return;
+  }
+
+  switch (cs_recovery_on_error(&instance->recovery, reason, get_time_ms(), &delay_ms)) {
+    case CS_RECOVERY_ACTION_RESTART:
+      log_error(APP_INSTANCE_PREFIX "CS procedure error: %s (%lu so far)! "
+                                    "Recreating initiator instance in %lu ms."
+                                    "[E: 0x%x sc: 0x%lx]" NL,
+                conn_handle,
+                cs_recovery_get_reason_name(reason),
+                (unsigned long)cs_recovery_get_count(reason),
+                (unsigned long)delay_ms,
+                err_evt,
+                (unsigned long)sc);
+      // The instance must not be deleted from within its own callback
+      status = app_timer_start(&instance->recovery_timer,
+                               delay_ms,
+                               recovery_timer_callback,
+                               (void *)(uintptr_t)instance_num,
+                               false);
+      if (status == SL_STATUS_OK) {
+        instance->recovery_pending = true;
+      } else {
+        log_error(APP_INSTANCE_PREFIX "Failed to start recovery timer! Closing connection."
+                                      "[sc: 0x%lx]" NL,
+                  conn_handle,
+                  (unsigned long)status);
+        (void)ble_peer_manager_central_close_connection(conn_handle);
+      }
       break;
+
+    case CS_RECOVERY_ACTION_DISCONNECT:
+      log_error(APP_INSTANCE_PREFIX "CS procedure error: %s! No result after %u retries, "
+                                    "closing connection."
+                                    "[E: 0x%x sc: 0x%lx]" NL,
+                conn_handle,
+                cs_recovery_get_reason_name(reason),
+                CS_INITIATOR_RECOVERY_MAX_ATTEMPTS,
+                err_evt,
+                (unsigned long)sc);
+      (void)ble_peer_manager_central_close_connection(conn_handle);
+      break;
+
+    case CS_RECOVERY_ACTION_RESET:
+    default:
+      app_assert(false,
+                 APP_INSTANCE_PREFIX "CS procedure error budget exhausted!"
+                                     "[E: 0x%x sc: 0x%lx]" NL,
+                 conn_handle,
+                 err_evt,
+                 (unsigned long)sc);
+      break;
+  }
+}
+
+/******************************************************************************
+ * Recovery timer callback
+ *****************************************************************************/
+static void recovery_timer_callback(app_timer_t *timer, void *data)
+{
+  (void)timer;
+  restart_initiator((uint8_t)(uintptr_t)data);
+}
+
+/******************************************************************************
+ * Delete and create the initiator instance of a connection again
+ * @param[in] instance_num Instance number.
+ *****************************************************************************/
+static void restart_initiator(uint8_t instance_num)
+{
+  sl_status_t sc;
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+  uint8_t conn_handle = instance->conn_handle;
+
+  instance->recovery_pending = false;
+  if (conn_handle == SL_BT_INVALID_CONNECTION_HANDLE) {
+    return;
+  }
+  sc = cs_initiator_delete(conn_handle);
+  if (sc != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to delete initiator instance! [sc: 0x%lx]" NL,
+              conn_handle,
+              (unsigned long)sc);
+  }
+  sc = cs_initiator_create(conn_handle,
+                           &instance->config,
+                           &instance->rtl_config,
+                           cs_on_result,
+                           cs_on_intermediate_result,
+                           cs_on_error,
+                           NULL);
+  if (sc != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to recreate initiator instance! Closing connection."
+                                  "[sc: 0x%lx]" NL,
+              conn_handle,
+              (unsigned long)sc);
+    (void)ble_peer_manager_central_close_connection(conn_handle);
+    return;
+  }
+  log_info(APP_INSTANCE_PREFIX "Initiator instance recreated" NL, conn_handle);
+}
+
+#if MOTION_CONTROL
+/******************************************************************************
+ * Recreate the initiator instance with the procedure interval and algorithm
+ * mode chosen for the movement of the tag
+ * @param[in] instance_num Instance number.
+ *****************************************************************************/
+static void apply_motion_control(uint8_t instance_num)
+{
+  cs_initiator_instances_t *instance = &cs_initiator_instances[instance_num];
+
+  instance->motion_restarts++;
+#if CS_INITIATOR_ADAPTIVE_INTERVAL
+  uint16_t procedure_interval = interval_control_get_interval(&instance->interval_control);
+  uint32_t rate_mhz = interval_control_get_rate_mhz(&instance->interval_control,
+                                                    instance->config.max_connection_interval);
+  instance->config.min_procedure_interval = procedure_interval;
+  instance->config.max_procedure_interval = procedure_interval;
+  log_info(APP_INSTANCE_PREFIX "Procedure interval: %u  Frequency: %lu.%03lu Hz  Restarts: %lu" NL,
+           instance->conn_handle,
+           procedure_interval,
+           (unsigned long)(rate_mhz / 1000u),
+           (unsigned long)(rate_mhz % 1000u),
+           (unsigned long)instance->motion_restarts);
+#endif // CS_INITIATOR_ADAPTIVE_INTERVAL
+#if CS_INITIATOR_AUTO_ALGO_MODE
+  uint8_t algo_mode = (algo_switch_get_mode(&instance->algo_switch) == ALGO_SWITCH_MODE_STATIC)
+                      ? SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY
+                      : SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST;
+  if (algo_mode != instance->rtl_config.algo_mode) {
+    instance->rtl_config.algo_mode = algo_mode;
+    log_info(APP_INSTANCE_PREFIX "Object tracking mode: %s (transition %lu)" NL,
+             instance->conn_handle,
+             algo_mode_to_str(algo_mode),
+             (unsigned long)algo_switch_get_transitions(&instance->algo_switch));
+  }
+#endif // CS_INITIATOR_AUTO_ALGO_MODE
+  // A pending recovery will apply the new settings
+  if (!instance->recovery_pending) {
+    restart_initiator(instance_num);
+  }
+}
+#endif // MOTION_CONTROL
+
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+/******************************************************************************
+ * Get the scheduling priority of a tag from its configuration profile
+ * @param[in] conn_handle Connection handle.
+ * @return Priority weight.
+ *****************************************************************************/
+static uint8_t get_instance_priority(uint8_t conn_handle)
+{
+#if CS_INITIATOR_PROFILES
+  uint8_t profile_index;
+  const bd_addr *address = ble_peer_manager_get_bt_address(conn_handle);
+  const initiator_profile_t *profile = (address != NULL)
+                                       ? initiator_profile_find(address, &profile_index)
+                                       : NULL;
+  if (profile != NULL && profile->priority != 0u) {
+    return profile->priority;
+  }
+#else
+  (void)conn_handle;
+#endif // CS_INITIATOR_PROFILES
+  return CS_INITIATOR_PRIORITY_DEFAULT;
+}
+
+/******************************************************************************
+ * Share the CS airtime among the connected tags by their priority and
+ * recreate the instances whose procedure interval changes. An instance that
+ * is still being set up only gets its configuration updated.
+ *****************************************************************************/
+static void schedule_procedures(void)
+{
+  priority_schedule_tag_t *tags = schedule_tags;
+  uint16_t *intervals = schedule_intervals;
+  uint8_t *instance_nums = schedule_instance_nums;
+  uint8_t count = 0u;
+
+  for (uint8_t i = 0u; i < max_instances; i++) {
+    if (cs_initiator_instances[i].conn_handle == SL_BT_INVALID_CONNECTION_HANDLE) {
+      continue;
+    }
+    tags[count].priority = cs_initiator_instances[i].priority;
+    tags[count].connection_interval = cs_initiator_instances[i].config.max_connection_interval;
+    tags[count].base_interval = cs_initiator_instances[i].base_procedure_interval;
+    instance_nums[count++] = i;
+  }
+  priority_schedule_compute(tags, count, intervals);
+
+  for (uint8_t n = 0u; n < count; n++) {
+    cs_initiator_instances_t *instance = &cs_initiator_instances[instance_nums[n]];
+    if (intervals[n] == instance->config.max_procedure_interval
+        && intervals[n] == instance->config.min_procedure_interval) {
+      continue;
+    }
+    instance->config.min_procedure_interval = intervals[n];
+    instance->config.max_procedure_interval = intervals[n];
+    log_info(APP_INSTANCE_PREFIX "Priority %u: procedure interval %u, airtime %lu permille" NL,
+             instance->conn_handle,
+             instance->priority,
+             intervals[n],
+             (unsigned long)priority_schedule_get_airtime_permille(tags[n].connection_interval,
+                                                                   intervals[n]));
+#if CS_INITIATOR_ADAPTIVE_INTERVAL
+    interval_control_init(&instance->interval_control, intervals[n]);
+#endif // CS_INITIATOR_ADAPTIVE_INTERVAL
+    // A pending recovery will apply the new interval
+    if (instance->read_remote_capabilities && !instance->recovery_pending) {
+      restart_initiator(instance_nums[n]);
     }
   }
 }
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
+
+#if APP_MILESTONES
+/******************************************************************************
+ * Log the milestones of a connection as one line
+ *****************************************************************************/
+static void log_milestones(uint8_t conn_handle)
+{
+  char record_str[MILESTONE_RECORD_STR_LEN];
+  const milestone_record_t *record = milestone_get(&milestones, conn_handle);
+  if (record != NULL) {
+    (void)milestone_format(record, record_str, sizeof(record_str));
+    log_info(APP_INSTANCE_PREFIX "Milestones [ms]: %s" NL, conn_handle, record_str);
+  }
+}
+#endif // APP_MILESTONES
+
+/******************************************************************************
+ * Remember when a connection has been opened
+ *****************************************************************************/
+static void connection_timing_start(uint8_t conn_handle)
+{
+  for (uint32_t i = 0u; i < CONNECTION_LIMIT; i++) {
+    if (connection_timing[i].conn_handle == SL_BT_INVALID_CONNECTION_HANDLE) {
+      connection_timing[i].conn_handle = conn_handle;
+      connection_timing[i].opened_ms = get_time_ms();
+      return;
+    }
+  }
+}
+
+/******************************************************************************
+ * Get the time since a connection has been opened and forget it
+ * @return true if the open time of the connection was known.
+ *****************************************************************************/
+static bool connection_timing_stop(uint8_t conn_handle, uint32_t *elapsed_ms)
+{
+  for (uint32_t i = 0u; i < CONNECTION_LIMIT; i++) {
+    if (connection_timing[i].conn_handle == conn_handle) {
+      connection_timing[i].conn_handle = SL_BT_INVALID_CONNECTION_HANDLE;
+      if (elapsed_ms != NULL) {
+        *elapsed_ms = get_time_ms() - connection_timing[i].opened_ms;
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+#if CS_INITIATOR_RECONNECT_CACHE
+/******************************************************************************
+ * Get a signature of the settings the optimized intervals depend on
+ *****************************************************************************/
+static uint32_t get_config_signature(const cs_initiator_config_t *config,
+                                     const rtl_config_t *instance_rtl_config)
+{
+  const uint8_t settings[] = {
+    config->cs_main_mode,
+    config->cs_sub_mode,
+    config->procedure_scheduling,
+    config->channel_map_preset,
+    config->cs_tone_antenna_config_idx_req,
+    config->use_real_time_ras_mode,
+    (uint8_t)config->max_procedure_count,
+    instance_rtl_config->algo_mode
+  };
+  // FNV-1a
+  uint32_t signature = 2166136261u;
+  for (uint32_t i = 0u; i < sizeof(settings); i++) {
+    signature = (signature ^ settings[i]) * 16777619u;
+  }
+  return signature;
+}
+
+/******************************************************************************
+ * Look up the cached parameters of a reflector. An entry of a bonded
+ * reflector whose bond is gone is dropped.
+ * @return true if usable parameters were found.
+ *****************************************************************************/
+static bool find_reconnect_cache(uint8_t connection,
+                                 const cs_initiator_config_t *config,
+                                 const rtl_config_t *instance_rtl_config,
+                                 reconnect_cache_entry_t *entry)
+{
+  uint8_t security_mode;
+  uint8_t key_size;
+  uint8_t bonding;
+  const bd_addr *address = ble_peer_manager_get_bt_address(connection);
+
+  if (address == NULL
+      || reconnect_cache_find(address,
+                              get_config_signature(config, instance_rtl_config),
+                              entry) != SL_STATUS_OK
+      || sl_bt_connection_get_security_status(connection,
+                                              &security_mode,
+                                              &key_size,
+                                              &bonding) != SL_STATUS_OK) {
+    return false;
+  }
+  if (entry->bonded && bonding == SL_BT_INVALID_BONDING_HANDLE) {
+    // The bond is gone, the reflector may have been replaced
+    log_info(APP_INSTANCE_PREFIX "Bonding lost, dropping cached parameters" NL, connection);
+    reconnect_cache_remove(address);
+    return false;
+  }
+  return true;
+}
+
+/******************************************************************************
+ * Read the capabilities of a known reflector right away. The CS initiator
+ * component raises the security level itself, so the security request of
+ * the first connection is skipped, and the instance is created with the
+ * cached intervals once the capabilities arrive.
+ * @return true if the reflector was found in the reconnect cache.
+ *****************************************************************************/
+static bool try_fast_reconnect(uint8_t connection)
+{
+  reconnect_cache_entry_t entry;
+  cs_initiator_config_t config;
+  rtl_config_t instance_rtl_config;
+
+  get_instance_config(connection, &config, &instance_rtl_config);
+  if (!find_reconnect_cache(connection, &config, &instance_rtl_config, &entry)) {
+    return false;
+  }
+  sl_status_t sc = sl_bt_cs_read_remote_supported_capabilities(connection);
+  app_assert_status(sc);
+  return true;
+}
+
+/******************************************************************************
+ * Take the cached intervals of a reflector for its new initiator instance.
+ * The entry is dropped if the antenna count of the reflector has changed.
+ * @return true if the cached intervals were applied.
+ *****************************************************************************/
+static bool apply_reconnect_cache(uint8_t connection,
+                                  uint8_t remote_num_antennas,
+                                  cs_initiator_config_t *config,
+                                  const rtl_config_t *instance_rtl_config)
+{
+  reconnect_cache_entry_t entry;
+
+  if (!find_reconnect_cache(connection, config, instance_rtl_config, &entry)) {
+    return false;
+  }
+  if (entry.remote_num_antennas != remote_num_antennas) {
+    log_info(APP_INSTANCE_PREFIX "Antenna count changed, dropping cached parameters" NL, connection);
+    reconnect_cache_remove(&entry.address);
+    return false;
+  }
+  config->max_connection_interval = config->min_connection_interval = entry.conn_interval;
+  config->max_procedure_interval = config->min_procedure_interval = entry.proc_interval;
+  return true;
+}
+
+/******************************************************************************
+ * Drop the cached parameters of a reflector whose instance, created with
+ * them, fails before its first result. The next connection takes the full
+ * setup again.
+ *****************************************************************************/
+static void drop_reconnect_cache(uint8_t conn_handle, cs_error_event_t err_evt)
+{
+  uint8_t instance_num;
+
+  switch (err_evt) {
+    // The procedures still run
+    case CS_ERROR_EVENT_RTL_PROCESS_ERROR:
+    case CS_ERROR_EVENT_RTL_ERROR:
+    case CS_ERROR_EVENT_INITIATOR_PBR_ANTENNA_USAGE_NOT_SUPPORTED:
+    case CS_ERROR_EVENT_INITIATOR_RTT_ANTENNA_USAGE_NOT_SUPPORTED:
+      return;
+    default:
+      break;
+  }
+  if (get_instance_number(conn_handle, &instance_num) != SL_STATUS_OK
+      || !cs_initiator_instances[instance_num].fast_reconnect
+      || cs_initiator_instances[instance_num].measurement_cnt > 0u) {
+    return;
+  }
+  const bd_addr *address = ble_peer_manager_get_bt_address(conn_handle);
+  if (address != NULL) {
+    log_info(APP_INSTANCE_PREFIX "Setup with cached parameters failed, dropping them" NL, conn_handle);
+    reconnect_cache_remove(address);
+  }
+}
+
+/******************************************************************************
+ * Remember the parameters of a reflector for the next connection
+ *****************************************************************************/
+static void store_reconnect_cache(uint8_t connection,
+                                  const cs_initiator_config_t *config,
+                                  const rtl_config_t *instance_rtl_config,
+                                  uint8_t remote_num_antennas)
+{
+  reconnect_cache_entry_t entry;
+  uint8_t security_mode;
+  uint8_t key_size;
+  uint8_t bonding = SL_BT_INVALID_BONDING_HANDLE;
+  const bd_addr *address = ble_peer_manager_get_bt_address(connection);
+
+  if (address == NULL) {
+    return;
+  }
+  (void)sl_bt_connection_get_security_status(connection, &security_mode, &key_size, &bonding);
+  memset(&entry, 0, sizeof(entry));
+  entry.config_signature = get_config_signature(config, instance_rtl_config);
+  entry.conn_interval = config->max_connection_interval;
+  entry.proc_interval = config->max_procedure_interval;
+  entry.address = *address;
+  entry.remote_num_antennas = remote_num_antennas;
+  entry.bonded = (bonding != SL_BT_INVALID_BONDING_HANDLE);
+  sl_status_t sc = reconnect_cache_store(&entry);
+  if (sc != SL_STATUS_OK) {
+    log_error(APP_INSTANCE_PREFIX "Failed to store reconnect cache entry [sc: 0x%lx]" NL,
+              connection,
+              (unsigned long)sc);
+  }
+}
+#endif // CS_INITIATOR_RECONNECT_CACHE
 
 /******************************************************************************
  * CS error handler
  *****************************************************************************/
 static void cs_on_error(uint8_t conn_handle, cs_error_event_t err_evt, sl_status_t sc)
 {
+#if CS_INITIATOR_RECONNECT_CACHE
+  drop_reconnect_cache(conn_handle, err_evt);
+#endif // CS_INITIATOR_RECONNECT_CACHE
   switch (err_evt) {
-    // Assert
+    // Recreate the instance
     case CS_ERROR_EVENT_CS_PROCEDURE_STOP_TIMER_FAILED:
     case CS_ERROR_EVENT_CS_PROCEDURE_UNEXPECTED_DATA:
-      app_assert(false,
-                 APP_INSTANCE_PREFIX "Unrecoverable CS procedure error happened!"
-                                     "[E: 0x%x sc: 0x%lx]" NL,
-                 conn_handle,
-                 err_evt,
-                 (unsigned long)sc);
+      recover_initiator_instance(conn_handle, err_evt, sc);
       break;
 
     // Discard
@@ -822,6 +2312,7 @@ void sl_bt_on_event(sl_bt_msg_t * evt)
     // Do not call any stack command before receiving this boot event!
     case sl_bt_evt_system_boot_id:
     {
+      MILESTONE_INIT(&milestones, milestone_records, get_time_ms());
       // Set TX power
       int16_t min_tx_power_x10 = SYSTEM_MIN_TX_POWER_DBM * 10;
       int16_t max_tx_power_x10 = SYSTEM_MAX_TX_POWER_DBM * 10;
@@ -866,7 +2357,7 @@ void sl_bt_on_event(sl_bt_msg_t * evt)
       app_assert_status(sc);
 
 #ifndef SL_CATALOG_CS_INITIATOR_CLI_PRESENT
-      sc = ble_peer_manager_central_create_connection();
+      sc = start_scanning();
       app_assert_status(sc);
       cs_initiator_display_start_scanning();
       // Start scanning for reflector connections
@@ -881,7 +2372,16 @@ void sl_bt_on_event(sl_bt_msg_t * evt)
       sc = get_instance_number(evt->data.evt_connection_parameters.connection, &instance_num);
       // Initiator instance not created yet
       if (sc != SL_STATUS_OK) {
+#if CS_INITIATOR_RECONNECT_CACHE
+        if (try_fast_reconnect(evt->data.evt_connection_parameters.connection)) {
+          break;
+        }
+#endif // CS_INITIATOR_RECONNECT_CACHE
         if (evt->data.evt_connection_parameters.security_mode != sl_bt_connection_mode1_level1) {
+          MILESTONE_MARK(&milestones,
+                         evt->data.evt_connection_parameters.connection,
+                         MILESTONE_SECURITY,
+                         get_time_ms());
           sc = sl_bt_cs_read_remote_supported_capabilities(evt->data.evt_connection_parameters.connection);
           app_assert_status(sc);
         } else {
@@ -903,90 +2403,60 @@ void sl_bt_on_event(sl_bt_msg_t * evt)
 
     case sl_bt_evt_cs_read_remote_supported_capabilities_complete_id:
     {
-      uint16_t proc_interval;
-      uint16_t conn_interval;
-      uint8_t cs_tone_antenna_config_index_temp = initiator_config.cs_tone_antenna_config_idx;
-      uint8_t connection = evt->data.evt_cs_read_remote_supported_capabilities_complete.connection;
-      sc = sl_bt_cs_read_local_supported_capabilities(NULL,
-                                                      NULL,
-                                                      &initiator_config.num_antennas,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL,
-                                                      NULL);
-      app_assert_status(sc);
-      if (initiator_config.max_procedure_count == 0) {
-        sc = cs_initiator_get_intervals(initiator_config.cs_main_mode,
-                                        initiator_config.cs_sub_mode,
-                                        initiator_config.procedure_scheduling,
-                                        initiator_config.channel_map_preset,
-                                        rtl_config.algo_mode,
-                                        initiator_config.cs_tone_antenna_config_idx,
-                                        initiator_config.use_real_time_ras_mode,
-                                        &conn_interval,
-                                        &proc_interval);
-        if (sc == SL_STATUS_NOT_SUPPORTED) {
-          log_info(APP_INSTANCE_PREFIX "Parameter optimization is not supported with the given input parameters" NL, connection);
-        } else if (sc == SL_STATUS_IDLE) {
-          log_info(APP_PREFIX "No optimization - using custom procedure scheduling" NL);
-        } else if (sc == SL_STATUS_OK) {
-          initiator_config.max_connection_interval = initiator_config.min_connection_interval = conn_interval;
-          initiator_config.max_procedure_interval = initiator_config.min_procedure_interval = proc_interval;
-          log_info(APP_INSTANCE_PREFIX "Optimized parameters for connection interval and procedure interval." NL, connection);
-        } else {
-          log_error(APP_INSTANCE_PREFIX "Invalid input, cannot optimize parameters." NL, connection);
-        }
-        float period_ms = initiator_config.max_connection_interval * 1.25f * initiator_config.max_procedure_interval;
-        log_info(APP_INSTANCE_PREFIX "Connection interval: %u  Procedure interval: %u  Period: %d ms  Frequency: %u.%03u Hz" NL,
-                 connection,
-                 initiator_config.max_connection_interval,
-                 initiator_config.max_procedure_interval,
-                 (int)period_ms,
-                 (uint16_t)(1000.0f / period_ms),
-                 (((uint16_t)(1000000.0f / period_ms)) % 1000));
-        // put remote antenna num into cs_tone_antenna_config_idx
-        initiator_config.cs_tone_antenna_config_idx = evt->data.evt_cs_read_remote_supported_capabilities_complete.num_antennas;
-      }
-      sc = create_new_initiator_instance(connection);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to create initiator instance, "
-                                      "error:0x%lx" NL,
-                  connection,
-                  sc);
-        (void)ble_peer_manager_central_close_connection(connection);
-      } else {
-        log_info(APP_INSTANCE_PREFIX "New initiator instance created" NL,
-                 connection);
-      }
-      // set cs_tone_antenna_config_idx to default
-      initiator_config.cs_tone_antenna_config_idx = cs_tone_antenna_config_index_temp;
-      sc = get_instance_number(connection, &instance_num);
-      if (sc != SL_STATUS_OK) {
-        log_error(APP_INSTANCE_PREFIX "Failed to get instance number for connection" NL,
-                  connection);
-        return;
-      }
-      cs_initiator_instances[instance_num].read_remote_capabilities = true;
-      // Scan for new reflector connections if we have room for more
-      if (num_reflector_connections < CS_INITIATOR_MAX_CONNECTIONS) {
-        sc = ble_peer_manager_central_create_connection();
-        app_assert_status(sc);
-        cs_initiator_display_start_scanning();
-        log_info(APP_PREFIX "Scanning restarted for new reflector connections..." NL);
-      }
+      cs_initiator_config_t config;
+      rtl_config_t instance_rtl_config;
+      bool cached_intervals = false;
+      MILESTONE_MARK(&milestones,
+                     evt->data.evt_cs_read_remote_supported_capabilities_complete.connection,
+                     MILESTONE_CAPABILITIES,
+                     get_time_ms());
+      get_instance_config(evt->data.evt_cs_read_remote_supported_capabilities_complete.connection,
+                          &config,
+                          &instance_rtl_config);
+#if CS_INITIATOR_RECONNECT_CACHE
+      cached_intervals = apply_reconnect_cache(evt->data.evt_cs_read_remote_supported_capabilities_complete.connection,
+                                               evt->data.evt_cs_read_remote_supported_capabilities_complete.num_antennas,
+                                               &config,
+                                               &instance_rtl_config);
+#endif // CS_INITIATOR_RECONNECT_CACHE
+      start_initiator(evt->data.evt_cs_read_remote_supported_capabilities_complete.connection,
+                      &config,
+                      &instance_rtl_config,
+                      evt->data.evt_cs_read_remote_supported_capabilities_complete.num_antennas,
+                      cached_intervals);
       break;
     }
+
+#if CS_INITIATOR_PROFILES
+    // Advertised names for the profile lookup
+    case sl_bt_evt_scanner_legacy_advertisement_report_id:
+      initiator_profile_on_advertisement(&evt->data.evt_scanner_legacy_advertisement_report.address,
+                                         evt->data.evt_scanner_legacy_advertisement_report.data.data,
+                                         evt->data.evt_scanner_legacy_advertisement_report.data.len);
+      break;
+
+    case sl_bt_evt_scanner_extended_advertisement_report_id:
+      initiator_profile_on_advertisement(&evt->data.evt_scanner_extended_advertisement_report.address,
+                                         evt->data.evt_scanner_extended_advertisement_report.data.data,
+                                         evt->data.evt_scanner_extended_advertisement_report.data.len);
+      break;
+#endif // CS_INITIATOR_PROFILES
+
+    // The CS initiator component handles these, they are only timed here
+    case sl_bt_evt_cs_config_complete_id:
+      MILESTONE_MARK(&milestones,
+                     evt->data.evt_cs_config_complete.connection,
+                     MILESTONE_CS_CONFIG,
+                     get_time_ms());
+      break;
+
+    case sl_bt_evt_cs_procedure_enable_complete_id:
+      MILESTONE_MARK(&milestones,
+                     evt->data.evt_cs_procedure_enable_complete.connection,
+                     MILESTONE_PROCEDURE_ENABLED,
+                     get_time_ms());
+      break;
+
     default:
       break;
   }
@@ -1001,10 +2471,25 @@ void ble_peer_manager_on_event_initiator(ble_peer_manager_evt_type_t * event)
 {
   sl_status_t sc;
   bd_addr *address;
+#if CS_INITIATOR_TAG_ROTATION
+  uint8_t instance_num;
+#endif // CS_INITIATOR_TAG_ROTATION
 
   switch (event->evt_id) {
     case BLE_PEER_MANAGER_ON_CONN_OPENED_CENTRAL:
       address = ble_peer_manager_get_bt_address(event->connection_id);
+#if CS_INITIATOR_TAG_ROTATION
+      // Scanning stops when a connection opens
+      rotation_scanning = false;
+      if (rotation_connecting
+          && memcmp(address->addr, rotation_address.addr, BT_ADDR_LEN) == 0) {
+        rotation_connecting = false;
+        (void)app_timer_stop(&rotation_timer);
+      }
+      (void)tag_rotation_on_connected(address, event->connection_id);
+#endif // CS_INITIATOR_TAG_ROTATION
+      connection_timing_start(event->connection_id);
+      MILESTONE_OPEN(&milestones, event->connection_id, get_time_ms());
       log_info(APP_INSTANCE_PREFIX "Connection opened as central with CS Reflector"
                                    " '%02X:%02X:%02X:%02X:%02X:%02X'" NL,
                event->connection_id,
@@ -1026,9 +2511,28 @@ void ble_peer_manager_on_event_initiator(ble_peer_manager_evt_type_t * event)
         app_assert_status(sc);
         log_info(APP_INSTANCE_PREFIX "Initiator instance removed" NL, event->connection_id);
       }
+#if CS_INITIATOR_TAG_ROTATION
+      {
+        bool complete = (get_instance_number(event->connection_id, &instance_num) == SL_STATUS_OK)
+                        && (cs_initiator_instances[instance_num].measurement_cnt
+                            >= CS_INITIATOR_TAG_ROTATION_PROCEDURES);
+        tag_rotation_on_disconnected(event->connection_id, get_time_ms(), complete);
+      }
+#endif // CS_INITIATOR_TAG_ROTATION
       delete_initiator_instance(event->connection_id);
+      (void)connection_timing_stop(event->connection_id, NULL);
+#if APP_MILESTONES
+      {
+        // Show where a connection without results got stuck
+        const milestone_record_t *record = milestone_get(&milestones, event->connection_id);
+        if (record != NULL && (record->reached & MILESTONE_BIT(MILESTONE_FIRST_RESULT)) == 0u) {
+          log_milestones(event->connection_id);
+        }
+        milestone_close(&milestones, event->connection_id);
+      }
+#endif // APP_MILESTONES
       // Restart scanning for new reflector connections
-      (void)ble_peer_manager_central_create_connection();
+      (void)start_scanning();
       cs_initiator_display_start_scanning();
       log_info(APP_PREFIX "Scanning started for reflector connections..." NL);
       break;
@@ -46,7 +46,9 @@
 // <q ALWAYS_INIT_TRACE> Enable trace on init
 // <i> If enabled, this option bypasses trace initialization with push button.
 // <i> Default: 0
+#ifndef ALWAYS_INIT_TRACE
 #define ALWAYS_INIT_TRACE                     0
+#endif
 
 // <q CS_INITIATOR_UART_LOG> Enable initiator log on UART
 // <i> Default: 1
@@ -55,6 +57,426 @@
 #define CS_INITIATOR_UART_LOG                 1
 #endif
 
+// <q APP_LOG_TOKENIZED> Tokenized log messages
+// <i> Send log messages as a format string ID and the raw arguments instead of text.
+// <i> The format strings stay in the log_tokens section of the ELF file, decode the
+// <i> output with tools/log_token_decode. Measurement output stays text.
+// <i> Default: 0
+#ifndef APP_LOG_TOKENIZED
+#define APP_LOG_TOKENIZED                     0
+#endif
+
+// <o CS_INITIATOR_OUTPUT_FORMAT> Measurement output format
+// <CS_INITIATOR_OUTPUT_FORMAT_TEXT=> JSON text lines
+// <CS_INITIATOR_OUTPUT_FORMAT_BINARY=> COBS framed binary with CRC
+// <i> Default: CS_INITIATOR_OUTPUT_FORMAT_TEXT
+// <i> Binary frames are written to the VCOM stream. See output_frame.h for the frame layout.
+#ifndef CS_INITIATOR_OUTPUT_FORMAT
+#define CS_INITIATOR_OUTPUT_FORMAT            CS_INITIATOR_OUTPUT_FORMAT_TEXT
+#endif
+
+// <o CS_INITIATOR_RESULT_QUEUE_SIZE> Result queue size per connection
+// <2=> 2
+// <4=> 4
+// <8=> 8
+// <16=> 16
+// <32=> 32
+// <i> Number of results that can wait for output per connection.
+// <i> Results arriving while the queue is full are dropped and counted.
+// <i> Default: 4
+#ifndef CS_INITIATOR_RESULT_QUEUE_SIZE
+#define CS_INITIATOR_RESULT_QUEUE_SIZE        4
+#endif
+
+// <o CS_INITIATOR_RAM_RESERVE> Heap reserve in bytes <0..65535>
+// <i> Heap left unallocated when the initiator instance pool is sized at boot.
+// <i> The pool takes as many instances as the remaining heap allows, up to
+// <i> the smallest of "Maximum initiator connections" of the CS Initiator
+// <i> component, BLE_PEER_MANAGER_COMMON_MAX_ALLOWED_CONN_COUNT and
+// <i> SL_BT_CONFIG_MAX_CONNECTIONS. The CS Initiator component supports at
+// <i> most 4 connections.
+// <i> Default: 4096
+#ifndef CS_INITIATOR_RAM_RESERVE
+#define CS_INITIATOR_RAM_RESERVE              4096
+#endif
+
+// <o CS_INITIATOR_CONNECTION_RAM_COST> RAM of one more connection in the stack in bytes <0..65535>
+// <i> RAM the Bluetooth stack and the peer manager take for one more connection.
+// <i> Only used for the boot log estimate of how many more tags the remaining
+// <i> RAM would fit. The default is a rough estimate; measure it on the target as
+// <i> the drop of the free heap logged at boot when SL_BT_CONFIG_MAX_CONNECTIONS
+// <i> and BLE_PEER_MANAGER_COMMON_MAX_ALLOWED_CONN_COUNT are raised by one.
+// <i> Default: 1024
+#ifndef CS_INITIATOR_CONNECTION_RAM_COST
+#define CS_INITIATOR_CONNECTION_RAM_COST      1024
+#endif
+
+// <o CS_INITIATOR_STATIC_RAM_BUDGET> Static buffer RAM budget in bytes <0..1048576>
+// <i> Fail the build if the buffers sized by the configuration headers exceed
+// <i> this budget: the ranging data buffers of the CS initiator component, the
+// <i> procedure buffers of the RAS server, if present, and the Bluetooth stack
+// <i> buffer memory. 0 disables the check. The figure is logged at boot.
+// <i> Default: 0
+#ifndef CS_INITIATOR_STATIC_RAM_BUDGET
+#define CS_INITIATOR_STATIC_RAM_BUDGET        0
+#endif
+
+// <q APP_MILESTONES> Log connection milestones
+// <i> Log the time of each setup step from boot to the first result as one line per connection.
+// <i> Default: 0
+#ifndef APP_MILESTONES
+#define APP_MILESTONES                        0
+#endif
+
+// <e CS_INITIATOR_OUTPUT_POLICY> Event driven output
+// <i> Output a distance only when it has changed by more than the deadband or the
+// <i> heartbeat has expired, and report when a tag changes distance zone, see
+// <i> CS_INITIATOR_OUTPUT_ZONE_LIST. The settings can be changed per tag with the
+// <i> output_policy CLI command.
+// <i> Default: 0
+#ifndef CS_INITIATOR_OUTPUT_POLICY
+#define CS_INITIATOR_OUTPUT_POLICY            0
+#endif
+
+// <o CS_INITIATOR_OUTPUT_DEADBAND_MM> Deadband [mm] <0..100000>
+// <i> Smallest distance change that is output. 0 outputs every result.
+// <i> Default: 50
+#ifndef CS_INITIATOR_OUTPUT_DEADBAND_MM
+#define CS_INITIATOR_OUTPUT_DEADBAND_MM       50
+#endif
+
+// <o CS_INITIATOR_OUTPUT_HEARTBEAT_MS> Heartbeat [msec] <0..3600000>
+// <i> The distance is output at least this often while results arrive. 0 disables it.
+// <i> Default: 5000
+#ifndef CS_INITIATOR_OUTPUT_HEARTBEAT_MS
+#define CS_INITIATOR_OUTPUT_HEARTBEAT_MS      5000
+#endif
+
+// <o CS_INITIATOR_OUTPUT_ZONE_HYSTERESIS_MM> Zone hysteresis [mm] <0..100000>
+// <i> Distance past a zone boundary before the zone changes.
+// <i> Default: 200
+#ifndef CS_INITIATOR_OUTPUT_ZONE_HYSTERESIS_MM
+#define CS_INITIATOR_OUTPUT_ZONE_HYSTERESIS_MM  200
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_DISTANCE_FILTER> Robust distance filter
+// <i> Filter the distances of every tag after the RTL library with a median or Hampel
+// <i> filter and drop results with a low likeliness, so that the output carries
+// <i> outlier free distances. The RSSI based distance is filtered the same way.
+// <i> Default: 0
+#ifndef CS_INITIATOR_DISTANCE_FILTER
+#define CS_INITIATOR_DISTANCE_FILTER          0
+#endif
+
+// <o CS_INITIATOR_DISTANCE_FILTER_TYPE> Filter type
+// <DISTANCE_FILTER_TYPE_MEDIAN=> Median
+// <DISTANCE_FILTER_TYPE_HAMPEL=> Hampel
+// <i> The median filter outputs the median of the window. The Hampel filter outputs
+// <i> the distance itself unless it is an outlier, which it replaces by the median.
+// <i> Default: DISTANCE_FILTER_TYPE_HAMPEL
+#ifndef CS_INITIATOR_DISTANCE_FILTER_TYPE
+#define CS_INITIATOR_DISTANCE_FILTER_TYPE     DISTANCE_FILTER_TYPE_HAMPEL
+#endif
+
+// <o CS_INITIATOR_DISTANCE_FILTER_INPUT> Filter input
+// <DISTANCE_FILTER_INPUT_FILTERED=> Filtered distance of the RTL library
+// <DISTANCE_FILTER_INPUT_RAW=> Raw distance of the RTL library
+// <i> Default: DISTANCE_FILTER_INPUT_FILTERED
+#ifndef CS_INITIATOR_DISTANCE_FILTER_INPUT
+#define CS_INITIATOR_DISTANCE_FILTER_INPUT    DISTANCE_FILTER_INPUT_FILTERED
+#endif
+
+// <o CS_INITIATOR_DISTANCE_FILTER_WINDOW> Window size <1..15>
+// <i> Number of distances kept per tag.
+// <i> Default: 5
+#ifndef CS_INITIATOR_DISTANCE_FILTER_WINDOW
+#define CS_INITIATOR_DISTANCE_FILTER_WINDOW   5
+#endif
+
+// <o CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10> Hampel threshold x10 <1..100>
+// <i> Outlier threshold in tenths of the scaled median absolute deviation.
+// <i> Default: 30
+#ifndef CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10
+#define CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10  30
+#endif
+
+// <o CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS> Minimum likeliness [%] <0..100>
+// <i> Results with a lower likeliness are dropped before the filter. 0 keeps all.
+// <i> Default: 50
+#ifndef CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS
+#define CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS  50
+#endif
+
+// </e>
+
+// <e PROFILER_ENABLE> Execution time profiler
+// <i> Measure the run time of the result callback, the main loop and the RTL log callback
+// <i> with the DWT cycle counter and log the statistics periodically. With the CS initiator
+// <i> CLI component the profiler command logs them on demand and can clear them.
+// <i> Default: 0
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE                       0
+#endif
+
+// <o CS_INITIATOR_PROFILER_LOG_PERIOD_MS> Log period [msec] <1000..600000>
+// <i> Default: 10000
+#ifndef CS_INITIATOR_PROFILER_LOG_PERIOD_MS
+#define CS_INITIATOR_PROFILER_LOG_PERIOD_MS   10000
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_TAG_ROTATION> Tag rotation
+// <i> Visit the tags of CS_INITIATOR_TAG_ROTATION_LIST one after the other instead of
+// <i> staying connected. Each visit connects, waits for a number of results and disconnects,
+// <i> so more tags can be tracked than there are connection slots at a lower update rate.
+// <i> Default: 0
+#ifndef CS_INITIATOR_TAG_ROTATION
+#define CS_INITIATOR_TAG_ROTATION             0
+#endif
+
+// <o CS_INITIATOR_TAG_ROTATION_MAX_TAGS> Maximum number of tags <1..64>
+// <i> Default: 64
+#ifndef CS_INITIATOR_TAG_ROTATION_MAX_TAGS
+#define CS_INITIATOR_TAG_ROTATION_MAX_TAGS    64
+#endif
+
+// <o CS_INITIATOR_TAG_ROTATION_PROCEDURES> Results per visit <1..255>
+// <i> Number of results to collect before disconnecting from a tag.
+// <i> Default: 5
+#ifndef CS_INITIATOR_TAG_ROTATION_PROCEDURES
+#define CS_INITIATOR_TAG_ROTATION_PROCEDURES  5
+#endif
+
+// <o CS_INITIATOR_TAG_ROTATION_REVISIT_MS> Revisit period [msec] <100..3600000>
+// <i> Minimum time between the end of a visit and the start of the next one for the same tag.
+// <i> Default: 10000
+#ifndef CS_INITIATOR_TAG_ROTATION_REVISIT_MS
+#define CS_INITIATOR_TAG_ROTATION_REVISIT_MS  10000
+#endif
+
+// <o CS_INITIATOR_TAG_ROTATION_CONNECT_TIMEOUT_MS> Connect timeout [msec] <100..60000>
+// <i> Time to look for a tag before it is skipped until its next visit.
+// <i> Default: 2000
+#ifndef CS_INITIATOR_TAG_ROTATION_CONNECT_TIMEOUT_MS
+#define CS_INITIATOR_TAG_ROTATION_CONNECT_TIMEOUT_MS  2000
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_RECONNECT_CACHE> Reconnect cache
+// <i> Store the antenna count and optimized intervals of reflectors in NVM3, so that
+// <i> reconnecting to a known reflector skips the security request and the parameter
+// <i> optimization.
+// <i> Default: 0
+#ifndef CS_INITIATOR_RECONNECT_CACHE
+#define CS_INITIATOR_RECONNECT_CACHE          0
+#endif
+
+// <o CS_INITIATOR_RECONNECT_CACHE_SIZE> Number of cached reflectors <1..32>
+// <i> Default: 8
+#ifndef CS_INITIATOR_RECONNECT_CACHE_SIZE
+#define CS_INITIATOR_RECONNECT_CACHE_SIZE     8
+#endif
+
+// </e>
+
+// <h> Motion detection
+// <i> Movement detection of the tags, used by the adaptive procedure interval
+// <i> and the automatic algorithm mode.
+
+// <o CS_INITIATOR_MOTION_SPEED_MM_S> Moving speed [mm/s] <1..10000>
+// <i> Velocity above which a tag moves. Velocity is measured with REAL_TIME_FAST,
+// <i> PBR and the HIGH or MEDIUM channel map preset only.
+// <i> Default: 250
+#ifndef CS_INITIATOR_MOTION_SPEED_MM_S
+#define CS_INITIATOR_MOTION_SPEED_MM_S        250
+#endif
+
+// <o CS_INITIATOR_MOTION_DISTANCE_MM> Moving distance [mm] <1..10000>
+// <i> Distance change since the last movement above which a tag moves.
+// <i> Default: 300
+#ifndef CS_INITIATOR_MOTION_DISTANCE_MM
+#define CS_INITIATOR_MOTION_DISTANCE_MM       300
+#endif
+
+// </h>
+
+// <e CS_INITIATOR_ADAPTIVE_INTERVAL> Adaptive procedure interval
+// <i> Lengthen the procedure interval of tags that stand still and return to the configured
+// <i> interval as soon as they move. A change recreates the initiator instance of the tag.
+// <i> Default: 0
+#ifndef CS_INITIATOR_ADAPTIVE_INTERVAL
+#define CS_INITIATOR_ADAPTIVE_INTERVAL        0
+#endif
+
+// <o CS_INITIATOR_ADAPTIVE_MAX_FACTOR> Maximum interval factor <2..64>
+// <i> Slowest procedure interval as a multiple of the configured one.
+// <i> Default: 8
+#ifndef CS_INITIATOR_ADAPTIVE_MAX_FACTOR
+#define CS_INITIATOR_ADAPTIVE_MAX_FACTOR      8
+#endif
+
+// <o CS_INITIATOR_ADAPTIVE_STILL_RESULTS> Results per slowdown step <1..255>
+// <i> Results without movement before the interval is doubled.
+// <i> Default: 5
+#ifndef CS_INITIATOR_ADAPTIVE_STILL_RESULTS
+#define CS_INITIATOR_ADAPTIVE_STILL_RESULTS   5
+#endif
+
+// <o CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS> Minimum dwell time [ms] <0..600000>
+// <i> Time an interval is kept, counted from its last change or the last movement of the
+// <i> tag, before it is lengthened. The slowdown steps earned meanwhile are applied in one
+// <i> change, so a tag that stops costs fewer instance recreations. Moving tags get the
+// <i> configured interval at once. 0 lengthens the interval at every step.
+// <i> Default: 20000
+#ifndef CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS
+#define CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS    20000
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_AUTO_ALGO_MODE> Automatic algorithm mode
+// <i> Use STATIC_HIGH_ACCURACY for tags that stand still and REAL_TIME_FAST for tags
+// <i> that move, chosen per tag. Overrides the object tracking mode of the button and the CLI.
+// <i> A change recreates the initiator instance of the tag.
+// <i> Default: 0
+#ifndef CS_INITIATOR_AUTO_ALGO_MODE
+#define CS_INITIATOR_AUTO_ALGO_MODE           0
+#endif
+
+// <o CS_INITIATOR_AUTO_ALGO_STILL_RESULTS> Results before static mode <1..255>
+// <i> Results without movement before a tag switches to STATIC_HIGH_ACCURACY.
+// <i> Default: 10
+#ifndef CS_INITIATOR_AUTO_ALGO_STILL_RESULTS
+#define CS_INITIATOR_AUTO_ALGO_STILL_RESULTS  10
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_PROFILES> Configuration profiles
+// <i> Give tags that match an entry of CS_INITIATOR_PROFILE_LIST by address prefix or advertised
+// <i> name their own procedure interval, channel map preset and algorithm mode.
+// <i> Default: 0
+#ifndef CS_INITIATOR_PROFILES
+#define CS_INITIATOR_PROFILES                 0
+#endif
+
+// <o CS_INITIATOR_PROFILE_NAME_CACHE_SIZE> Advertised names kept <1..32>
+// <i> Number of recently seen advertisers whose name is kept for the profile lookup.
+// <i> Default: 8
+#ifndef CS_INITIATOR_PROFILE_NAME_CACHE_SIZE
+#define CS_INITIATOR_PROFILE_NAME_CACHE_SIZE  8
+#endif
+
+// <o CS_INITIATOR_PROFILE_NAME_LEN> Maximum name length <1..31>
+// <i> Default: 16
+#ifndef CS_INITIATOR_PROFILE_NAME_LEN
+#define CS_INITIATOR_PROFILE_NAME_LEN         16
+#endif
+
+// </e>
+
+// <e CS_INITIATOR_PRIORITY_SCHEDULING> Priority weighted procedure scheduling
+// <i> Share the CS airtime among the connected tags in proportion to their priority,
+// <i> set by the configuration profiles. The procedure interval of every tag is
+// <i> recomputed when a tag connects or disconnects, which recreates the instances
+// <i> whose interval changes. All tags should use the same connection interval so that
+// <i> the even anchor selection of the controller keeps their CS events apart.
+// <i> Default: 0
+#ifndef CS_INITIATOR_PRIORITY_SCHEDULING
+#define CS_INITIATOR_PRIORITY_SCHEDULING      0
+#endif
+
+// <o CS_INITIATOR_PRIORITY_DEFAULT> Default priority <1..255>
+// <i> Priority of the tags without a profile priority.
+// <i> Default: 1
+#ifndef CS_INITIATOR_PRIORITY_DEFAULT
+#define CS_INITIATOR_PRIORITY_DEFAULT         1
+#endif
+
+// <o CS_INITIATOR_PRIORITY_AIRTIME_PERCENT> CS airtime budget [%] <10..100>
+// <i> Share of the radio time given to CS procedures. The rest is left for the
+// <i> connection events, the RAS transfers and scanning.
+// <i> Default: 60
+#ifndef CS_INITIATOR_PRIORITY_AIRTIME_PERCENT
+#define CS_INITIATOR_PRIORITY_AIRTIME_PERCENT 60
+#endif
+
+// <o CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS> Procedure duration [msec] <1..1000>
+// <i> Estimated duration of one CS procedure. It depends on the channel map and the
+// <i> number of steps; e.g. about 20 ms for the HIGH preset with PBR.
+// <i> Default: 20
+#ifndef CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS
+#define CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS  20
+#endif
+
+// </e>
+
+// <h> CS procedure error recovery
+// <i> A failed procedure stop timer or unexpected procedure data recreates the initiator
+// <i> instance of the affected connection only. The other connections keep ranging.
+
+// <o CS_INITIATOR_RECOVERY_BASE_DELAY_MS> First retry delay [msec] <10..60000>
+// <i> Delay before the instance is recreated. It doubles with every retry without a result.
+// <i> Default: 100
+#ifndef CS_INITIATOR_RECOVERY_BASE_DELAY_MS
+#define CS_INITIATOR_RECOVERY_BASE_DELAY_MS   100
+#endif
+
+// <o CS_INITIATOR_RECOVERY_MAX_DELAY_MS> Maximum retry delay [msec] <10..60000>
+// <i> Default: 5000
+#ifndef CS_INITIATOR_RECOVERY_MAX_DELAY_MS
+#define CS_INITIATOR_RECOVERY_MAX_DELAY_MS    5000
+#endif
+
+// <o CS_INITIATOR_RECOVERY_MAX_ATTEMPTS> Retries per connection <1..255>
+// <i> Retries without a result before the connection is closed.
+// <i> Default: 5
+#ifndef CS_INITIATOR_RECOVERY_MAX_ATTEMPTS
+#define CS_INITIATOR_RECOVERY_MAX_ATTEMPTS    5
+#endif
+
+// <o CS_INITIATOR_RECOVERY_ERROR_BUDGET> Error budget <0..1000>
+// <i> Errors of all connections tolerated within the budget window. One more resets the device.
+// <i> Default: 20
+#ifndef CS_INITIATOR_RECOVERY_ERROR_BUDGET
+#define CS_INITIATOR_RECOVERY_ERROR_BUDGET    20
+#endif
+
+// <o CS_INITIATOR_RECOVERY_BUDGET_WINDOW_MS> Budget window [msec] <1000..3600000>
+// <i> Default: 60000
+#ifndef CS_INITIATOR_RECOVERY_BUDGET_WINDOW_MS
+#define CS_INITIATOR_RECOVERY_BUDGET_WINDOW_MS  60000
+#endif
+
+// </h>
+
 // <<< end of configuration section >>>
 
+// Tags of the rotation as "XX:XX:XX:XX:XX:XX" strings, most significant byte first,
+// e.g. { "00:0B:57:00:00:01", "00:0B:57:00:00:02" }. More tags can be added with
+// tag_rotation_add() at runtime.
+#ifndef CS_INITIATOR_TAG_ROTATION_LIST
+#define CS_INITIATOR_TAG_ROTATION_LIST        { NULL }
+#endif
+
+// Configuration profiles as { address prefix, name prefix, procedure interval,
+// channel map preset, algorithm mode, priority }, see initiator_profile.h. The
+// first matching profile is used, e.g.
+// { { NULL, "FORKLIFT", 10, INITIATOR_PROFILE_KEEP, SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST, 4 },
+//   { "00:0B:57", "PALLET", 200, CS_CHANNEL_MAP_PRESET_MEDIUM, SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY, 1 } }
+#ifndef CS_INITIATOR_PROFILE_LIST
+#define CS_INITIATOR_PROFILE_LIST             { { NULL, NULL, 0, 0, 0, 0 } }
+#endif
+
+// Zone boundaries of the event driven output in mm, ascending, up to 4. The
+// list ends at the first 0, e.g. { 1000, 3000 } gives the zones below 1 m,
+// 1 m to 3 m and beyond 3 m.
+#ifndef CS_INITIATOR_OUTPUT_ZONE_LIST
+#define CS_INITIATOR_OUTPUT_ZONE_LIST         { 0 }
+#endif
+
 #endif // APP_CONFIG_H
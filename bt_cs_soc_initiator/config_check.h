@@ -0,0 +1,153 @@
+/***************************************************************************//**
+ * @file
+ * @brief Build time checks of the initiator configuration.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef CONFIG_CHECK_H
+#define CONFIG_CHECK_H
+
+// Include once, from app.c only.
+#include <assert.h>
+#include "sl_bt_api.h"
+#include "sl_component_catalog.h"
+#include "app_config.h"
+#include "cs_initiator_config.h"
+#include "cs_initiator_client.h"
+#include "priority_schedule.h"
+#include "ranging_data_size.h"
+#ifdef SL_CATALOG_CS_RAS_SERVER_PRESENT
+#include "cs_ras_server_config.h"
+#endif // SL_CATALOG_CS_RAS_SERVER_PRESENT
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Channels of a channel map preset, see the readme. A custom map has at most
+/// the 72 channels of the HIGH preset.
+#define CONFIG_CHECK_PRESET_CHANNELS(preset)              \
+  (((preset) == CS_CHANNEL_MAP_PRESET_LOW) ? 20u          \
+   : ((preset) == CS_CHANNEL_MAP_PRESET_MEDIUM) ? 37u : 72u)
+
+/// Antenna paths of a CS tone antenna configuration index
+#define CONFIG_CHECK_ANTENNA_PATHS(idx)                   \
+  (((idx) == 0) ? 1u                                      \
+   : (((idx) == 1) || ((idx) == 4)) ? 2u                  \
+   : (((idx) == 2) || ((idx) == 5)) ? 3u : 4u)
+
+/// Default configuration, as set up by app_init()
+#define CONFIG_CHECK_SUB_MODE \
+  (CS_INITIATOR_DEFAULT_CS_SUB_MODE != sl_bt_cs_submode_disabled)
+#define CONFIG_CHECK_CHANNELS \
+  CONFIG_CHECK_PRESET_CHANNELS(CS_INITIATOR_DEFAULT_CHANNEL_MAP_PRESET)
+#define CONFIG_CHECK_MAIN_MODE_STEP                                                   \
+  ((CS_INITIATOR_DEFAULT_CS_MAIN_MODE == sl_bt_cs_mode_pbr)                           \
+   ? RANGING_DATA_SIZE_MODE2_STEP(CONFIG_CHECK_ANTENNA_PATHS(CS_INITIATOR_DEFAULT_CS_TONE_ANTENNA_CONFIG_IDX_REQ)) \
+   : RANGING_DATA_SIZE_MODE1_STEP)
+
+/// Ranging data size needed by the default configuration
+#define CONFIG_CHECK_RANGING_DATA_SIZE                                          \
+  RANGING_DATA_SIZE(CONFIG_CHECK_CHANNELS,                                      \
+                    CS_INITIATOR_DEFAULT_MODE0_STEPS,                           \
+                    RANGING_DATA_SIZE_MODE0_INITIATOR,                          \
+                    CONFIG_CHECK_MAIN_MODE_STEP,                                \
+                    (CONFIG_CHECK_SUB_MODE                                      \
+                     ? RANGING_DATA_SIZE_SUB_MODE(CONFIG_CHECK_CHANNELS,        \
+                                                  CS_INITIATOR_MIXED_MODE_MAIN_MODE_STEPS) \
+                     : 0u))
+
+/// Ranging data the reflector sends for the default configuration
+#define CONFIG_CHECK_REFLECTOR_RANGING_DATA_SIZE                                \
+  RANGING_DATA_SIZE(CONFIG_CHECK_CHANNELS,                                      \
+                    CS_INITIATOR_DEFAULT_MODE0_STEPS,                           \
+                    RANGING_DATA_SIZE_MODE0_REFLECTOR,                          \
+                    CONFIG_CHECK_MAIN_MODE_STEP,                                \
+                    (CONFIG_CHECK_SUB_MODE                                      \
+                     ? RANGING_DATA_SIZE_SUB_MODE(CONFIG_CHECK_CHANNELS,        \
+                                                  CS_INITIATOR_MIXED_MODE_MAIN_MODE_STEPS) \
+                     : 0u))
+
+// RAM summary in bytes. Every figure is a constant of the build configuration.
+
+/// Initiator and reflector ranging data buffers of the CS initiator component
+#define CONFIG_CHECK_RAM_RANGING_DATA \
+  (2ul * CS_INITIATOR_MAX_RANGING_DATA_SIZE * CS_INITIATOR_MAX_CONNECTIONS)
+
+/// Part of CONFIG_CHECK_RAM_RANGING_DATA the default configuration uses
+#define CONFIG_CHECK_RAM_RANGING_DATA_NEEDED \
+  (2ul * CONFIG_CHECK_RANGING_DATA_SIZE * CS_INITIATOR_MAX_CONNECTIONS)
+
+/// Procedure buffers of the RAS server, in builds that also act as a reflector
+#ifdef SL_CATALOG_CS_RAS_SERVER_PRESENT
+#define CONFIG_CHECK_RAM_RAS_SERVER \
+  ((unsigned long)CS_PROCEDURE_MAX_LEN * CS_RAS_PROCEDURE_PER_CONNECTION * SL_BT_CONFIG_MAX_CONNECTIONS)
+#else
+#define CONFIG_CHECK_RAM_RAS_SERVER           0ul
+#endif // SL_CATALOG_CS_RAS_SERVER_PRESENT
+
+/// Buffer memory of the Bluetooth stack
+#ifdef SL_BT_CONFIG_BUFFER_SIZE
+#define CONFIG_CHECK_RAM_BT_BUFFER            ((unsigned long)SL_BT_CONFIG_BUFFER_SIZE)
+#else
+#define CONFIG_CHECK_RAM_BT_BUFFER            0ul
+#endif // SL_BT_CONFIG_BUFFER_SIZE
+
+/// Static buffers sized by the configuration headers
+#define CONFIG_CHECK_RAM_TOTAL                                          \
+  (CONFIG_CHECK_RAM_RANGING_DATA + CONFIG_CHECK_RAM_RAS_SERVER + CONFIG_CHECK_RAM_BT_BUFFER)
+
+// -----------------------------------------------------------------------------
+// Checks
+
+static_assert(CS_INITIATOR_MAX_RANGING_DATA_SIZE >= CONFIG_CHECK_RANGING_DATA_SIZE,
+              "CS_INITIATOR_MAX_RANGING_DATA_SIZE is too small for the default channel map preset, "
+              "mode 0 steps, antenna configuration and sub mode. See the readme.");
+
+static_assert(CS_INITIATOR_DEFAULT_MIN_PROCEDURE_INTERVAL <= CS_INITIATOR_DEFAULT_MAX_PROCEDURE_INTERVAL,
+              "The minimum procedure interval exceeds the maximum.");
+
+static_assert(CS_INITIATOR_DEFAULT_MIN_CONNECTION_INTERVAL <= CS_INITIATOR_DEFAULT_MAX_CONNECTION_INTERVAL,
+              "The minimum connection interval exceeds the maximum.");
+
+#ifdef SL_CATALOG_CS_RAS_SERVER_PRESENT
+static_assert(CS_PROCEDURE_MAX_LEN >= CONFIG_CHECK_REFLECTOR_RANGING_DATA_SIZE,
+              "CS_PROCEDURE_MAX_LEN of the RAS server is too small for the default configuration. "
+              "See the readme.");
+#endif // SL_CATALOG_CS_RAS_SERVER_PRESENT
+
+#if CS_INITIATOR_STATIC_RAM_BUDGET
+static_assert(CONFIG_CHECK_RAM_TOTAL <= CS_INITIATOR_STATIC_RAM_BUDGET,
+              "The buffers of the configuration exceed CS_INITIATOR_STATIC_RAM_BUDGET. "
+              "See CONFIG_CHECK_RAM_TOTAL.");
+#endif // CS_INITIATOR_STATIC_RAM_BUDGET
+
+#if CS_INITIATOR_PRIORITY_SCHEDULING
+static_assert(CS_INITIATOR_MAX_CONNECTIONS <= PRIORITY_SCHEDULE_MAX_TAGS,
+              "Priority scheduling supports at most PRIORITY_SCHEDULE_MAX_TAGS connections.");
+#endif // CS_INITIATOR_PRIORITY_SCHEDULING
+
+#endif // CONFIG_CHECK_H
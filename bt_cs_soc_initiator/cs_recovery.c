@@ -0,0 +1,136 @@
+/***************************************************************************//**
+ * @file
+ * @brief Recovery policy for failed CS procedures.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "cs_recovery.h"
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static uint32_t error_count[CS_RECOVERY_REASON_COUNT];
+static uint32_t budget_window_start_ms = 0u;
+static uint32_t budget_window_errors = 0u;
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Reset the error counters and the error budget.
+ *****************************************************************************/
+void cs_recovery_init(uint32_t now_ms)
+{
+  for (uint8_t i = 0u; i < CS_RECOVERY_REASON_COUNT; i++) {
+    error_count[i] = 0u;
+  }
+  budget_window_start_ms = now_ms;
+  budget_window_errors = 0u;
+}
+
+/******************************************************************************
+ * Reset the recovery state of an instance.
+ *****************************************************************************/
+void cs_recovery_instance_init(cs_recovery_instance_t *instance)
+{
+  instance->attempts = 0u;
+}
+
+/******************************************************************************
+ * Count a recoverable error and decide how to handle it.
+ *****************************************************************************/
+cs_recovery_action_t cs_recovery_on_error(cs_recovery_instance_t *instance,
+                                          cs_recovery_reason_t reason,
+                                          uint32_t now_ms,
+                                          uint32_t *delay_ms)
+{
+  if (reason < CS_RECOVERY_REASON_COUNT) {
+    error_count[reason]++;
+  }
+
+  // The budget is shared by all instances, so that a fault that hits every
+  // connection still ends in a reset.
+  if ((uint32_t)(now_ms - budget_window_start_ms) >= CS_INITIATOR_RECOVERY_BUDGET_WINDOW_MS) {
+    budget_window_start_ms = now_ms;
+    budget_window_errors = 0u;
+  }
+  budget_window_errors++;
+  if (budget_window_errors > CS_INITIATOR_RECOVERY_ERROR_BUDGET) {
+    return CS_RECOVERY_ACTION_RESET;
+  }
+
+  if (instance->attempts >= CS_INITIATOR_RECOVERY_MAX_ATTEMPTS) {
+    instance->attempts = 0u;
+    return CS_RECOVERY_ACTION_DISCONNECT;
+  }
+
+  uint32_t delay = CS_INITIATOR_RECOVERY_BASE_DELAY_MS;
+  for (uint8_t i = 0u; i < instance->attempts && delay < CS_INITIATOR_RECOVERY_MAX_DELAY_MS; i++) {
+    delay *= 2u;
+  }
+  *delay_ms = (delay < CS_INITIATOR_RECOVERY_MAX_DELAY_MS) ? delay : CS_INITIATOR_RECOVERY_MAX_DELAY_MS;
+  instance->attempts++;
+  return CS_RECOVERY_ACTION_RESTART;
+}
+
+/******************************************************************************
+ * End the backoff of an instance.
+ *****************************************************************************/
+void cs_recovery_on_result(cs_recovery_instance_t *instance)
+{
+  instance->attempts = 0u;
+}
+
+/******************************************************************************
+ * Get the number of errors of a reason since boot.
+ *****************************************************************************/
+uint32_t cs_recovery_get_count(cs_recovery_reason_t reason)
+{
+  if (reason >= CS_RECOVERY_REASON_COUNT) {
+    return 0u;
+  }
+  return error_count[reason];
+}
+
+/******************************************************************************
+ * Get the name of a reason.
+ *****************************************************************************/
+const char *cs_recovery_get_reason_name(cs_recovery_reason_t reason)
+{
+  switch (reason) {
+    case CS_RECOVERY_REASON_STOP_TIMER_FAILED:
+      return "procedure stop timer failed";
+    case CS_RECOVERY_REASON_UNEXPECTED_DATA:
+      return "unexpected procedure data";
+    default:
+      return "unknown";
+  }
+}
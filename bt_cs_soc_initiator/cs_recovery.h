@@ -0,0 +1,110 @@
+/***************************************************************************//**
+ * @file
+ * @brief Recovery policy for failed CS procedures.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef CS_RECOVERY_H
+#define CS_RECOVERY_H
+
+// The policy has no SDK dependencies so that it can be built into host tools.
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Errors that are recovered by recreating the initiator instance
+typedef enum {
+  CS_RECOVERY_REASON_STOP_TIMER_FAILED,
+  CS_RECOVERY_REASON_UNEXPECTED_DATA,
+  CS_RECOVERY_REASON_COUNT
+} cs_recovery_reason_t;
+
+/// Action to take on a recoverable error
+typedef enum {
+  CS_RECOVERY_ACTION_RESTART,     ///< Recreate the instance after the returned delay
+  CS_RECOVERY_ACTION_DISCONNECT,  ///< Too many attempts, close the connection
+  CS_RECOVERY_ACTION_RESET        ///< Error budget exhausted, reset the device
+} cs_recovery_action_t;
+
+/// Recovery state of an initiator instance
+typedef struct {
+  uint8_t attempts;
+} cs_recovery_instance_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Reset the error counters and the error budget.
+ * @param[in] now_ms Current time in milliseconds.
+ *****************************************************************************/
+void cs_recovery_init(uint32_t now_ms);
+
+/**************************************************************************//**
+ * Reset the recovery state of an instance.
+ * @param[out] instance Recovery state of the instance.
+ *****************************************************************************/
+void cs_recovery_instance_init(cs_recovery_instance_t *instance);
+
+/**************************************************************************//**
+ * Count a recoverable error and decide how to handle it.
+ * The delay doubles with every attempt that does not lead to a result,
+ * starting at CS_INITIATOR_RECOVERY_BASE_DELAY_MS.
+ * @param[in,out] instance Recovery state of the failing instance.
+ * @param[in]     reason   Reason of the error.
+ * @param[in]     now_ms   Current time in milliseconds.
+ * @param[out]    delay_ms Time to wait before recreating the instance.
+ * @return Action to take.
+ *****************************************************************************/
+cs_recovery_action_t cs_recovery_on_error(cs_recovery_instance_t *instance,
+                                          cs_recovery_reason_t reason,
+                                          uint32_t now_ms,
+                                          uint32_t *delay_ms);
+
+/**************************************************************************//**
+ * Tell that an instance produced a result, which ends its backoff.
+ * @param[in,out] instance Recovery state of the instance.
+ *****************************************************************************/
+void cs_recovery_on_result(cs_recovery_instance_t *instance);
+
+/**************************************************************************//**
+ * Get the number of errors of a reason since boot.
+ * @param[in] reason Reason of the error.
+ * @return Number of errors.
+ *****************************************************************************/
+uint32_t cs_recovery_get_count(cs_recovery_reason_t reason);
+
+/**************************************************************************//**
+ * Get the name of a reason.
+ * @param[in] reason Reason of the error.
+ * @return Name of the reason.
+ *****************************************************************************/
+const char *cs_recovery_get_reason_name(cs_recovery_reason_t reason);
+
+#endif // CS_RECOVERY_H
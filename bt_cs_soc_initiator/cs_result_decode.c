@@ -0,0 +1,146 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single pass decoder for CS result type-value buffers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include <string.h>
+#include "sl_bt_version.h"
+#include "cs_result_decode.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// cs_result.c of the Bluetooth SDK 10.0 (Simplicity SDK 2025.6) stores every
+// field as a 1 byte type followed by a float. Check cs_result_extract_field()
+// of another SDK before changing this version check.
+#if (SL_BT_VERSION_MAJOR != 10) || (SL_BT_VERSION_MINOR != 0)
+#error "Check the CS result field layout of this SDK, see cs_result_decode.c"
+#endif
+
+#define FIELD_TYPE_SIZE               sizeof(uint8_t)
+#define FIELD_VALUE_SIZE              sizeof(float)
+#define FIELD_SIZE                    (FIELD_TYPE_SIZE + FIELD_VALUE_SIZE)
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static float *get_destination(uint8_t field,
+                              cs_measurement_data_t *mainmode,
+                              cs_measurement_data_t *submode);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Decode the requested fields of a CS result buffer in a single pass.
+ *****************************************************************************/
+sl_status_t cs_result_decode(const cs_result_session_data_t *session_data,
+                             const uint8_t *result,
+                             uint32_t field_mask,
+                             cs_measurement_data_t *mainmode,
+                             cs_measurement_data_t *submode,
+                             uint32_t *missing_mask)
+{
+  uint32_t pending = field_mask & (uint32_t)CS_RESULT_DECODE_FIELD_MASK;
+
+  // A size that is not a whole number of fields means that the layout is
+  // not the one above.
+  if ((session_data->size % FIELD_SIZE) != 0u) {
+    if (missing_mask != NULL) {
+      *missing_mask = pending;
+    }
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Walk the type-value list once
+  for (size_t offset = 0u;
+       (pending != 0u) && (offset + FIELD_SIZE <= session_data->size);
+       offset += FIELD_SIZE) {
+    uint8_t field = result[offset];
+    if ((field >= 32u) || ((pending & CS_RESULT_DECODE_FIELD(field)) == 0u)) {
+      continue;
+    }
+    float *destination = get_destination(field, mainmode, submode);
+    if (destination != NULL) {
+      memcpy(destination, &result[offset + FIELD_TYPE_SIZE], FIELD_VALUE_SIZE);
+      pending &= ~CS_RESULT_DECODE_FIELD(field);
+    }
+  }
+
+  if (missing_mask != NULL) {
+    *missing_mask = pending;
+  }
+  return (pending == 0u) ? SL_STATUS_OK : SL_STATUS_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Get the measurement member that stores the given field
+ *****************************************************************************/
+static float *get_destination(uint8_t field,
+                              cs_measurement_data_t *mainmode,
+                              cs_measurement_data_t *submode)
+{
+#if !CS_RESULT_DECODE_SUBMODE
+  (void)submode;
+#endif
+  switch (field) {
+    case CS_RESULT_FIELD_DISTANCE_MAINMODE:
+      return &mainmode->distance_filtered;
+    case CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE:
+      return &mainmode->distance_raw;
+    case CS_RESULT_FIELD_LIKELINESS_MAINMODE:
+      return &mainmode->likeliness;
+    case CS_RESULT_FIELD_DISTANCE_RSSI:
+      return &mainmode->distance_estimate_rssi;
+#if CS_RESULT_DECODE_SUBMODE
+    case CS_RESULT_FIELD_DISTANCE_SUBMODE:
+      return &submode->distance_filtered;
+    case CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE:
+      return &submode->distance_raw;
+    case CS_RESULT_FIELD_LIKELINESS_SUBMODE:
+      return &submode->likeliness;
+#endif // CS_RESULT_DECODE_SUBMODE
+#if CS_RESULT_DECODE_VELOCITY
+    case CS_RESULT_FIELD_VELOCITY_MAINMODE:
+      return &mainmode->velocity;
+#endif // CS_RESULT_DECODE_VELOCITY
+#if CS_RESULT_DECODE_BIT_ERROR_RATE
+    case CS_RESULT_FIELD_BIT_ERROR_RATE:
+      return &mainmode->bit_error_rate;
+#endif // CS_RESULT_DECODE_BIT_ERROR_RATE
+    default:
+      return NULL;
+  }
+}
@@ -0,0 +1,114 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single pass decoder for CS result type-value buffers.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef CS_RESULT_DECODE_H
+#define CS_RESULT_DECODE_H
+
+#include <stdint.h>
+#include "sl_status.h"
+#include "cs_result.h"
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Mask bit of a CS result field type
+#define CS_RESULT_DECODE_FIELD(field)          (1UL << (uint32_t)(field))
+
+/// Optional fields compiled into the decoder. The main mode distance, raw
+/// distance, likeliness and RSSI distance are always decoded. A field that
+/// is compiled out is skipped by the walk and never reported as missing.
+#ifndef CS_RESULT_DECODE_SUBMODE
+#define CS_RESULT_DECODE_SUBMODE               1
+#endif
+#ifndef CS_RESULT_DECODE_VELOCITY
+#define CS_RESULT_DECODE_VELOCITY              1
+#endif
+#ifndef CS_RESULT_DECODE_BIT_ERROR_RATE
+#define CS_RESULT_DECODE_BIT_ERROR_RATE        1
+#endif
+
+/// Fields compiled into the decoder. Requests outside of this set are ignored.
+#define CS_RESULT_DECODE_FIELD_MASK                                          \
+  (CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_MAINMODE)                 \
+   | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE)           \
+   | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_LIKELINESS_MAINMODE)             \
+   | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RSSI)                   \
+   | (CS_RESULT_DECODE_SUBMODE                                               \
+      ? (CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_SUBMODE)            \
+         | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE)      \
+         | CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_LIKELINESS_SUBMODE)) : 0UL) \
+   | (CS_RESULT_DECODE_VELOCITY                                              \
+      ? CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_VELOCITY_MAINMODE) : 0UL)     \
+   | (CS_RESULT_DECODE_BIT_ERROR_RATE                                        \
+      ? CS_RESULT_DECODE_FIELD(CS_RESULT_FIELD_BIT_ERROR_RATE) : 0UL))
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Measurement structure
+typedef struct {
+  float distance_filtered;
+  float distance_raw;
+  float likeliness;
+  float distance_estimate_rssi;
+  float velocity;
+  float bit_error_rate;
+} cs_measurement_data_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Decode the requested fields of a CS result buffer in a single pass.
+ *
+ * The type-value list is walked once and every requested field is copied to
+ * the main mode or sub mode measurement. Every entry of the list is a 1 byte
+ * type followed by a float, so entries of other types are stepped over.
+ *
+ * @param[in]  session_data  Result session data of the buffer.
+ * @param[in]  result        Type-value buffer.
+ * @param[in]  field_mask    Requested fields, see CS_RESULT_DECODE_FIELD().
+ * @param[out] mainmode      Main mode measurement.
+ * @param[out] submode       Sub mode measurement.
+ * @param[out] missing_mask  Requested fields that were not found. May be NULL.
+ *
+ * @return SL_STATUS_OK if all requested fields were decoded,
+ *         SL_STATUS_INVALID_PARAMETER if the size of the buffer does not fit
+ *         the layout, SL_STATUS_NOT_FOUND otherwise.
+ *****************************************************************************/
+sl_status_t cs_result_decode(const cs_result_session_data_t *session_data,
+                             const uint8_t *result,
+                             uint32_t field_mask,
+                             cs_measurement_data_t *mainmode,
+                             cs_measurement_data_t *submode,
+                             uint32_t *missing_mask);
+
+#endif // CS_RESULT_DECODE_H
@@ -0,0 +1,113 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single producer, single consumer queue of CS results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "cs_result_queue.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define QUEUE_INDEX(counter)          ((counter) & (CS_INITIATOR_RESULT_QUEUE_SIZE - 1u))
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize an empty queue.
+ *****************************************************************************/
+void cs_result_queue_init(cs_result_queue_t *queue)
+{
+  atomic_init(&queue->head, 0u);
+  atomic_init(&queue->tail, 0u);
+  atomic_init(&queue->overflow_count, 0u);
+}
+
+/******************************************************************************
+ * Reserve the next free entry.
+ *****************************************************************************/
+cs_result_queue_entry_t *cs_result_queue_reserve(cs_result_queue_t *queue)
+{
+  unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  // Acquire pairs with the release in cs_result_queue_release() so that the
+  // consumer is done reading the entry before it is overwritten.
+  unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+
+  if ((head - tail) >= CS_INITIATOR_RESULT_QUEUE_SIZE) {
+    atomic_fetch_add_explicit(&queue->overflow_count, 1u, memory_order_relaxed);
+    return NULL;
+  }
+  return &queue->entries[QUEUE_INDEX(head)];
+}
+
+/******************************************************************************
+ * Publish the reserved entry.
+ *****************************************************************************/
+void cs_result_queue_commit(cs_result_queue_t *queue)
+{
+  unsigned int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+  atomic_store_explicit(&queue->head, head + 1u, memory_order_release);
+}
+
+/******************************************************************************
+ * Get the oldest entry without removing it.
+ *****************************************************************************/
+const cs_result_queue_entry_t *cs_result_queue_peek(cs_result_queue_t *queue)
+{
+  unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  // Acquire pairs with the release in cs_result_queue_commit() so that the
+  // entry content is visible once the new head is.
+  unsigned int head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+  if (head == tail) {
+    return NULL;
+  }
+  return &queue->entries[QUEUE_INDEX(tail)];
+}
+
+/******************************************************************************
+ * Remove the oldest entry.
+ *****************************************************************************/
+void cs_result_queue_release(cs_result_queue_t *queue)
+{
+  unsigned int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+  atomic_store_explicit(&queue->tail, tail + 1u, memory_order_release);
+}
+
+/******************************************************************************
+ * Get the number of dropped results.
+ *****************************************************************************/
+uint32_t cs_result_queue_get_overflow_count(cs_result_queue_t *queue)
+{
+  return (uint32_t)atomic_load_explicit(&queue->overflow_count, memory_order_relaxed);
+}
@@ -0,0 +1,118 @@
+/***************************************************************************//**
+ * @file
+ * @brief Single producer, single consumer queue of CS results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef CS_RESULT_QUEUE_H
+#define CS_RESULT_QUEUE_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include "app_config.h"
+#include "cs_result_decode.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#if (CS_INITIATOR_RESULT_QUEUE_SIZE < 2) \
+  || ((CS_INITIATOR_RESULT_QUEUE_SIZE & (CS_INITIATOR_RESULT_QUEUE_SIZE - 1)) != 0)
+#error "CS_INITIATOR_RESULT_QUEUE_SIZE must be a power of two."
+#endif
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Result of one CS procedure
+typedef struct {
+  uint8_t conn_handle;
+  uint16_t ranging_counter;
+  uint32_t timestamp_ms;
+  cs_measurement_data_t mainmode;
+  cs_measurement_data_t submode;
+} cs_result_queue_entry_t;
+
+/// Result queue
+///
+/// The queue is lock-free for exactly one producer and one consumer. The
+/// producer owns head and overflow_count, the consumer owns tail. Both indices
+/// run freely and are masked on access.
+typedef struct {
+  cs_result_queue_entry_t entries[CS_INITIATOR_RESULT_QUEUE_SIZE];
+  atomic_uint head;
+  atomic_uint tail;
+  atomic_uint overflow_count;
+} cs_result_queue_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize an empty queue. Must not be called while the queue is in use.
+ * @param[out] queue Queue to initialize.
+ *****************************************************************************/
+void cs_result_queue_init(cs_result_queue_t *queue);
+
+/**************************************************************************//**
+ * Reserve the next free entry. Producer only.
+ *
+ * The entry is not visible to the consumer until cs_result_queue_commit() is
+ * called. If the queue is full the overflow counter is incremented.
+ *
+ * @param[in] queue Queue.
+ * @return Entry to fill or NULL if the queue is full.
+ *****************************************************************************/
+cs_result_queue_entry_t *cs_result_queue_reserve(cs_result_queue_t *queue);
+
+/**************************************************************************//**
+ * Publish the entry returned by cs_result_queue_reserve(). Producer only.
+ * @param[in] queue Queue.
+ *****************************************************************************/
+void cs_result_queue_commit(cs_result_queue_t *queue);
+
+/**************************************************************************//**
+ * Get the oldest entry without removing it. Consumer only.
+ * @param[in] queue Queue.
+ * @return Oldest entry or NULL if the queue is empty.
+ *****************************************************************************/
+const cs_result_queue_entry_t *cs_result_queue_peek(cs_result_queue_t *queue);
+
+/**************************************************************************//**
+ * Remove the entry returned by cs_result_queue_peek(). Consumer only.
+ * @param[in] queue Queue.
+ *****************************************************************************/
+void cs_result_queue_release(cs_result_queue_t *queue);
+
+/**************************************************************************//**
+ * Get the number of results dropped because the queue was full.
+ * @param[in] queue Queue.
+ * @return Number of dropped results since init.
+ *****************************************************************************/
+uint32_t cs_result_queue_get_overflow_count(cs_result_queue_t *queue);
+
+#endif // CS_RESULT_QUEUE_H
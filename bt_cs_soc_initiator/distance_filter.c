@@ -0,0 +1,139 @@
+/***************************************************************************//**
+ * @file
+ * @brief Robust fixed-point filter of the distances of a tag.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "distance_filter.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#if (CS_INITIATOR_DISTANCE_FILTER_WINDOW < 1) || (CS_INITIATOR_DISTANCE_FILTER_WINDOW > DISTANCE_FILTER_MAX_WINDOW)
+#error "CS_INITIATOR_DISTANCE_FILTER_WINDOW must be between 1 and 15"
+#endif
+
+// Scale of the median absolute deviation to the standard deviation of normal
+// noise, 1.4826, in 1/10000
+#define MAD_SCALE_X10000              14826
+// Likeliness is given in % and compared x10000
+#define LIKELINESS_PERCENT_SCALE      100u
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static int64_t get_double_median(int64_t *values, uint8_t count);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the filter.
+ *****************************************************************************/
+void distance_filter_init(distance_filter_t *filter)
+{
+  filter->next = 0u;
+  filter->count = 0u;
+}
+
+/******************************************************************************
+ * Feed a distance to the filter.
+ *****************************************************************************/
+int32_t distance_filter_update(distance_filter_t *filter, int32_t distance_mm)
+{
+  int64_t sorted[CS_INITIATOR_DISTANCE_FILTER_WINDOW];
+
+  filter->samples_mm[filter->next] = distance_mm;
+  filter->next = (uint8_t)((filter->next + 1u) % CS_INITIATOR_DISTANCE_FILTER_WINDOW);
+  if (filter->count < CS_INITIATOR_DISTANCE_FILTER_WINDOW) {
+    filter->count++;
+  }
+  for (uint8_t i = 0u; i < filter->count; i++) {
+    sorted[i] = filter->samples_mm[i];
+  }
+  // Medians are kept doubled so that they are exact for an even count.
+  int64_t median_x2 = get_double_median(sorted, filter->count);
+  int32_t median_mm = (int32_t)(median_x2 / 2);
+
+#if (CS_INITIATOR_DISTANCE_FILTER_TYPE == DISTANCE_FILTER_TYPE_HAMPEL)
+  // The doubled deviations of the sorted samples reuse the buffer.
+  for (uint8_t i = 0u; i < filter->count; i++) {
+    int64_t deviation_x2 = 2 * sorted[i] - median_x2;
+    sorted[i] = (deviation_x2 < 0) ? -deviation_x2 : deviation_x2;
+  }
+  int64_t mad_x4 = get_double_median(sorted, filter->count);
+  int64_t deviation_x2 = 2 * (int64_t)distance_mm - median_x2;
+  if (deviation_x2 < 0) {
+    deviation_x2 = -deviation_x2;
+  }
+  // |x - median| > k / 10 * 1.4826 * MAD, scaled by 4 * 100000
+  if (deviation_x2 * 2 * 100000 > (int64_t)CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10 * MAD_SCALE_X10000 * mad_x4) {
+    return median_mm;
+  }
+  return distance_mm;
+#else
+  return median_mm;
+#endif // CS_INITIATOR_DISTANCE_FILTER_TYPE
+}
+
+/******************************************************************************
+ * Check the likeliness of a result.
+ *****************************************************************************/
+bool distance_filter_check_likeliness(uint16_t likeliness_x10000)
+{
+  return (uint32_t)likeliness_x10000
+         >= (uint32_t)CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS * LIKELINESS_PERCENT_SCALE;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Sort the values in place and return twice their median, the sum of the two
+ * middle values for an even count. Insertion sort is the fastest for the few
+ * values of a window.
+ *****************************************************************************/
+static int64_t get_double_median(int64_t *values, uint8_t count)
+{
+  for (uint8_t i = 1u; i < count; i++) {
+    int64_t value = values[i];
+    uint8_t j = i;
+    while (j > 0u && values[j - 1u] > value) {
+      values[j] = values[j - 1u];
+      j--;
+    }
+    values[j] = value;
+  }
+  if ((count & 1u) != 0u) {
+    return 2 * values[count / 2u];
+  }
+  return values[count / 2u - 1u] + values[count / 2u];
+}
@@ -0,0 +1,94 @@
+/***************************************************************************//**
+ * @file
+ * @brief Robust fixed-point filter of the distances of a tag.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef DISTANCE_FILTER_H
+#define DISTANCE_FILTER_H
+
+// The filter has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Filter type selection values of CS_INITIATOR_DISTANCE_FILTER_TYPE
+#define DISTANCE_FILTER_TYPE_MEDIAN        0
+#define DISTANCE_FILTER_TYPE_HAMPEL        1
+
+/// Filter input selection values of CS_INITIATOR_DISTANCE_FILTER_INPUT
+#define DISTANCE_FILTER_INPUT_FILTERED     0
+#define DISTANCE_FILTER_INPUT_RAW          1
+
+/// Largest supported window
+#define DISTANCE_FILTER_MAX_WINDOW         15u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Distance filter of one quantity of an initiator instance
+typedef struct {
+  int32_t samples_mm[CS_INITIATOR_DISTANCE_FILTER_WINDOW]; ///< Ring buffer of the last inputs
+  uint8_t next;                                            ///< Index of the next sample
+  uint8_t count;                                           ///< Number of valid samples
+} distance_filter_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the filter.
+ * @param[out] filter Filter.
+ *****************************************************************************/
+void distance_filter_init(distance_filter_t *filter);
+
+/**************************************************************************//**
+ * Feed a distance to the filter.
+ * The median filter returns the median of the last
+ * CS_INITIATOR_DISTANCE_FILTER_WINDOW inputs. The Hampel filter returns the
+ * input unless it is further from that median than
+ * CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10 / 10 scaled median absolute
+ * deviations, in which case it returns the median. The run time is bounded by
+ * the window size.
+ * @param[in,out] filter      Filter.
+ * @param[in]     distance_mm Distance.
+ * @return Filtered distance.
+ *****************************************************************************/
+int32_t distance_filter_update(distance_filter_t *filter, int32_t distance_mm);
+
+/**************************************************************************//**
+ * Check the likeliness of a result against
+ * CS_INITIATOR_DISTANCE_FILTER_MIN_LIKELINESS.
+ * @param[in] likeliness_x10000 Likeliness scaled by 10000.
+ * @return true if the result may enter the filter.
+ *****************************************************************************/
+bool distance_filter_check_likeliness(uint16_t likeliness_x10000);
+
+#endif // DISTANCE_FILTER_H
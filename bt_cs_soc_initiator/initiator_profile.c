@@ -0,0 +1,189 @@
+/***************************************************************************//**
+ * @file
+ * @brief Initiator configuration profiles matched on tag address or name.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <ctype.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "initiator_profile.h"
+// Channel map presets and algorithm modes used in CS_INITIATOR_PROFILE_LIST
+#include "cs_initiator_client.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define AD_TYPE_SHORTENED_LOCAL_NAME  0x08u
+#define AD_TYPE_COMPLETE_LOCAL_NAME   0x09u
+#define PROFILE_COUNT                 (sizeof(profiles) / sizeof(profiles[0]))
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef struct {
+  bd_addr address;
+  char name[CS_INITIATOR_PROFILE_NAME_LEN + 1u];
+} name_entry_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static const char *find_name(const bd_addr *address);
+static bool match_prefix(const char *str, const char *prefix);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static const initiator_profile_t profiles[] = CS_INITIATOR_PROFILE_LIST;
+static name_entry_t names[CS_INITIATOR_PROFILE_NAME_CACHE_SIZE];
+static uint8_t name_next = 0u;
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Remember the advertised name of a device.
+ *****************************************************************************/
+void initiator_profile_on_advertisement(const bd_addr *address, const uint8_t *data, uint8_t len)
+{
+  uint8_t offset = 0u;
+
+  // Walk the AD structures: length, type, value
+  while (offset + 1u < len) {
+    uint8_t field_len = data[offset];
+    if (field_len == 0u || offset + 1u + field_len > len) {
+      return;
+    }
+    uint8_t type = data[offset + 1u];
+    if (type == AD_TYPE_COMPLETE_LOCAL_NAME || type == AD_TYPE_SHORTENED_LOCAL_NAME) {
+      name_entry_t *entry = NULL;
+      for (uint8_t i = 0u; i < CS_INITIATOR_PROFILE_NAME_CACHE_SIZE; i++) {
+        if (memcmp(names[i].address.addr, address->addr, sizeof(address->addr)) == 0) {
+          entry = &names[i];
+          break;
+        }
+      }
+      if (entry == NULL) {
+        entry = &names[name_next];
+        name_next = (uint8_t)((name_next + 1u) % CS_INITIATOR_PROFILE_NAME_CACHE_SIZE);
+        entry->address = *address;
+      }
+      uint8_t name_len = (uint8_t)(field_len - 1u);
+      if (name_len > CS_INITIATOR_PROFILE_NAME_LEN) {
+        name_len = CS_INITIATOR_PROFILE_NAME_LEN;
+      }
+      memcpy(entry->name, &data[offset + 2u], name_len);
+      entry->name[name_len] = '\0';
+      return;
+    }
+    offset = (uint8_t)(offset + 1u + field_len);
+  }
+}
+
+/******************************************************************************
+ * Find the first profile that matches a tag.
+ *****************************************************************************/
+const initiator_profile_t *initiator_profile_find(const bd_addr *address, uint8_t *index)
+{
+  char address_str[INITIATOR_PROFILE_ADDRESS_STR_LEN + 1u];
+  const char *name = find_name(address);
+
+  snprintf(address_str,
+           sizeof(address_str),
+           "%02X:%02X:%02X:%02X:%02X:%02X",
+           address->addr[5],
+           address->addr[4],
+           address->addr[3],
+           address->addr[2],
+           address->addr[1],
+           address->addr[0]);
+
+  for (uint8_t i = 0u; i < PROFILE_COUNT; i++) {
+    const initiator_profile_t *profile = &profiles[i];
+    if (profile->address == NULL && profile->name_prefix == NULL) {
+      continue;
+    }
+    if (profile->address != NULL && !match_prefix(address_str, profile->address)) {
+      continue;
+    }
+    if (profile->name_prefix != NULL
+        && (name == NULL || !match_prefix(name, profile->name_prefix))) {
+      continue;
+    }
+    *index = i;
+    return profile;
+  }
+  return NULL;
+}
+
+/******************************************************************************
+ * Get the number of profiles.
+ *****************************************************************************/
+uint8_t initiator_profile_get_count(void)
+{
+  uint8_t count = 0u;
+  for (uint8_t i = 0u; i < PROFILE_COUNT; i++) {
+    if (profiles[i].address != NULL || profiles[i].name_prefix != NULL) {
+      count++;
+    }
+  }
+  return count;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static const char *find_name(const bd_addr *address)
+{
+  for (uint8_t i = 0u; i < CS_INITIATOR_PROFILE_NAME_CACHE_SIZE; i++) {
+    if (names[i].name[0] != '\0'
+        && memcmp(names[i].address.addr, address->addr, sizeof(address->addr)) == 0) {
+      return names[i].name;
+    }
+  }
+  return NULL;
+}
+
+/******************************************************************************
+ * Case insensitive prefix match
+ *****************************************************************************/
+static bool match_prefix(const char *str, const char *prefix)
+{
+  while (*prefix != '\0') {
+    if (tolower((unsigned char)*str) != tolower((unsigned char)*prefix)) {
+      return false;
+    }
+    str++;
+    prefix++;
+  }
+  return true;
+}
@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file
+ * @brief Initiator configuration profiles matched on tag address or name.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef INITIATOR_PROFILE_H
+#define INITIATOR_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bt_api.h"
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Keep the default value of a profile setting
+#define INITIATOR_PROFILE_KEEP            0xFFu
+
+/// Length of an address string "XX:XX:XX:XX:XX:XX"
+#define INITIATOR_PROFILE_ADDRESS_STR_LEN 17u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Settings of a group of tags
+typedef struct {
+  const char *address;          ///< Address or address prefix, e.g. "00:0B:57", NULL for any
+  const char *name_prefix;      ///< Advertised name prefix, NULL for any
+  uint16_t procedure_interval;  ///< Procedure interval, 0 to keep the default
+  uint8_t channel_map_preset;   ///< Channel map preset or INITIATOR_PROFILE_KEEP
+  uint8_t algo_mode;            ///< RTL algorithm mode or INITIATOR_PROFILE_KEEP
+  uint8_t priority;             ///< Priority weight, 0 for CS_INITIATOR_PRIORITY_DEFAULT
+} initiator_profile_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Remember the advertised name of a device for the profile lookup.
+ * The last CS_INITIATOR_PROFILE_NAME_CACHE_SIZE names are kept.
+ * @param[in] address Bluetooth address of the advertiser.
+ * @param[in] data    Advertising or scan response data.
+ * @param[in] len     Length of the data.
+ *****************************************************************************/
+void initiator_profile_on_advertisement(const bd_addr *address, const uint8_t *data, uint8_t len);
+
+/**************************************************************************//**
+ * Find the first profile of CS_INITIATOR_PROFILE_LIST that matches a tag.
+ * A profile matches if both its address prefix and its name prefix match.
+ * A profile without address and name never matches.
+ * @param[in]  address Bluetooth address of the tag.
+ * @param[out] index   Index of the profile in the list.
+ * @return The profile, or NULL if none matches.
+ *****************************************************************************/
+const initiator_profile_t *initiator_profile_find(const bd_addr *address, uint8_t *index);
+
+/**************************************************************************//**
+ * Get the number of profiles.
+ * @return Number of profiles in CS_INITIATOR_PROFILE_LIST.
+ *****************************************************************************/
+uint8_t initiator_profile_get_count(void);
+
+#endif // INITIATOR_PROFILE_H
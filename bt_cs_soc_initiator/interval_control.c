@@ -0,0 +1,115 @@
+/***************************************************************************//**
+ * @file
+ * @brief Procedure interval control driven by tag movement.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "interval_control.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// Procedure interval limit of the Bluetooth Core specification
+#define PROCEDURE_INTERVAL_MAX        UINT16_MAX
+// 1000 mHz per Hz * 1000 ms per s / 1.25 ms per connection interval unit
+#define RATE_MHZ_DIVIDEND             800000u
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the controller.
+ *****************************************************************************/
+void interval_control_init(interval_control_t *ctrl, uint16_t base_interval)
+{
+  uint32_t max_interval = (uint32_t)base_interval * CS_INITIATOR_ADAPTIVE_MAX_FACTOR;
+
+  ctrl->base_interval = base_interval;
+  ctrl->max_interval = (max_interval < PROCEDURE_INTERVAL_MAX) ? (uint16_t)max_interval : PROCEDURE_INTERVAL_MAX;
+  ctrl->interval = base_interval;
+  ctrl->still_results = 0u;
+  ctrl->dwell_start_ms = 0u;
+}
+
+/******************************************************************************
+ * Feed the movement state of a result to the controller.
+ *****************************************************************************/
+bool interval_control_update(interval_control_t *ctrl, bool moving, uint32_t now_ms)
+{
+  uint16_t interval = ctrl->interval;
+
+  if (moving) {
+    ctrl->still_results = 0u;
+    ctrl->dwell_start_ms = now_ms;
+    interval = ctrl->base_interval;
+  } else {
+    if (ctrl->still_results < UINT8_MAX) {
+      ctrl->still_results++;
+    }
+    if (ctrl->still_results >= CS_INITIATOR_ADAPTIVE_STILL_RESULTS
+        && (uint32_t)(now_ms - ctrl->dwell_start_ms) >= CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS) {
+      // One doubling for every full run of still results since the last change
+      for (uint8_t steps = ctrl->still_results / CS_INITIATOR_ADAPTIVE_STILL_RESULTS;
+           steps > 0u && interval < ctrl->max_interval;
+           steps--) {
+        interval = (interval <= ctrl->max_interval / 2u) ? (uint16_t)(interval * 2u) : ctrl->max_interval;
+      }
+      ctrl->still_results = 0u;
+    }
+  }
+
+  if (interval == ctrl->interval) {
+    return false;
+  }
+  ctrl->interval = interval;
+  ctrl->dwell_start_ms = now_ms;
+  return true;
+}
+
+/******************************************************************************
+ * Get the current procedure interval.
+ *****************************************************************************/
+uint16_t interval_control_get_interval(const interval_control_t *ctrl)
+{
+  return ctrl->interval;
+}
+
+/******************************************************************************
+ * Get the procedure rate resulting from the current interval.
+ *****************************************************************************/
+uint32_t interval_control_get_rate_mhz(const interval_control_t *ctrl, uint16_t connection_interval)
+{
+  uint32_t events = (uint32_t)connection_interval * ctrl->interval;
+  if (events == 0u) {
+    return 0u;
+  }
+  return RATE_MHZ_DIVIDEND / events;
+}
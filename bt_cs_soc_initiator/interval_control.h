@@ -0,0 +1,90 @@
+/***************************************************************************//**
+ * @file
+ * @brief Procedure interval control driven by tag movement.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef INTERVAL_CONTROL_H
+#define INTERVAL_CONTROL_H
+
+// The controller has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Procedure interval controller of an initiator instance
+typedef struct {
+  uint16_t base_interval;     ///< Fastest interval, used while the tag moves
+  uint16_t max_interval;      ///< Slowest interval, used while the tag is still
+  uint16_t interval;          ///< Current interval in connection events
+  uint8_t still_results;      ///< Consecutive results without movement since the last change
+  uint32_t dwell_start_ms;    ///< Last change of the interval or last movement
+} interval_control_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the controller. The interval starts at the base interval.
+ * @param[out] ctrl          Controller.
+ * @param[in]  base_interval Procedure interval used while the tag moves.
+ *****************************************************************************/
+void interval_control_init(interval_control_t *ctrl, uint16_t base_interval);
+
+/**************************************************************************//**
+ * Feed the movement state of a result to the controller.
+ * A moving tag gets the base interval at once, a still tag gets its interval
+ * doubled for every CS_INITIATOR_ADAPTIVE_STILL_RESULTS results up to the
+ * maximum. The interval is lengthened at the earliest
+ * CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS after it last changed or the tag last
+ * moved, and then by every step earned since in one change.
+ * @param[in,out] ctrl   Controller.
+ * @param[in]     moving The tag moves, see motion_update().
+ * @param[in]     now_ms Time of the result in milliseconds.
+ * @return true if the interval has changed.
+ *****************************************************************************/
+bool interval_control_update(interval_control_t *ctrl, bool moving, uint32_t now_ms);
+
+/**************************************************************************//**
+ * Get the current procedure interval.
+ * @param[in] ctrl Controller.
+ * @return Procedure interval in connection events.
+ *****************************************************************************/
+uint16_t interval_control_get_interval(const interval_control_t *ctrl);
+
+/**************************************************************************//**
+ * Get the procedure rate resulting from the current interval.
+ * @param[in] ctrl                Controller.
+ * @param[in] connection_interval Connection interval in 1.25 ms units.
+ * @return Procedure rate in mHz.
+ *****************************************************************************/
+uint32_t interval_control_get_rate_mhz(const interval_control_t *ctrl, uint16_t connection_interval);
+
+#endif // INTERVAL_CONTROL_H
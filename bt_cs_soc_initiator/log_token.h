@@ -0,0 +1,178 @@
+/***************************************************************************//**
+ * @file
+ * @brief Tokenized logging: format strings are replaced by IDs on the wire.
+ * @note bt_cs_soc_initiator and bt_cs_soc_reflector have identical copies of
+ *       this file. Change both.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef LOG_TOKEN_H
+#define LOG_TOKEN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "sl_iostream.h"
+#include "app_log.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Replace the formatted output of app_log_debug(), app_log_info(),
+/// app_log_warning(), app_log_error() and app_log_critical() by token frames.
+/// The host rebuilds the text from the ELF file of the application with
+/// tools/log_token_decode.
+#ifndef APP_LOG_TOKENIZED
+#define APP_LOG_TOKENIZED                  0
+#endif
+
+/// Frame type of a token frame, after the types of output_frame.h
+#define LOG_TOKEN_FRAME_TYPE               0x04
+
+/// Largest size of the encoded arguments of one message, the frame stays
+/// below the 254 bytes of a single COBS block
+#define LOG_TOKEN_MAX_ARGS_LEN             160u
+
+/// Largest string argument including the terminating zero, longer strings are
+/// cut. Fits a formatted milestone record.
+#define LOG_TOKEN_MAX_STRING_LEN           144u
+
+#if APP_LOG_TOKENIZED
+
+/// Put the format string into the token section and send its offset in the
+/// section, the level and the arguments. Arguments are encoded by their type:
+/// strings with their terminating zero, 64 bit integers in 8 bytes, floating
+/// point values as float, and everything else in 4 bytes, little endian.
+#define LOG_TOKEN(level, ...)                                                       \
+  do {                                                                              \
+    if (log_token_is_enabled(level)) {                                              \
+      static const char log_token_format[]                                          \
+      __attribute__((section("log_tokens"), used)) = LOG_TOKEN_FORMAT(__VA_ARGS__); \
+      log_token_args_t log_token_args = { .len = 0u };                              \
+      LOG_TOKEN_CAT(LOG_TOKEN_PUT_, LOG_TOKEN_COUNT(__VA_ARGS__))(__VA_ARGS__)      \
+      log_token_write((level), log_token_format, &log_token_args);                  \
+    }                                                                               \
+  } while (0)
+
+#undef app_log_debug
+#undef app_log_info
+#undef app_log_warning
+#undef app_log_error
+#undef app_log_critical
+#define app_log_debug(...)                 LOG_TOKEN(APP_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define app_log_info(...)                  LOG_TOKEN(APP_LOG_LEVEL_INFO, __VA_ARGS__)
+#define app_log_warning(...)               LOG_TOKEN(APP_LOG_LEVEL_WARNING, __VA_ARGS__)
+#define app_log_error(...)                 LOG_TOKEN(APP_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define app_log_critical(...)              LOG_TOKEN(APP_LOG_LEVEL_CRITICAL, __VA_ARGS__)
+
+// Argument encoding by type
+#define LOG_TOKEN_PUT(arg)                           \
+  _Generic((arg),                                    \
+           char *: log_token_put_string,             \
+           const char *: log_token_put_string,       \
+           long long: log_token_put_u64,             \
+           unsigned long long: log_token_put_u64,    \
+           float: log_token_put_float,               \
+           double: log_token_put_float,              \
+           default: log_token_put_u32)(&log_token_args, (arg));
+
+// Format string and argument count of up to 12 arguments
+#define LOG_TOKEN_FORMAT(format, ...)      format
+#define LOG_TOKEN_COUNT(...) \
+  LOG_TOKEN_COUNT_(__VA_ARGS__, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_TOKEN_COUNT_(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, n, ...) n
+#define LOG_TOKEN_CAT(a, b)                LOG_TOKEN_CAT_(a, b)
+#define LOG_TOKEN_CAT_(a, b)               a##b
+#define LOG_TOKEN_PUT_1(f)
+#define LOG_TOKEN_PUT_2(f, a)              LOG_TOKEN_PUT(a)
+#define LOG_TOKEN_PUT_3(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_2(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_4(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_3(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_5(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_4(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_6(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_5(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_7(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_6(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_8(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_7(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_9(f, a, ...)         LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_8(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_10(f, a, ...)        LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_9(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_11(f, a, ...)        LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_10(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_12(f, a, ...)        LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_11(f, __VA_ARGS__)
+#define LOG_TOKEN_PUT_13(f, a, ...)        LOG_TOKEN_PUT(a) LOG_TOKEN_PUT_12(f, __VA_ARGS__)
+
+#endif // APP_LOG_TOKENIZED
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Encoded arguments of a message
+typedef struct {
+  uint8_t data[LOG_TOKEN_MAX_ARGS_LEN];
+  size_t len;
+} log_token_args_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Send the token frames to a second stream as well.
+ * @param[in] stream Second stream, NULL to stop.
+ *****************************************************************************/
+void log_token_set_mirror(sl_iostream_t *stream);
+
+/**************************************************************************//**
+ * Check the level against the filter threshold of app_log_config.h.
+ * @param[in] level APP_LOG_LEVEL_* value.
+ * @return true if messages of the level are sent.
+ *****************************************************************************/
+bool log_token_is_enabled(uint8_t level);
+
+/**************************************************************************//**
+ * Send a token frame to the app_log stream.
+ * Frame layout before the CRC-16/CCITT-FALSE and COBS encoding of
+ * output_frame.h:
+ * - type (1 byte) = LOG_TOKEN_FRAME_TYPE
+ * - level (1 byte)
+ * - token (2 bytes, little endian), offset of the format string in the
+ *   log_tokens section
+ * - arguments
+ * The frame is enclosed in delimiters so that it can be told apart from the
+ * text of other loggers on the same stream.
+ * @param[in] level  APP_LOG_LEVEL_* value.
+ * @param[in] format Format string in the log_tokens section.
+ * @param[in] args   Encoded arguments.
+ *****************************************************************************/
+void log_token_write(uint8_t level, const char *format, const log_token_args_t *args);
+
+/**************************************************************************//**
+ * Append an argument. Arguments that do not fit are dropped.
+ * @param[in,out] args  Encoded arguments.
+ * @param[in]     value Value.
+ *****************************************************************************/
+void log_token_put_u32(log_token_args_t *args, uint32_t value);
+void log_token_put_u64(log_token_args_t *args, uint64_t value);
+void log_token_put_float(log_token_args_t *args, double value);
+void log_token_put_string(log_token_args_t *args, const char *value);
+
+#endif // LOG_TOKEN_H
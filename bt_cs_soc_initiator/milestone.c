@@ -0,0 +1,202 @@
+/***************************************************************************//**
+ * @file
+ * @brief Per connection milestone timestamps from boot to the first result.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stdio.h>
+#include "milestone.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define CONN_HANDLE_FREE          0xFFu
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static const char *const milestone_names[MILESTONE_COUNT] = {
+  "scan", "open", "sec", "caps", "cfg", "en", "first"
+};
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static milestone_record_t *find_record(const milestone_tracker_t *tracker,
+                                       uint8_t conn_handle);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the tracker.
+ *****************************************************************************/
+void milestone_init(milestone_tracker_t *tracker,
+                    milestone_record_t *records,
+                    size_t record_count,
+                    uint32_t now_ms)
+{
+  tracker->records = records;
+  tracker->record_count = record_count;
+  tracker->boot_ms = now_ms;
+  tracker->scan_ms = now_ms;
+  for (size_t i = 0u; i < record_count; i++) {
+    records[i].conn_handle = CONN_HANDLE_FREE;
+    records[i].reached = 0u;
+  }
+}
+
+/******************************************************************************
+ * Note the start of scanning or advertising.
+ *****************************************************************************/
+void milestone_scan_started(milestone_tracker_t *tracker, uint32_t now_ms)
+{
+  tracker->scan_ms = now_ms;
+}
+
+/******************************************************************************
+ * Start the record of a new connection.
+ *****************************************************************************/
+milestone_record_t *milestone_open(milestone_tracker_t *tracker,
+                                   uint8_t conn_handle,
+                                   uint32_t now_ms)
+{
+  milestone_record_t *record = find_record(tracker, conn_handle);
+  if (record == NULL) {
+    record = find_record(tracker, CONN_HANDLE_FREE);
+  }
+  if (record == NULL) {
+    return NULL;
+  }
+  record->conn_handle = conn_handle;
+  record->reached = MILESTONE_BIT(MILESTONE_SCAN) | MILESTONE_BIT(MILESTONE_CONNECTION_OPENED);
+  record->time_ms[MILESTONE_SCAN] = tracker->scan_ms - tracker->boot_ms;
+  record->time_ms[MILESTONE_CONNECTION_OPENED] = now_ms - tracker->boot_ms;
+  return record;
+}
+
+/******************************************************************************
+ * Mark a milestone of a connection.
+ *****************************************************************************/
+bool milestone_mark(milestone_tracker_t *tracker,
+                    uint8_t conn_handle,
+                    milestone_id_t id,
+                    uint32_t now_ms)
+{
+  milestone_record_t *record = find_record(tracker, conn_handle);
+  if (record == NULL || id >= MILESTONE_COUNT
+      || (record->reached & MILESTONE_BIT(id)) != 0u) {
+    return false;
+  }
+  record->reached |= MILESTONE_BIT(id);
+  record->time_ms[id] = now_ms - tracker->boot_ms;
+  return true;
+}
+
+/******************************************************************************
+ * Get the record of a connection.
+ *****************************************************************************/
+const milestone_record_t *milestone_get(const milestone_tracker_t *tracker,
+                                        uint8_t conn_handle)
+{
+  return find_record(tracker, conn_handle);
+}
+
+/******************************************************************************
+ * Free the record of a connection.
+ *****************************************************************************/
+void milestone_close(milestone_tracker_t *tracker, uint8_t conn_handle)
+{
+  milestone_record_t *record = find_record(tracker, conn_handle);
+  if (record != NULL) {
+    record->conn_handle = CONN_HANDLE_FREE;
+    record->reached = 0u;
+  }
+}
+
+/******************************************************************************
+ * Format a record as one line.
+ *****************************************************************************/
+size_t milestone_format(const milestone_record_t *record, char *buf, size_t size)
+{
+  size_t len = 0u;
+  uint32_t previous_ms = 0u;
+  uint32_t last_ms = 0u;
+
+  if (size == 0u) {
+    return 0u;
+  }
+  buf[0] = '\0';
+  for (uint32_t id = 0u; id < MILESTONE_COUNT && len < size; id++) {
+    int written;
+    if ((record->reached & MILESTONE_BIT(id)) == 0u) {
+      written = snprintf(&buf[len], size - len, "%s=- ", milestone_names[id]);
+    } else if (id == MILESTONE_SCAN) {
+      written = snprintf(&buf[len], size - len, "%s=%lu ",
+                         milestone_names[id],
+                         (unsigned long)record->time_ms[id]);
+      previous_ms = last_ms = record->time_ms[id];
+    } else {
+      written = snprintf(&buf[len], size - len, "%s=+%lu ",
+                         milestone_names[id],
+                         (unsigned long)(record->time_ms[id] - previous_ms));
+      previous_ms = last_ms = record->time_ms[id];
+    }
+    if (written < 0) {
+      return len;
+    }
+    len += (size_t)written;
+  }
+  if (len < size) {
+    int written = snprintf(&buf[len], size - len, "total=%lu", (unsigned long)last_ms);
+    if (written > 0) {
+      len += (size_t)written;
+    }
+  }
+  return (len < size) ? len : size - 1u;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Find the record of a connection handle
+ *****************************************************************************/
+static milestone_record_t *find_record(const milestone_tracker_t *tracker,
+                                       uint8_t conn_handle)
+{
+  for (size_t i = 0u; i < tracker->record_count; i++) {
+    if (tracker->records[i].conn_handle == conn_handle) {
+      return &tracker->records[i];
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,71 @@
+/***************************************************************************//**
+ * @file
+ * @brief Movement detection of a tag from its results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "motion.h"
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the detector.
+ *****************************************************************************/
+void motion_init(motion_t *motion)
+{
+  motion->has_anchor = false;
+  motion->anchor_distance_mm = 0;
+}
+
+/******************************************************************************
+ * Feed a result to the detector.
+ *****************************************************************************/
+bool motion_update(motion_t *motion, int32_t distance_mm, uint32_t speed_mm_s)
+{
+  bool moving = (speed_mm_s > CS_INITIATOR_MOTION_SPEED_MM_S);
+
+  if (!motion->has_anchor) {
+    motion->has_anchor = true;
+    motion->anchor_distance_mm = distance_mm;
+  }
+  // A single distance step is not reliable at low rates, so the distance is
+  // compared to where the tag was when it moved last.
+  int32_t change_mm = distance_mm - motion->anchor_distance_mm;
+  if (change_mm > CS_INITIATOR_MOTION_DISTANCE_MM
+      || change_mm < -CS_INITIATOR_MOTION_DISTANCE_MM) {
+    moving = true;
+  }
+  if (moving) {
+    motion->anchor_distance_mm = distance_mm;
+  }
+  return moving;
+}
@@ -0,0 +1,69 @@
+/***************************************************************************//**
+ * @file
+ * @brief Movement detection of a tag from its results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef MOTION_H
+#define MOTION_H
+
+// The detector has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Movement detector of an initiator instance
+typedef struct {
+  bool has_anchor;            ///< anchor_distance_mm is valid
+  int32_t anchor_distance_mm; ///< Distance at the last detected movement
+} motion_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the detector.
+ * @param[out] motion Detector.
+ *****************************************************************************/
+void motion_init(motion_t *motion);
+
+/**************************************************************************//**
+ * Feed a result to the detector.
+ * The tag moves if its speed exceeds CS_INITIATOR_MOTION_SPEED_MM_S or its
+ * distance has changed by more than CS_INITIATOR_MOTION_DISTANCE_MM since the
+ * last movement.
+ * @param[in,out] motion      Detector.
+ * @param[in]     distance_mm Filtered distance.
+ * @param[in]     speed_mm_s  Absolute velocity, 0 if not measured.
+ * @return true if the tag moves.
+ *****************************************************************************/
+bool motion_update(motion_t *motion, int32_t distance_mm, uint32_t speed_mm_s);
+
+#endif // MOTION_H
@@ -0,0 +1,278 @@
+/***************************************************************************//**
+ * @file
+ * @brief Compact binary framing of measurement results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <string.h>
+#include "output_frame.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define CRC16_INIT                0xFFFFu
+#define CRC16_POLY                0x1021u
+#define RAW_MAX_LEN               (OUTPUT_FRAME_MEASUREMENT_LEN + OUTPUT_FRAME_CRC_LEN)
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint16_t crc16(const uint8_t *data, size_t len);
+static size_t put_u16(uint8_t *data, uint16_t value);
+static size_t put_u32(uint8_t *data, uint32_t value);
+static uint16_t get_u16(const uint8_t *data);
+static uint32_t get_u32(const uint8_t *data);
+static size_t finalize(uint8_t *raw, size_t raw_len, uint8_t *frame);
+static size_t cobs_encode(const uint8_t *data, size_t len, uint8_t *out);
+static size_t cobs_decode(const uint8_t *data, size_t len, uint8_t *out, size_t out_size);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Encode a measurement frame.
+ *****************************************************************************/
+size_t output_frame_encode_measurement(const output_frame_measurement_t *measurement,
+                                       uint8_t *frame)
+{
+  uint8_t raw[RAW_MAX_LEN];
+  size_t len = 0u;
+
+  raw[len++] = OUTPUT_FRAME_TYPE_MEASUREMENT;
+  raw[len++] = measurement->tag_index;
+  len += put_u16(&raw[len], measurement->ranging_counter);
+  len += put_u32(&raw[len], measurement->timestamp_ms);
+  len += put_u32(&raw[len], (uint32_t)measurement->distance_mm);
+  len += put_u16(&raw[len], measurement->likeliness);
+  len += put_u32(&raw[len], (uint32_t)measurement->rssi_distance_mm);
+
+  return finalize(raw, len, frame);
+}
+
+/******************************************************************************
+ * Encode a tag frame.
+ *****************************************************************************/
+size_t output_frame_encode_tag(const output_frame_tag_t *tag, uint8_t *frame)
+{
+  uint8_t raw[RAW_MAX_LEN];
+  size_t len = 0u;
+
+  raw[len++] = OUTPUT_FRAME_TYPE_TAG;
+  raw[len++] = tag->tag_index;
+  memcpy(&raw[len], tag->address, sizeof(tag->address));
+  len += sizeof(tag->address);
+
+  return finalize(raw, len, frame);
+}
+
+/******************************************************************************
+ * Encode a zone frame.
+ *****************************************************************************/
+size_t output_frame_encode_zone(const output_frame_zone_t *zone, uint8_t *frame)
+{
+  uint8_t raw[RAW_MAX_LEN];
+  size_t len = 0u;
+
+  raw[len++] = OUTPUT_FRAME_TYPE_ZONE;
+  raw[len++] = zone->tag_index;
+  len += put_u32(&raw[len], zone->timestamp_ms);
+  raw[len++] = zone->zone;
+  raw[len++] = zone->previous_zone;
+  len += put_u32(&raw[len], (uint32_t)zone->distance_mm);
+
+  return finalize(raw, len, frame);
+}
+
+/******************************************************************************
+ * Decode a frame received from the wire.
+ *****************************************************************************/
+bool output_frame_decode(const uint8_t *frame,
+                         size_t frame_len,
+                         uint8_t *type,
+                         output_frame_measurement_t *measurement,
+                         output_frame_tag_t *tag,
+                         output_frame_zone_t *zone)
+{
+  uint8_t raw[RAW_MAX_LEN];
+  size_t len = cobs_decode(frame, frame_len, raw, sizeof(raw));
+
+  if (len <= OUTPUT_FRAME_CRC_LEN) {
+    return false;
+  }
+  len -= OUTPUT_FRAME_CRC_LEN;
+  if (crc16(raw, len) != get_u16(&raw[len])) {
+    return false;
+  }
+
+  *type = raw[0];
+  switch (raw[0]) {
+    case OUTPUT_FRAME_TYPE_MEASUREMENT:
+      if (len != OUTPUT_FRAME_MEASUREMENT_LEN) {
+        return false;
+      }
+      measurement->tag_index = raw[1];
+      measurement->ranging_counter = get_u16(&raw[2]);
+      measurement->timestamp_ms = get_u32(&raw[4]);
+      measurement->distance_mm = (int32_t)get_u32(&raw[8]);
+      measurement->likeliness = get_u16(&raw[12]);
+      measurement->rssi_distance_mm = (int32_t)get_u32(&raw[14]);
+      return true;
+    case OUTPUT_FRAME_TYPE_TAG:
+      if (len != OUTPUT_FRAME_TAG_LEN) {
+        return false;
+      }
+      tag->tag_index = raw[1];
+      memcpy(tag->address, &raw[2], sizeof(tag->address));
+      return true;
+    case OUTPUT_FRAME_TYPE_ZONE:
+      if (len != OUTPUT_FRAME_ZONE_LEN) {
+        return false;
+      }
+      zone->tag_index = raw[1];
+      zone->timestamp_ms = get_u32(&raw[2]);
+      zone->zone = raw[6];
+      zone->previous_zone = raw[7];
+      zone->distance_mm = (int32_t)get_u32(&raw[8]);
+      return true;
+    default:
+      return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Append CRC, COBS encode and enclose the frame in delimiters
+ *****************************************************************************/
+static size_t finalize(uint8_t *raw, size_t raw_len, uint8_t *frame)
+{
+  size_t len = 0u;
+
+  raw_len += put_u16(&raw[raw_len], crc16(raw, raw_len));
+  frame[len++] = OUTPUT_FRAME_DELIMITER;
+  len += cobs_encode(raw, raw_len, &frame[len]);
+  frame[len++] = OUTPUT_FRAME_DELIMITER;
+  return len;
+}
+
+/******************************************************************************
+ * CRC-16/CCITT-FALSE
+ *****************************************************************************/
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = CRC16_INIT;
+  for (size_t i = 0u; i < len; i++) {
+    crc ^= (uint16_t)((uint16_t)data[i] << 8);
+    for (uint8_t bit = 0u; bit < 8u; bit++) {
+      crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ CRC16_POLY) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static size_t put_u16(uint8_t *data, uint16_t value)
+{
+  data[0] = (uint8_t)value;
+  data[1] = (uint8_t)(value >> 8);
+  return sizeof(value);
+}
+
+static size_t put_u32(uint8_t *data, uint32_t value)
+{
+  data[0] = (uint8_t)value;
+  data[1] = (uint8_t)(value >> 8);
+  data[2] = (uint8_t)(value >> 16);
+  data[3] = (uint8_t)(value >> 24);
+  return sizeof(value);
+}
+
+static uint16_t get_u16(const uint8_t *data)
+{
+  return (uint16_t)(data[0] | ((uint16_t)data[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *data)
+{
+  return (uint32_t)data[0]
+         | ((uint32_t)data[1] << 8)
+         | ((uint32_t)data[2] << 16)
+         | ((uint32_t)data[3] << 24);
+}
+
+/******************************************************************************
+ * Consistent overhead byte stuffing. Frames are shorter than 254 bytes, so
+ * a single overhead byte is always sufficient.
+ *****************************************************************************/
+static size_t cobs_encode(const uint8_t *data, size_t len, uint8_t *out)
+{
+  size_t code_pos = 0u;
+  size_t out_len = 1u;
+  uint8_t code = 1u;
+
+  for (size_t i = 0u; i < len; i++) {
+    if (data[i] == OUTPUT_FRAME_DELIMITER) {
+      out[code_pos] = code;
+      code_pos = out_len++;
+      code = 1u;
+    } else {
+      out[out_len++] = data[i];
+      code++;
+    }
+  }
+  out[code_pos] = code;
+  return out_len;
+}
+
+static size_t cobs_decode(const uint8_t *data, size_t len, uint8_t *out, size_t out_size)
+{
+  size_t in_pos = 0u;
+  size_t out_len = 0u;
+
+  while (in_pos < len) {
+    uint8_t code = data[in_pos++];
+    if (code == OUTPUT_FRAME_DELIMITER || (in_pos + code - 1u) > len) {
+      return 0u;
+    }
+    for (uint8_t i = 1u; i < code; i++) {
+      if (out_len >= out_size) {
+        return 0u;
+      }
+      out[out_len++] = data[in_pos++];
+    }
+    if (code < 0xFFu && in_pos < len) {
+      if (out_len >= out_size) {
+        return 0u;
+      }
+      out[out_len++] = OUTPUT_FRAME_DELIMITER;
+    }
+  }
+  return out_len;
+}
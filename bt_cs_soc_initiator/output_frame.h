@@ -0,0 +1,161 @@
+/***************************************************************************//**
+ * @file
+ * @brief Compact binary framing of measurement results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef OUTPUT_FRAME_H
+#define OUTPUT_FRAME_H
+
+// The codec has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Output format selection values of CS_INITIATOR_OUTPUT_FORMAT
+#define CS_INITIATOR_OUTPUT_FORMAT_TEXT    0
+#define CS_INITIATOR_OUTPUT_FORMAT_BINARY  1
+
+/// Frame delimiter on the wire
+#define OUTPUT_FRAME_DELIMITER             0x00
+
+/// Frame types
+#define OUTPUT_FRAME_TYPE_MEASUREMENT      0x01
+#define OUTPUT_FRAME_TYPE_TAG              0x02
+#define OUTPUT_FRAME_TYPE_ZONE             0x03
+// 0x04 is used by the log messages of log_token.h
+
+/// Payload sizes, little endian, without CRC
+#define OUTPUT_FRAME_MEASUREMENT_LEN       18u
+#define OUTPUT_FRAME_TAG_LEN               8u
+#define OUTPUT_FRAME_ZONE_LEN              12u
+#define OUTPUT_FRAME_CRC_LEN               2u
+
+/// Largest encoded frame including COBS overhead and both delimiters. The
+/// leading delimiter lets a receiver resynchronize after noise or after it
+/// was attached in the middle of a frame.
+#define OUTPUT_FRAME_MAX_LEN               (OUTPUT_FRAME_MEASUREMENT_LEN + OUTPUT_FRAME_CRC_LEN + 3u)
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Measurement frame content
+///
+/// Wire layout (little endian):
+/// - type (1 byte) = OUTPUT_FRAME_TYPE_MEASUREMENT
+/// - tag index (1 byte)
+/// - ranging counter (2 bytes)
+/// - timestamp in ms (4 bytes)
+/// - filtered distance in mm (4 bytes, signed)
+/// - likeliness x 10000 (2 bytes)
+/// - RSSI based distance in mm (4 bytes, signed)
+typedef struct {
+  uint8_t tag_index;
+  uint16_t ranging_counter;
+  uint32_t timestamp_ms;
+  int32_t distance_mm;
+  uint16_t likeliness;
+  int32_t rssi_distance_mm;
+} output_frame_measurement_t;
+
+/// Tag frame content, maps a tag index to a Bluetooth address
+///
+/// Wire layout:
+/// - type (1 byte) = OUTPUT_FRAME_TYPE_TAG
+/// - tag index (1 byte)
+/// - Bluetooth address (6 bytes, LSB first, all zero when disconnected)
+typedef struct {
+  uint8_t tag_index;
+  uint8_t address[6];
+} output_frame_tag_t;
+
+/// Zone frame content, the tag has left one distance zone and entered another
+///
+/// Wire layout (little endian):
+/// - type (1 byte) = OUTPUT_FRAME_TYPE_ZONE
+/// - tag index (1 byte)
+/// - timestamp in ms (4 bytes)
+/// - zone entered (1 byte)
+/// - zone left (1 byte, 0xFF for the first result of the tag)
+/// - filtered distance in mm (4 bytes, signed)
+typedef struct {
+  uint8_t tag_index;
+  uint32_t timestamp_ms;
+  uint8_t zone;
+  uint8_t previous_zone;
+  int32_t distance_mm;
+} output_frame_zone_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Encode a measurement frame.
+ * @param[in]  measurement Measurement to encode.
+ * @param[out] frame       Output buffer of at least OUTPUT_FRAME_MAX_LEN bytes.
+ * @return Number of bytes written including the delimiters.
+ *****************************************************************************/
+size_t output_frame_encode_measurement(const output_frame_measurement_t *measurement,
+                                       uint8_t *frame);
+
+/**************************************************************************//**
+ * Encode a tag frame.
+ * @param[in]  tag   Tag to encode.
+ * @param[out] frame Output buffer of at least OUTPUT_FRAME_MAX_LEN bytes.
+ * @return Number of bytes written including the delimiters.
+ *****************************************************************************/
+size_t output_frame_encode_tag(const output_frame_tag_t *tag, uint8_t *frame);
+
+/**************************************************************************//**
+ * Encode a zone frame.
+ * @param[in]  zone  Zone change to encode.
+ * @param[out] frame Output buffer of at least OUTPUT_FRAME_MAX_LEN bytes.
+ * @return Number of bytes written including the delimiters.
+ *****************************************************************************/
+size_t output_frame_encode_zone(const output_frame_zone_t *zone, uint8_t *frame);
+
+/**************************************************************************//**
+ * Decode a frame received from the wire.
+ * @param[in]  frame       Frame bytes between two delimiters.
+ * @param[in]  frame_len   Length of the frame.
+ * @param[out] type        Frame type.
+ * @param[out] measurement Decoded content if type is measurement.
+ * @param[out] tag         Decoded content if type is tag.
+ * @param[out] zone        Decoded content if type is zone.
+ * @return true if the frame is valid and its CRC matches.
+ *****************************************************************************/
+bool output_frame_decode(const uint8_t *frame,
+                         size_t frame_len,
+                         uint8_t *type,
+                         output_frame_measurement_t *measurement,
+                         output_frame_tag_t *tag,
+                         output_frame_zone_t *zone);
+
+#endif // OUTPUT_FRAME_H
@@ -0,0 +1,156 @@
+/***************************************************************************//**
+ * @file
+ * @brief Event driven output of the measurement results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include "output_policy.h"
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint8_t get_zone(const output_policy_config_t *config,
+                        uint8_t zone,
+                        int32_t distance_mm);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the policy of a new tag.
+ *****************************************************************************/
+void output_policy_init(output_policy_t *policy, const output_policy_config_t *config)
+{
+  policy->config = *config;
+  policy->has_output = false;
+  policy->last_distance_mm = 0;
+  policy->last_output_ms = 0u;
+  policy->zone = OUTPUT_POLICY_ZONE_UNKNOWN;
+}
+
+/******************************************************************************
+ * Check the settings.
+ *****************************************************************************/
+bool output_policy_check_config(const output_policy_config_t *config)
+{
+  if (config->zone_count > OUTPUT_POLICY_MAX_ZONES) {
+    return false;
+  }
+  for (uint8_t i = 1u; i < config->zone_count; i++) {
+    if (config->zone_mm[i] <= config->zone_mm[i - 1u]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/******************************************************************************
+ * Change the settings of a tag.
+ *****************************************************************************/
+void output_policy_set_config(output_policy_t *policy, const output_policy_config_t *config)
+{
+  policy->config = *config;
+  if (policy->zone != OUTPUT_POLICY_ZONE_UNKNOWN && policy->zone > config->zone_count) {
+    policy->zone = config->zone_count;
+  }
+}
+
+/******************************************************************************
+ * Feed a result to the policy.
+ *****************************************************************************/
+uint8_t output_policy_update(output_policy_t *policy,
+                             int32_t distance_mm,
+                             uint32_t now_ms,
+                             uint8_t *previous_zone)
+{
+  const output_policy_config_t *config = &policy->config;
+  uint8_t events = 0u;
+
+  if (!policy->has_output || config->deadband_mm == 0u) {
+    events |= OUTPUT_POLICY_EVENT_DISTANCE;
+  } else {
+    int32_t change_mm = distance_mm - policy->last_distance_mm;
+    uint32_t abs_change_mm = (change_mm < 0) ? (uint32_t)-change_mm : (uint32_t)change_mm;
+    if (abs_change_mm > config->deadband_mm
+        || (config->heartbeat_ms != 0u
+            && (uint32_t)(now_ms - policy->last_output_ms) >= config->heartbeat_ms)) {
+      events |= OUTPUT_POLICY_EVENT_DISTANCE;
+    }
+  }
+  if (events & OUTPUT_POLICY_EVENT_DISTANCE) {
+    policy->has_output = true;
+    policy->last_distance_mm = distance_mm;
+    policy->last_output_ms = now_ms;
+  }
+
+  if (config->zone_count > 0u) {
+    uint8_t zone = get_zone(config, policy->zone, distance_mm);
+    if (zone != policy->zone) {
+      *previous_zone = policy->zone;
+      policy->zone = zone;
+      events |= OUTPUT_POLICY_EVENT_ZONE;
+    }
+  }
+  return events;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Get the zone of a distance. Starting from the current zone, a boundary is
+ * crossed only when the distance is hysteresis_mm past it, so that noise
+ * around a boundary does not toggle the zone.
+ *****************************************************************************/
+static uint8_t get_zone(const output_policy_config_t *config,
+                        uint8_t zone,
+                        int32_t distance_mm)
+{
+  int32_t hysteresis_mm = (int32_t)config->hysteresis_mm;
+
+  if (zone == OUTPUT_POLICY_ZONE_UNKNOWN) {
+    // First result, no hysteresis
+    zone = 0u;
+    while (zone < config->zone_count && distance_mm >= (int32_t)config->zone_mm[zone]) {
+      zone++;
+    }
+    return zone;
+  }
+  while (zone < config->zone_count
+         && distance_mm >= (int32_t)config->zone_mm[zone] + hysteresis_mm) {
+    zone++;
+  }
+  while (zone > 0u
+         && distance_mm < (int32_t)config->zone_mm[zone - 1u] - hysteresis_mm) {
+    zone--;
+  }
+  return zone;
+}
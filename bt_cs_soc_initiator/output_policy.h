@@ -0,0 +1,118 @@
+/***************************************************************************//**
+ * @file
+ * @brief Event driven output of the measurement results.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef OUTPUT_POLICY_H
+#define OUTPUT_POLICY_H
+
+// The policy has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Maximum number of zone boundaries
+#define OUTPUT_POLICY_MAX_ZONES            4u
+
+/// Zone before the first result
+#define OUTPUT_POLICY_ZONE_UNKNOWN         0xFFu
+
+/// Events of output_policy_update()
+#define OUTPUT_POLICY_EVENT_DISTANCE       0x01u ///< Output the distance
+#define OUTPUT_POLICY_EVENT_ZONE           0x02u ///< The tag has changed zone
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Output policy settings of a tag
+///
+/// The zone boundaries divide the distance into zone_count + 1 rings:
+/// zone 0 is closer than zone_mm[0], zone n is between zone_mm[n - 1] and
+/// zone_mm[n], and zone zone_count is beyond the last boundary.
+typedef struct {
+  uint32_t deadband_mm;                      ///< Smallest change output, 0 outputs every result
+  uint32_t heartbeat_ms;                     ///< Output at least this often, 0 disables
+  uint32_t hysteresis_mm;                    ///< Distance past a boundary to change zone
+  uint8_t zone_count;                        ///< Number of zone boundaries, 0 disables zones
+  uint32_t zone_mm[OUTPUT_POLICY_MAX_ZONES]; ///< Zone boundaries in ascending order
+} output_policy_config_t;
+
+/// Output policy of an initiator instance
+typedef struct {
+  output_policy_config_t config;
+  bool has_output;            ///< last_distance_mm and last_output_ms are valid
+  int32_t last_distance_mm;   ///< Distance output last
+  uint32_t last_output_ms;    ///< Time of the last output
+  uint8_t zone;               ///< Current zone or OUTPUT_POLICY_ZONE_UNKNOWN
+} output_policy_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the policy of a new tag.
+ * @param[out] policy Policy.
+ * @param[in]  config Settings, copied.
+ *****************************************************************************/
+void output_policy_init(output_policy_t *policy, const output_policy_config_t *config);
+
+/**************************************************************************//**
+ * Check the settings.
+ * @param[in] config Settings.
+ * @return true if the zone count is within range and the boundaries ascend.
+ *****************************************************************************/
+bool output_policy_check_config(const output_policy_config_t *config);
+
+/**************************************************************************//**
+ * Change the settings of a tag. The zone is kept and corrected by the next
+ * result.
+ * @param[in,out] policy Policy.
+ * @param[in]     config Settings, copied.
+ *****************************************************************************/
+void output_policy_set_config(output_policy_t *policy, const output_policy_config_t *config);
+
+/**************************************************************************//**
+ * Feed a result to the policy.
+ * The distance is output on the first result, if it has changed by more than
+ * the deadband since it was output last, or if the heartbeat has expired.
+ * A zone change is reported if the distance is hysteresis_mm past a boundary.
+ * @param[in,out] policy        Policy.
+ * @param[in]     distance_mm   Filtered distance.
+ * @param[in]     now_ms        Time of the result.
+ * @param[out]    previous_zone Zone left if OUTPUT_POLICY_EVENT_ZONE is set,
+ *                              OUTPUT_POLICY_ZONE_UNKNOWN for the first result.
+ * @return OUTPUT_POLICY_EVENT_* bits, 0 if nothing is to be output.
+ *****************************************************************************/
+uint8_t output_policy_update(output_policy_t *policy,
+                             int32_t distance_mm,
+                             uint32_t now_ms,
+                             uint8_t *previous_zone);
+
+#endif // OUTPUT_POLICY_H
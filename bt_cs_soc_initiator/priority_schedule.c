@@ -0,0 +1,127 @@
+/***************************************************************************//**
+ * @file
+ * @brief Priority weighted procedure scheduling of the tags.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "priority_schedule.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// Procedure interval limit of the Bluetooth Core specification
+#define PROCEDURE_INTERVAL_MAX        UINT16_MAX
+#define PERMILLE                      1000u
+// Connection interval units per 5 ms
+#define UNITS_PER_5_MS                4u
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint16_t get_interval(uint16_t connection_interval, uint32_t airtime_permille);
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Distribute the CS airtime among the tags by their priority.
+ *****************************************************************************/
+void priority_schedule_compute(const priority_schedule_tag_t *tags,
+                               uint8_t count,
+                               uint16_t *intervals)
+{
+  uint32_t budget = CS_INITIATOR_PRIORITY_AIRTIME_PERCENT * (PERMILLE / 100u);
+  uint32_t priority_sum = 0u;
+  uint32_t clamped = 0u;
+  bool changed = true;
+
+  if (count > PRIORITY_SCHEDULE_MAX_TAGS) {
+    count = PRIORITY_SCHEDULE_MAX_TAGS;
+  }
+  for (uint8_t i = 0u; i < count; i++) {
+    priority_sum += tags[i].priority;
+  }
+
+  // Water filling: a tag whose share would need an interval below its base
+  // interval is fixed at the base, and the rest of the budget is shared again.
+  while (changed) {
+    changed = false;
+    for (uint8_t i = 0u; i < count; i++) {
+      if ((clamped & (1ul << i)) != 0u) {
+        continue;
+      }
+      uint32_t share = (priority_sum != 0u) ? (budget * tags[i].priority / priority_sum) : 0u;
+      intervals[i] = get_interval(tags[i].connection_interval, share);
+      if (intervals[i] <= tags[i].base_interval) {
+        intervals[i] = tags[i].base_interval;
+        clamped |= (1ul << i);
+        priority_sum -= tags[i].priority;
+        uint32_t used = priority_schedule_get_airtime_permille(tags[i].connection_interval,
+                                                               intervals[i]);
+        budget = (used < budget) ? (budget - used) : 0u;
+        changed = true;
+        break;
+      }
+    }
+  }
+}
+
+/******************************************************************************
+ * Get the airtime used by the procedures of a tag.
+ *****************************************************************************/
+uint32_t priority_schedule_get_airtime_permille(uint16_t connection_interval, uint16_t interval)
+{
+  // period [ms] = period_units * 5 / 4
+  uint32_t period_units = (uint32_t)interval * connection_interval;
+  if (period_units == 0u) {
+    return PERMILLE;
+  }
+  return (uint32_t)CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS * PERMILLE * UNITS_PER_5_MS
+         / (period_units * 5u);
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Get the shortest procedure interval that stays within an airtime share
+ *****************************************************************************/
+static uint16_t get_interval(uint16_t connection_interval, uint32_t airtime_permille)
+{
+  uint32_t divisor = airtime_permille * connection_interval * 5u;
+  if (divisor == 0u) {
+    return PROCEDURE_INTERVAL_MAX;
+  }
+  uint32_t interval = ((uint32_t)CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS * PERMILLE * UNITS_PER_5_MS
+                       + divisor - 1u) / divisor;
+  return (interval < PROCEDURE_INTERVAL_MAX) ? (uint16_t)interval : PROCEDURE_INTERVAL_MAX;
+}
@@ -0,0 +1,79 @@
+/***************************************************************************//**
+ * @file
+ * @brief Priority weighted procedure scheduling of the tags.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef PRIORITY_SCHEDULE_H
+#define PRIORITY_SCHEDULE_H
+
+// The scheduler has no SDK dependencies so that it can be built into host tools.
+#include <stdint.h>
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Maximum number of tags scheduled together
+#define PRIORITY_SCHEDULE_MAX_TAGS        32u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Scheduling input of a tag
+typedef struct {
+  uint8_t priority;               ///< Priority weight, 0 gets no share of the airtime
+  uint16_t connection_interval;   ///< Connection interval in 1.25 ms units
+  uint16_t base_interval;         ///< Shortest procedure interval, e.g. the optimized one
+} priority_schedule_tag_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Distribute the CS airtime among the tags by their priority.
+ * CS_INITIATOR_PRIORITY_AIRTIME_PERCENT of the airtime is shared in proportion
+ * to the priorities, one procedure taking CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS.
+ * A tag never gets a shorter interval than its base interval; the airtime it
+ * leaves unused is shared among the other tags.
+ * @param[in]  tags      Tags to schedule.
+ * @param[in]  count     Number of tags, at most PRIORITY_SCHEDULE_MAX_TAGS.
+ * @param[out] intervals Procedure interval of each tag in connection events.
+ *****************************************************************************/
+void priority_schedule_compute(const priority_schedule_tag_t *tags,
+                               uint8_t count,
+                               uint16_t *intervals);
+
+/**************************************************************************//**
+ * Get the airtime used by the procedures of a tag.
+ * @param[in] connection_interval Connection interval in 1.25 ms units.
+ * @param[in] interval            Procedure interval in connection events.
+ * @return Airtime in permille.
+ *****************************************************************************/
+uint32_t priority_schedule_get_airtime_permille(uint16_t connection_interval, uint16_t interval);
+
+#endif // PRIORITY_SCHEDULE_H
@@ -0,0 +1,130 @@
+/***************************************************************************//**
+ * @file
+ * @brief Execution time probes for the hot paths of the application.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Enable the probes. When disabled, PROFILER_BEGIN() and PROFILER_END()
+/// compile to nothing.
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE           0
+#endif
+
+/// Number of histogram bins. Bin n counts durations of 2^n to 2^(n+1) - 1
+/// ticks, the last bin also counts everything longer.
+#define PROFILER_HISTOGRAM_BINS   24u
+
+#if PROFILER_ENABLE
+#define PROFILER_BEGIN(probe)     uint32_t profiler_begin_##probe = profiler_get_ticks()
+#define PROFILER_END(probe)       profiler_record((probe), profiler_get_ticks() - profiler_begin_##probe)
+#else
+#define PROFILER_BEGIN(probe)
+#define PROFILER_END(probe)       ((void)0)
+#endif // PROFILER_ENABLE
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Probed code blocks. The list is shared by the applications, a probe that an
+/// application does not have stays empty.
+typedef enum {
+  PROFILER_PROBE_CS_ON_RESULT = 0,
+  PROFILER_PROBE_CS_ON_EXTENDED_RESULT,
+  PROFILER_PROBE_EXTENDED_RESULT_STEP,
+  PROFILER_PROBE_APP_PROCESS_ACTION,
+  PROFILER_PROBE_RTL_LOG_CALLBACK,
+  PROFILER_PROBE_ACP_COMMAND,
+  PROFILER_PROBE_COUNT
+} profiler_probe_t;
+
+/// Statistics of a probe in ticks, see profiler_get_tick_hz()
+typedef struct {
+  uint32_t count;
+  uint32_t min_ticks;
+  uint32_t max_ticks;
+  uint64_t total_ticks;
+  uint32_t histogram[PROFILER_HISTOGRAM_BINS];
+} profiler_stats_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Start the tick counter and clear the statistics.
+ *****************************************************************************/
+void profiler_init(void);
+
+/**************************************************************************//**
+ * Get the tick counter.
+ * On Cortex-M this is the DWT cycle counter, on the host the monotonic clock
+ * in nanoseconds. The counter wraps around, so only differences of it are
+ * meaningful.
+ *****************************************************************************/
+uint32_t profiler_get_ticks(void);
+
+/**************************************************************************//**
+ * Get the frequency of the tick counter in Hz.
+ *****************************************************************************/
+uint32_t profiler_get_tick_hz(void);
+
+/**************************************************************************//**
+ * Add a duration to the statistics of a probe.
+ * @param[in] probe Probe.
+ * @param[in] ticks Duration in ticks.
+ *****************************************************************************/
+void profiler_record(profiler_probe_t probe, uint32_t ticks);
+
+/**************************************************************************//**
+ * Get the statistics of a probe.
+ * @param[in]  probe Probe.
+ * @param[out] stats Statistics since init or the last reset.
+ *****************************************************************************/
+void profiler_get_stats(profiler_probe_t probe, profiler_stats_t *stats);
+
+/**************************************************************************//**
+ * Clear the statistics of a probe.
+ * @param[in] probe Probe.
+ *****************************************************************************/
+void profiler_reset(profiler_probe_t probe);
+
+/**************************************************************************//**
+ * Get the name of a probe.
+ * @param[in] probe Probe.
+ * @return Name of the probe, "unknown" for invalid probes.
+ *****************************************************************************/
+const char *profiler_get_probe_name(profiler_probe_t probe);
+
+#endif // PROFILER_H
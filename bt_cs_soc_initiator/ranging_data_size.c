@@ -0,0 +1,86 @@
+/***************************************************************************//**
+ * @file
+ * @brief Ranging data size of a CS procedure.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include "ranging_data_size.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// Channel 79 does not exist, the last bit of the map is reserved
+#define CHANNEL_COUNT                 79u
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Count the channels enabled in a channel map.
+ *****************************************************************************/
+uint8_t ranging_data_size_count_channels(const uint8_t *channel_map)
+{
+  uint8_t count = 0u;
+  for (uint8_t channel = 0u; channel < CHANNEL_COUNT; channel++) {
+    if ((channel_map[channel / 8u] & (1u << (channel % 8u))) != 0u) {
+      count++;
+    }
+  }
+  return count;
+}
+
+/******************************************************************************
+ * Get the number of antenna paths of a CS tone antenna configuration.
+ *****************************************************************************/
+uint8_t ranging_data_size_get_antenna_paths(uint8_t antenna_config_idx)
+{
+  // 1:1, 2:1, 3:1, 4:1, 1:2, 1:3, 1:4 and 2:2 antennas
+  static const uint8_t paths[] = { 1u, 2u, 3u, 4u, 2u, 3u, 4u, 4u };
+  return (antenna_config_idx < sizeof(paths)) ? paths[antenna_config_idx] : 1u;
+}
+
+/******************************************************************************
+ * Get the size of the ranging data of one procedure with one subevent.
+ *****************************************************************************/
+uint32_t ranging_data_size_get(const ranging_data_size_config_t *config,
+                               ranging_data_size_role_t role)
+{
+  uint32_t channels = (uint32_t)ranging_data_size_count_channels(config->channel_map)
+                      * config->channel_map_repetition;
+  uint32_t mode0_size = (role == RANGING_DATA_SIZE_INITIATOR)
+                        ? RANGING_DATA_SIZE_MODE0_INITIATOR : RANGING_DATA_SIZE_MODE0_REFLECTOR;
+  uint32_t main_mode_step = (config->main_mode == RANGING_DATA_SIZE_MODE_PBR)
+                            ? RANGING_DATA_SIZE_MODE2_STEP((uint32_t)config->antenna_paths)
+                            : RANGING_DATA_SIZE_MODE1_STEP;
+  uint32_t sub_mode = config->sub_mode
+                      ? RANGING_DATA_SIZE_SUB_MODE(channels, (uint32_t)config->main_mode_steps) : 0u;
+
+  return RANGING_DATA_SIZE(channels, (uint32_t)config->mode0_steps, mode0_size, main_mode_step, sub_mode);
+}
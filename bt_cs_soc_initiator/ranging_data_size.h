@@ -0,0 +1,107 @@
+/***************************************************************************//**
+ * @file
+ * @brief Ranging data size of a CS procedure.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef RANGING_DATA_SIZE_H
+#define RANGING_DATA_SIZE_H
+
+// The calculation has no SDK dependencies so that it can be built into host tools.
+#include <stdbool.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Main mode values, same as sl_bt_cs_mode_rtt and sl_bt_cs_mode_pbr
+#define RANGING_DATA_SIZE_MODE_RTT          1u
+#define RANGING_DATA_SIZE_MODE_PBR          2u
+
+/// Size of the channel map in bytes
+#define RANGING_DATA_SIZE_CHANNEL_MAP_LEN   10u
+
+/// Ranging data of one procedure with one subevent as a constant expression,
+/// see "Calculating the size of Maximum ranging data size" in the readme
+#define RANGING_DATA_SIZE_HEADER            (4u + 8u)
+#define RANGING_DATA_SIZE_MODE0_INITIATOR   6u
+#define RANGING_DATA_SIZE_MODE0_REFLECTOR   4u
+#define RANGING_DATA_SIZE_MODE1_STEP        (1u + 6u)
+#define RANGING_DATA_SIZE_MODE2_STEP(antenna_paths) \
+  (1u + 1u + ((antenna_paths) + 1u) * 4u)
+#define RANGING_DATA_SIZE_SUB_MODE(channels, main_mode_steps) \
+  (((main_mode_steps) != 0u) ? (RANGING_DATA_SIZE_MODE1_STEP * (channels) / (main_mode_steps)) : 0u)
+#define RANGING_DATA_SIZE(channels, mode0_steps, mode0_size, main_mode_step, sub_mode) \
+  (RANGING_DATA_SIZE_HEADER + (mode0_steps) * (mode0_size) + (channels) * (main_mode_step) + (sub_mode))
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Device whose ranging data is sized, the mode 0 results differ
+typedef enum {
+  RANGING_DATA_SIZE_INITIATOR = 0,
+  RANGING_DATA_SIZE_REFLECTOR
+} ranging_data_size_role_t;
+
+/// Procedure settings that determine the ranging data size
+typedef struct {
+  const uint8_t *channel_map;       ///< Channel map, RANGING_DATA_SIZE_CHANNEL_MAP_LEN bytes
+  uint8_t channel_map_repetition;   ///< Repetitions of the channel map per procedure
+  uint8_t mode0_steps;              ///< Mode 0 steps per subevent
+  uint8_t main_mode;                ///< RANGING_DATA_SIZE_MODE_PBR or RANGING_DATA_SIZE_MODE_RTT
+  bool sub_mode;                    ///< RTT sub mode is used
+  uint8_t main_mode_steps;          ///< Main mode steps per sub mode step
+  uint8_t antenna_paths;            ///< Antenna paths of the tone exchange, 1 to 4
+} ranging_data_size_config_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Count the channels enabled in a channel map.
+ * @param[in] channel_map Channel map, RANGING_DATA_SIZE_CHANNEL_MAP_LEN bytes.
+ * @return Number of channels.
+ *****************************************************************************/
+uint8_t ranging_data_size_count_channels(const uint8_t *channel_map);
+
+/**************************************************************************//**
+ * Get the number of antenna paths of a CS tone antenna configuration.
+ * @param[in] antenna_config_idx CS tone antenna configuration index, 0 to 7.
+ * @return Number of antenna paths.
+ *****************************************************************************/
+uint8_t ranging_data_size_get_antenna_paths(uint8_t antenna_config_idx);
+
+/**************************************************************************//**
+ * Get the size of the ranging data of one procedure with one subevent.
+ * @param[in] config Procedure settings.
+ * @param[in] role   Device whose ranging data is sized.
+ * @return Size in bytes.
+ *****************************************************************************/
+uint32_t ranging_data_size_get(const ranging_data_size_config_t *config,
+                               ranging_data_size_role_t role);
+
+#endif // RANGING_DATA_SIZE_H
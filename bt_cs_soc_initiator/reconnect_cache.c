@@ -0,0 +1,151 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 backed cache of reflector connection parameters.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include <string.h>
+#include "nvm3_default.h"
+#include "reconnect_cache.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define NVM3_KEY(index)               (RECONNECT_CACHE_NVM3_KEY_BASE + (nvm3_ObjectKey_t)(index))
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef struct {
+  reconnect_cache_entry_t entry;
+  bool valid;
+} cache_slot_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static cache_slot_t *find_slot(const bd_addr *address);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static cache_slot_t cache[CS_INITIATOR_RECONNECT_CACHE_SIZE];
+// Slot to be replaced next when the cache is full
+static uint8_t next_slot = 0u;
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Load the cache from NVM3.
+ *****************************************************************************/
+void reconnect_cache_init(void)
+{
+  bool free_slot_found = false;
+
+  next_slot = 0u;
+  for (uint8_t i = 0u; i < CS_INITIATOR_RECONNECT_CACHE_SIZE; i++) {
+    Ecode_t ec = nvm3_readData(nvm3_defaultHandle,
+                               NVM3_KEY(i),
+                               &cache[i].entry,
+                               sizeof(reconnect_cache_entry_t));
+    cache[i].valid = (ec == ECODE_NVM3_OK);
+    if (!cache[i].valid && !free_slot_found) {
+      next_slot = i;
+      free_slot_found = true;
+    }
+  }
+}
+
+/******************************************************************************
+ * Look up a reflector.
+ *****************************************************************************/
+sl_status_t reconnect_cache_find(const bd_addr *address,
+                                 uint32_t config_signature,
+                                 reconnect_cache_entry_t *entry)
+{
+  cache_slot_t *slot = find_slot(address);
+  if (slot == NULL || slot->entry.config_signature != config_signature) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  *entry = slot->entry;
+  return SL_STATUS_OK;
+}
+
+/******************************************************************************
+ * Store the parameters of a reflector.
+ *****************************************************************************/
+sl_status_t reconnect_cache_store(const reconnect_cache_entry_t *entry)
+{
+  cache_slot_t *slot = find_slot(&entry->address);
+  if (slot == NULL) {
+    slot = &cache[next_slot];
+    next_slot = (uint8_t)((next_slot + 1u) % CS_INITIATOR_RECONNECT_CACHE_SIZE);
+  } else if (memcmp(&slot->entry, entry, sizeof(reconnect_cache_entry_t)) == 0) {
+    // Unchanged, spare the flash
+    return SL_STATUS_OK;
+  }
+  slot->entry = *entry;
+  slot->valid = true;
+
+  Ecode_t ec = nvm3_writeData(nvm3_defaultHandle,
+                              NVM3_KEY(slot - cache),
+                              &slot->entry,
+                              sizeof(reconnect_cache_entry_t));
+  return (ec == ECODE_NVM3_OK) ? SL_STATUS_OK : SL_STATUS_FLASH_PROGRAM_FAILED;
+}
+
+/******************************************************************************
+ * Remove a reflector.
+ *****************************************************************************/
+void reconnect_cache_remove(const bd_addr *address)
+{
+  cache_slot_t *slot = find_slot(address);
+  if (slot != NULL) {
+    slot->valid = false;
+    (void)nvm3_deleteObject(nvm3_defaultHandle, NVM3_KEY(slot - cache));
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static cache_slot_t *find_slot(const bd_addr *address)
+{
+  for (uint8_t i = 0u; i < CS_INITIATOR_RECONNECT_CACHE_SIZE; i++) {
+    if (cache[i].valid
+        && memcmp(cache[i].entry.address.addr, address->addr, sizeof(address->addr)) == 0) {
+      return &cache[i];
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,96 @@
+/***************************************************************************//**
+ * @file
+ * @brief NVM3 backed cache of reflector connection parameters.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef RECONNECT_CACHE_H
+#define RECONNECT_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bt_api.h"
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// First NVM3 key of the cache, one object per entry
+#define RECONNECT_CACHE_NVM3_KEY_BASE     0x0C500u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Connection parameters learned from a reflector. The layout has no padding
+/// since entries are compared and stored as raw bytes.
+typedef struct {
+  uint32_t config_signature;
+  uint16_t conn_interval;
+  uint16_t proc_interval;
+  bd_addr address;
+  uint8_t remote_num_antennas;
+  uint8_t bonded;
+} reconnect_cache_entry_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Load the cache from NVM3.
+ *****************************************************************************/
+void reconnect_cache_init(void);
+
+/**************************************************************************//**
+ * Look up a reflector.
+ * @param[in]  address          Bluetooth address of the reflector.
+ * @param[in]  config_signature Signature of the configuration the entry was
+ *                              learned with. Entries of other configurations
+ *                              do not match.
+ * @param[out] entry            Cached parameters.
+ * @return SL_STATUS_OK or SL_STATUS_NOT_FOUND.
+ *****************************************************************************/
+sl_status_t reconnect_cache_find(const bd_addr *address,
+                                 uint32_t config_signature,
+                                 reconnect_cache_entry_t *entry);
+
+/**************************************************************************//**
+ * Store the parameters of a reflector. The least recently stored entry is
+ * replaced if the cache is full. NVM3 is only written if the entry changed.
+ * @param[in] entry Parameters to store.
+ * @return Status of the NVM3 write.
+ *****************************************************************************/
+sl_status_t reconnect_cache_store(const reconnect_cache_entry_t *entry);
+
+/**************************************************************************//**
+ * Remove a reflector, e.g. after its parameters turned out to be stale.
+ * @param[in] address Bluetooth address of the reflector.
+ *****************************************************************************/
+void reconnect_cache_remove(const bd_addr *address);
+
+#endif // RECONNECT_CACHE_H
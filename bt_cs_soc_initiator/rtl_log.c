@@ -1,6 +1,9 @@
 /***************************************************************************//**
  * @file
  * @brief RTL log.
+ * @note bt_cs_soc_initiator and bt_cs_ncp have copies of this file. They only
+ *       differ in the app_config.h include, which the NCP project does not
+ *       have. Change both.
  *******************************************************************************
  * # License
  * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
@@ -30,15 +33,32 @@
 
 #include "rtl_log.h"
 #include "cs_initiator_config.h"
+#include "app_config.h"
+#include "profiler.h"
 
 #if CS_INITIATOR_RTL_LOG
 #include "sl_rtl_clib_api.h"
 #include "sl_bt_version.h"
 #include "sli_bgapi_trace.h"
 #include "app_assert.h"
+#include "sl_common.h"
+#include "sl_power_manager.h"
+#include "sl_core.h"
 #include <stdio.h>
+#include <string.h>
 
 static void rtl_log_callback(uint8_t *log_data, size_t log_data_len);
+static void ring_clear(void);
+
+// Log data waiting for the trace channel. The RTL library and the main loop
+// may run in different contexts, so ring_head and ring_count are only read
+// and written in a critical section. The data itself is copied outside of it:
+// the callback only writes the free part and the main loop only reads the
+// buffered part.
+static uint8_t ring[RTL_LOG_RING_SIZE];
+static size_t ring_head = 0;
+static size_t ring_count = 0;
+static rtl_log_stats_t stats;
 
 void rtl_log_init(void)
 {
@@ -64,6 +84,9 @@ void rtl_log_init(void)
   app_assert(ret > 0 && ret < SL_RTL_LOG_SDK_VERSION_CHAR_ARRAY_MAX_SIZE,
              "failed to construct version string");
 
+  ring_clear();
+  memset(&stats, 0, sizeof(stats));
+
   ec = sl_rtl_log_init();
   app_assert(ec == SL_RTL_ERROR_SUCCESS, "sl_rtl_log_init failed");
 
@@ -75,18 +98,105 @@ void rtl_log_deinit(void)
 {
   enum sl_rtl_error_code ec = sl_rtl_log_deinit();
   app_assert(ec == SL_RTL_ERROR_SUCCESS, "sl_rtl_log_deinit failed");
+  // Buffered data is not sent once the trace is stopped
+  ring_clear();
+}
+
+void rtl_log_step(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  size_t head;
+  size_t count;
+
+  CORE_ENTER_ATOMIC();
+  head = ring_head;
+  count = ring_count;
+  CORE_EXIT_ATOMIC();
+  while (count > 0) {
+    size_t chunk_len = SL_MIN(count, RTL_LOG_RING_SIZE - head);
+    size_t log_written = sli_bgapi_trace_log_custom_message(&ring[head], chunk_len);
+    CORE_ENTER_ATOMIC();
+    ring_head = (ring_head + log_written) % RTL_LOG_RING_SIZE;
+    ring_count -= log_written;
+    head = ring_head;
+    count = ring_count;
+    if (count == 0) {
+      sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+    }
+    CORE_EXIT_ATOMIC();
+    if (log_written < chunk_len) {
+      // The trace channel is busy, continue on the next pass.
+      break;
+    }
+  }
+}
+
+void rtl_log_get_stats(rtl_log_stats_t *stats_out)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  *stats_out = stats;
+  CORE_EXIT_ATOMIC();
 }
 
 static void rtl_log_callback(uint8_t *log_data, size_t log_data_len)
 {
-  while (log_data_len > 0) {
-    size_t log_written = sli_bgapi_trace_log_custom_message(log_data, log_data_len);
-    log_data_len -= log_written;
-    log_data += log_written;
+  CORE_DECLARE_IRQ_STATE;
+  size_t tail;
+  size_t free_len;
+
+  PROFILER_BEGIN(PROFILER_PROBE_RTL_LOG_CALLBACK);
+  // This runs inside the estimation, so never wait for the trace channel here.
+  // A message that does not fit is dropped as a whole.
+  CORE_ENTER_ATOMIC();
+  tail = (ring_head + ring_count) % RTL_LOG_RING_SIZE;
+  free_len = RTL_LOG_RING_SIZE - ring_count;
+  if (log_data_len > free_len) {
+    stats.dropped_messages++;
+    stats.dropped_bytes += log_data_len;
   }
+  CORE_EXIT_ATOMIC();
+  if (log_data_len > free_len) {
+    PROFILER_END(PROFILER_PROBE_RTL_LOG_CALLBACK);
+    return;
+  }
+
+  // The main loop only frees space meanwhile, so the tail stays in place.
+  size_t first_len = SL_MIN(log_data_len, RTL_LOG_RING_SIZE - tail);
+  memcpy(&ring[tail], log_data, first_len);
+  memcpy(ring, &log_data[first_len], log_data_len - first_len);
+
+  CORE_ENTER_ATOMIC();
+  if (ring_count == 0) {
+    // Keep the MCU awake until the buffer is drained. The requirement is
+    // taken and released together with the count, so they cannot cross.
+    sl_power_manager_add_em_requirement(SL_POWER_MANAGER_EM1);
+  }
+  ring_count += log_data_len;
+  if (ring_count > stats.high_watermark) {
+    stats.high_watermark = ring_count;
+  }
+  CORE_EXIT_ATOMIC();
+  PROFILER_END(PROFILER_PROBE_RTL_LOG_CALLBACK);
+}
+
+static void ring_clear(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (ring_count > 0) {
+    sl_power_manager_remove_em_requirement(SL_POWER_MANAGER_EM1);
+  }
+  ring_head = 0;
+  ring_count = 0;
+  CORE_EXIT_ATOMIC();
 }
 
 #else // CS_INITIATOR_RTL_LOG
+#include <string.h>
+
 void rtl_log_init(void)
 {
 }
@@ -94,4 +204,13 @@ void rtl_log_init(void)
 void rtl_log_deinit(void)
 {
 }
+
+void rtl_log_step(void)
+{
+}
+
+void rtl_log_get_stats(rtl_log_stats_t *stats)
+{
+  memset(stats, 0, sizeof(*stats));
+}
 #endif // CS_INITIATOR_RTL_LOG
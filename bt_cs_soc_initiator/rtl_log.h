@@ -31,6 +31,21 @@
 #ifndef RTL_LOG_H
 #define RTL_LOG_H
 
+#include <stdint.h>
+
+// Size of the buffer between the RTL library and the trace channel in bytes.
+// RTL log messages that do not fit are dropped and counted.
+#ifndef RTL_LOG_RING_SIZE
+#define RTL_LOG_RING_SIZE 4096
+#endif
+
+// RTL log buffer statistics
+typedef struct {
+  uint32_t dropped_messages; ///< Messages dropped because the buffer was full
+  uint32_t dropped_bytes;    ///< Bytes of the dropped messages
+  uint32_t high_watermark;   ///< Highest number of bytes buffered at once
+} rtl_log_stats_t;
+
 /**************************************************************************//**
  * Initialize RTL logging globally.
  *****************************************************************************/
@@ -41,4 +56,17 @@ void rtl_log_init(void);
  *****************************************************************************/
 void rtl_log_deinit(void);
 
+/**************************************************************************//**
+ * Send buffered RTL log data to the trace channel.
+ * Call it from the main loop. It returns when the buffer is empty or the
+ * trace channel does not accept more data.
+ *****************************************************************************/
+void rtl_log_step(void);
+
+/**************************************************************************//**
+ * Get RTL log buffer statistics.
+ * @param[out] stats Statistics since the last rtl_log_init().
+ *****************************************************************************/
+void rtl_log_get_stats(rtl_log_stats_t *stats);
+
 #endif // RTL_LOG_H
@@ -0,0 +1,276 @@
+/***************************************************************************//**
+ * @file
+ * @brief Time-sliced rotation over a list of tags.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <stddef.h>
+#include <string.h>
+#include "tag_rotation.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define ADDRESS_STRING_LEN            17u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef enum {
+  TAG_STATE_IDLE,
+  TAG_STATE_CONNECTING,
+  TAG_STATE_CONNECTED
+} tag_state_t;
+
+typedef struct {
+  tag_rotation_stats_t stats;
+  uint32_t next_visit_ms;
+  tag_state_t state;
+  uint8_t connection;
+} tag_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static tag_t *find_tag(const bd_addr *address);
+static void schedule_next_visit(tag_t *tag, uint32_t now_ms);
+static bool parse_address(const char *str, bd_addr *address);
+static int8_t hex_to_nibble(char c);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static tag_t tags[CS_INITIATOR_TAG_ROTATION_MAX_TAGS];
+static uint8_t tag_count = 0u;
+static const char *const tag_list[] = CS_INITIATOR_TAG_ROTATION_LIST;
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Initialize the tag list.
+ *****************************************************************************/
+void tag_rotation_init(uint32_t now_ms)
+{
+  bd_addr address;
+
+  tag_count = 0u;
+  for (size_t i = 0u; i < sizeof(tag_list) / sizeof(tag_list[0]); i++) {
+    if (tag_list[i] != NULL && parse_address(tag_list[i], &address)) {
+      (void)tag_rotation_add(&address, now_ms);
+    }
+  }
+}
+
+/******************************************************************************
+ * Add a tag to the rotation.
+ *****************************************************************************/
+sl_status_t tag_rotation_add(const bd_addr *address, uint32_t now_ms)
+{
+  if (find_tag(address) != NULL) {
+    return SL_STATUS_ALREADY_EXISTS;
+  }
+  if (tag_count >= CS_INITIATOR_TAG_ROTATION_MAX_TAGS) {
+    return SL_STATUS_FULL;
+  }
+  tag_t *tag = &tags[tag_count++];
+  memset(tag, 0, sizeof(tag_t));
+  tag->stats.address = *address;
+  tag->next_visit_ms = now_ms;
+  tag->state = TAG_STATE_IDLE;
+  return SL_STATUS_OK;
+}
+
+/******************************************************************************
+ * Select the idle tag that has been waiting the longest.
+ *****************************************************************************/
+sl_status_t tag_rotation_select(uint32_t now_ms, bd_addr *address, uint32_t *wait_ms)
+{
+  tag_t *selected = NULL;
+  int32_t selected_due = 0;
+
+  for (uint8_t i = 0u; i < tag_count; i++) {
+    if (tags[i].state != TAG_STATE_IDLE) {
+      continue;
+    }
+    // Time since the tag became due, negative if it is not due yet.
+    // Wrap-around safe as long as the revisit period is below 24 days.
+    int32_t due = (int32_t)(now_ms - tags[i].next_visit_ms);
+    if (selected == NULL || due > selected_due) {
+      selected = &tags[i];
+      selected_due = due;
+    }
+  }
+  if (selected == NULL) {
+    return SL_STATUS_EMPTY;
+  }
+  if (selected_due < 0) {
+    *wait_ms = (uint32_t)(-selected_due);
+    return SL_STATUS_NOT_READY;
+  }
+  selected->state = TAG_STATE_CONNECTING;
+  *address = selected->stats.address;
+  return SL_STATUS_OK;
+}
+
+/******************************************************************************
+ * Mark a tag as connected.
+ *****************************************************************************/
+bool tag_rotation_on_connected(const bd_addr *address, uint8_t connection)
+{
+  tag_t *tag = find_tag(address);
+  if (tag == NULL) {
+    return false;
+  }
+  tag->state = TAG_STATE_CONNECTED;
+  tag->connection = connection;
+  return true;
+}
+
+/******************************************************************************
+ * Skip a selected tag that could not be connected.
+ *****************************************************************************/
+void tag_rotation_on_connect_failed(const bd_addr *address, uint32_t now_ms)
+{
+  tag_t *tag = find_tag(address);
+  // The tag may have been connected in the meantime
+  if (tag == NULL || tag->state != TAG_STATE_CONNECTING) {
+    return;
+  }
+  tag->stats.misses++;
+  schedule_next_visit(tag, now_ms);
+}
+
+/******************************************************************************
+ * Finish the visit on a closed connection.
+ *****************************************************************************/
+void tag_rotation_on_disconnected(uint8_t connection, uint32_t now_ms, bool complete)
+{
+  for (uint8_t i = 0u; i < tag_count; i++) {
+    if (tags[i].state == TAG_STATE_CONNECTED && tags[i].connection == connection) {
+      if (complete) {
+        tags[i].stats.visits++;
+        tags[i].stats.last_visit_ms = now_ms;
+      } else {
+        tags[i].stats.misses++;
+      }
+      schedule_next_visit(&tags[i], now_ms);
+      return;
+    }
+  }
+}
+
+/******************************************************************************
+ * Get the number of tags in the rotation.
+ *****************************************************************************/
+uint8_t tag_rotation_get_count(void)
+{
+  return tag_count;
+}
+
+/******************************************************************************
+ * Get the number of tags being visited.
+ *****************************************************************************/
+uint8_t tag_rotation_get_visiting_count(void)
+{
+  uint8_t count = 0u;
+  for (uint8_t i = 0u; i < tag_count; i++) {
+    if (tags[i].state != TAG_STATE_IDLE) {
+      count++;
+    }
+  }
+  return count;
+}
+
+/******************************************************************************
+ * Get the visit statistics of a tag.
+ *****************************************************************************/
+sl_status_t tag_rotation_get_stats(uint8_t index, tag_rotation_stats_t *stats)
+{
+  if (index >= tag_count) {
+    return SL_STATUS_INVALID_INDEX;
+  }
+  *stats = tags[index].stats;
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static void schedule_next_visit(tag_t *tag, uint32_t now_ms)
+{
+  tag->next_visit_ms = now_ms + CS_INITIATOR_TAG_ROTATION_REVISIT_MS;
+  tag->state = TAG_STATE_IDLE;
+}
+
+static tag_t *find_tag(const bd_addr *address)
+{
+  for (uint8_t i = 0u; i < tag_count; i++) {
+    if (memcmp(tags[i].stats.address.addr, address->addr, sizeof(address->addr)) == 0) {
+      return &tags[i];
+    }
+  }
+  return NULL;
+}
+
+/******************************************************************************
+ * Parse an address in "XX:XX:XX:XX:XX:XX" format, most significant byte first
+ *****************************************************************************/
+static bool parse_address(const char *str, bd_addr *address)
+{
+  if (strlen(str) != ADDRESS_STRING_LEN) {
+    return false;
+  }
+  for (uint8_t i = 0u; i < sizeof(address->addr); i++) {
+    const char *byte = &str[i * 3u];
+    int8_t high = hex_to_nibble(byte[0]);
+    int8_t low = hex_to_nibble(byte[1]);
+    if (high < 0 || low < 0 || (i < 5u && byte[2] != ':')) {
+      return false;
+    }
+    address->addr[5u - i] = (uint8_t)((high << 4) | low);
+  }
+  return true;
+}
+
+static int8_t hex_to_nibble(char c)
+{
+  if (c >= '0' && c <= '9') {
+    return (int8_t)(c - '0');
+  }
+  if (c >= 'a' && c <= 'f') {
+    return (int8_t)(c - 'a' + 10);
+  }
+  if (c >= 'A' && c <= 'F') {
+    return (int8_t)(c - 'A' + 10);
+  }
+  return -1;
+}
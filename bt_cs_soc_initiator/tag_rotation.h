@@ -0,0 +1,126 @@
+/***************************************************************************//**
+ * @file
+ * @brief Time-sliced rotation over a list of tags.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef TAG_ROTATION_H
+#define TAG_ROTATION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sl_status.h"
+#include "sl_bt_api.h"
+#include "app_config.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Visit statistics of a tag
+typedef struct {
+  bd_addr address;
+  uint32_t visits;
+  uint32_t misses;
+  uint32_t last_visit_ms;
+} tag_rotation_stats_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the tag list from CS_INITIATOR_TAG_ROTATION_LIST.
+ * Every tag is due immediately.
+ * @param[in] now_ms Current time in milliseconds.
+ *****************************************************************************/
+void tag_rotation_init(uint32_t now_ms);
+
+/**************************************************************************//**
+ * Add a tag to the rotation. The tag is due immediately.
+ * @param[in] address Bluetooth address of the tag.
+ * @param[in] now_ms  Current time in milliseconds.
+ * @return SL_STATUS_OK, SL_STATUS_ALREADY_EXISTS or SL_STATUS_FULL.
+ *****************************************************************************/
+sl_status_t tag_rotation_add(const bd_addr *address, uint32_t now_ms);
+
+/**************************************************************************//**
+ * Select the idle tag that has been waiting the longest for its visit.
+ * @param[in]  now_ms  Current time in milliseconds.
+ * @param[out] address Address of the selected tag.
+ * @param[out] wait_ms Time until the next tag is due if none is due yet.
+ * @return SL_STATUS_OK if a tag is due,
+ *         SL_STATUS_NOT_READY if the next tag is due after wait_ms,
+ *         SL_STATUS_EMPTY if there is no idle tag.
+ *****************************************************************************/
+sl_status_t tag_rotation_select(uint32_t now_ms, bd_addr *address, uint32_t *wait_ms);
+
+/**************************************************************************//**
+ * Mark a tag as connected.
+ * @param[in] address    Bluetooth address of the tag.
+ * @param[in] connection Connection handle.
+ * @return true if the tag is part of the rotation.
+ *****************************************************************************/
+bool tag_rotation_on_connected(const bd_addr *address, uint8_t connection);
+
+/**************************************************************************//**
+ * Skip a selected tag that could not be connected until its next visit.
+ * @param[in] address Bluetooth address of the tag.
+ * @param[in] now_ms  Current time in milliseconds.
+ *****************************************************************************/
+void tag_rotation_on_connect_failed(const bd_addr *address, uint32_t now_ms);
+
+/**************************************************************************//**
+ * Finish the visit on a closed connection and schedule the next visit of
+ * the tag after the revisit period.
+ * @param[in] connection Connection handle.
+ * @param[in] now_ms     Current time in milliseconds.
+ * @param[in] complete   All results of the visit have been collected.
+ *****************************************************************************/
+void tag_rotation_on_disconnected(uint8_t connection, uint32_t now_ms, bool complete);
+
+/**************************************************************************//**
+ * Get the number of tags in the rotation.
+ * @return Number of tags.
+ *****************************************************************************/
+uint8_t tag_rotation_get_count(void);
+
+/**************************************************************************//**
+ * Get the number of tags being visited, i.e. selected and not yet skipped, or
+ * connected. Each of them takes a connection slot.
+ * @return Number of tags being visited.
+ *****************************************************************************/
+uint8_t tag_rotation_get_visiting_count(void);
+
+/**************************************************************************//**
+ * Get the visit statistics of a tag.
+ * @param[in]  index Index of the tag.
+ * @param[out] stats Statistics of the tag.
+ * @return SL_STATUS_OK or SL_STATUS_INVALID_INDEX.
+ *****************************************************************************/
+sl_status_t tag_rotation_get_stats(uint8_t index, tag_rotation_stats_t *stats);
+
+#endif // TAG_ROTATION_H
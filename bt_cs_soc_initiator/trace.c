@@ -37,6 +37,8 @@
 #include "rtl_log.h"
 #include "app_log.h"
 #include "iostream_bgapi_trace.h"
+#include "log_token.h"
+#include "sl_iostream_handles.h"
 
 // Trace feedback LED
 #ifdef SL_CATALOG_SIMPLE_LED_PRESENT
@@ -62,6 +64,10 @@
 void trace_init(void)
 {
   app_log_iostream_set(iostream_bgapi_trace_handle);
+#if APP_LOG_TOKENIZED && CS_INITIATOR_UART_LOG
+  // Token frames replace the second text copy of trace.h on the console.
+  log_token_set_mirror(sl_iostream_recommended_console_stream);
+#endif
 #if (ALWAYS_INIT_TRACE == 0)
   if (!is_trace_requested()) {
     return;
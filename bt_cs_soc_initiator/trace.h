@@ -34,8 +34,9 @@
 #include "sl_component_catalog.h"
 #include "app_log.h"
 #include "app_config.h"
+#include "log_token.h"
 
-#if defined(SL_CATALOG_BGAPI_TRACE_PRESENT) && CS_INITIATOR_UART_LOG
+#if defined(SL_CATALOG_BGAPI_TRACE_PRESENT) && CS_INITIATOR_UART_LOG && !APP_LOG_TOKENIZED
 #include "sl_iostream.h"
 #include "sl_iostream_handles.h"
 // Forward messages to 2 iostream instances.
@@ -55,6 +56,15 @@
 #define log_error(...)   app_log_error(__VA_ARGS__)
 #endif
 
+// Measurement output stays text when the log messages are tokenized. It goes
+// to the stream of the token frames, so one capture holds both.
+#if APP_LOG_TOKENIZED
+#include "sl_iostream.h"
+#define log_output(...)  sl_iostream_printf(app_log_iostream_get(), __VA_ARGS__)
+#else
+#define log_output(...)  log_info(__VA_ARGS__)
+#endif
+
 /**************************************************************************//**
  * Initialize debug trace.
  *****************************************************************************/
@@ -31,6 +31,7 @@
 #include "sl_bt_api.h"
 #include "gatt_db.h"
 #include "app_log.h"
+#include "log_token.h"
 #include "app.h"
 #include "sl_main_init.h"
 #include "ble_peer_manager_connections.h"
@@ -38,6 +39,11 @@
 #include "cs_reflector.h"
 #include "cs_reflector_config.h"
 #include "cs_antenna.h"
+#include "milestone.h"
+
+#if APP_MILESTONES
+#include "sl_sleeptimer.h"
+#endif // APP_MILESTONES
 
 #ifdef SL_CATALOG_CS_REFLECTOR_CLI_PRESENT
 #include "cs_reflector_cli.h"
@@ -54,6 +60,13 @@ static cs_reflector_config_t cs_reflector_config = {
 
 static void on_connection_opened_with_initiator(uint8_t conn_handle);
 static void on_connection_closed(uint8_t conn_handle);
+#if APP_MILESTONES
+static uint32_t get_time_ms(void);
+static void log_milestones(uint8_t conn_handle);
+
+static milestone_tracker_t milestones;
+static milestone_record_t milestone_records[SL_BT_CONFIG_MAX_CONNECTIONS];
+#endif // APP_MILESTONES
 
 /**************************************************************************//**
  * Application Init
@@ -126,6 +139,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
       uint8_t address_type;
       int16_t min_tx_power_x10 = CS_REFLECTOR_MIN_TX_POWER_DBM * 10;
       int16_t max_tx_power_x10 = CS_REFLECTOR_MAX_TX_POWER_DBM * 10;
+      MILESTONE_INIT(&milestones, milestone_records, get_time_ms());
       sc = sl_bt_system_set_tx_power(min_tx_power_x10,
                                      max_tx_power_x10,
                                      &min_tx_power_x10,
@@ -154,6 +168,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 #ifndef SL_CATALOG_CS_REFLECTOR_CLI_PRESENT
         sc = ble_peer_manager_peripheral_start_advertising(SL_BT_INVALID_ADVERTISING_SET_HANDLE);
         app_assert_status(sc);
+        MILESTONE_SCAN_STARTED(&milestones, get_time_ms());
         app_log_info(APP_PREFIX "Advertising started for initiator connections..." APP_LOG_NL);
 #else
         app_log_info(APP_PREFIX "CS CLI is active." APP_LOG_NL);
@@ -203,6 +218,12 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_parameters_id:
       app_log_info(APP_INSTANCE_PREFIX "Connection parameters changed" APP_LOG_NL,
                    evt->data.evt_connection_parameters.connection);
+      if (evt->data.evt_connection_parameters.security_mode != sl_bt_connection_mode1_level1) {
+        MILESTONE_MARK(&milestones,
+                       evt->data.evt_connection_parameters.connection,
+                       MILESTONE_SECURITY,
+                       get_time_ms());
+      }
       break;
 
     // -------------------------------
@@ -246,9 +267,34 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
     case sl_bt_evt_connection_opened_id:
     case sl_bt_evt_connection_closed_id:
     case sl_bt_evt_advertiser_timeout_id:
-    case sl_bt_evt_cs_result_id:
     case sl_bt_evt_cs_result_continue_id:
+      break;
+
+    // -------------------------------
+    // The CS reflector component handles these, they are only timed here
+    case sl_bt_evt_cs_config_complete_id:
+      MILESTONE_MARK(&milestones,
+                     evt->data.evt_cs_config_complete.connection,
+                     MILESTONE_CS_CONFIG,
+                     get_time_ms());
+      break;
+
     case sl_bt_evt_cs_procedure_enable_complete_id:
+      MILESTONE_MARK(&milestones,
+                     evt->data.evt_cs_procedure_enable_complete.connection,
+                     MILESTONE_PROCEDURE_ENABLED,
+                     get_time_ms());
+      break;
+
+    case sl_bt_evt_cs_result_id:
+#if APP_MILESTONES
+      if (milestone_mark(&milestones,
+                         evt->data.evt_cs_result.connection,
+                         MILESTONE_FIRST_RESULT,
+                         get_time_ms())) {
+        log_milestones(evt->data.evt_cs_result.connection);
+      }
+#endif // APP_MILESTONES
       break;
 
     // -------------------------------
@@ -262,6 +308,7 @@ void sl_bt_on_event(sl_bt_msg_t *evt)
 static void on_connection_opened_with_initiator(uint8_t conn_handle)
 {
   sl_status_t sc;
+  MILESTONE_OPEN(&milestones, conn_handle, get_time_ms());
 #ifdef SL_CATALOG_CS_REFLECTOR_CLI_PRESENT
   cs_reflector_config.cs_sync_antenna = cs_reflector_cli_get_cs_sync_antenna_usage();
 #endif // SL_CATALOG_CS_REFLECTOR_CLI_PRESENT
@@ -277,6 +324,7 @@ static void on_connection_opened_with_initiator(uint8_t conn_handle)
   if (cs_reflector_get_active_instance_count() < SL_BT_CONFIG_MAX_CONNECTIONS) {
     sc = ble_peer_manager_peripheral_start_advertising(SL_BT_INVALID_ADVERTISING_SET_HANDLE);
     app_assert_status(sc);
+    MILESTONE_SCAN_STARTED(&milestones, get_time_ms());
     app_log_info(APP_PREFIX "Advertising restarted for new initiator connections..." APP_LOG_NL);
   }
 }
@@ -286,6 +334,14 @@ static void on_connection_closed(uint8_t conn_handle)
   sl_status_t sc;
   bool advertisement_should_be_restarted = false;
   uint8_t reflector_count = cs_reflector_get_active_instance_count();
+#if APP_MILESTONES
+  // Show where a connection without results got stuck
+  const milestone_record_t *record = milestone_get(&milestones, conn_handle);
+  if (record != NULL && (record->reached & MILESTONE_BIT(MILESTONE_FIRST_RESULT)) == 0u) {
+    log_milestones(conn_handle);
+  }
+  milestone_close(&milestones, conn_handle);
+#endif // APP_MILESTONES
   // If we are at the maximum capacity - it means that the advertisement is not running
   // Restart advertising for new initiator connections if we were at the limit
   if (reflector_count <= SL_BT_CONFIG_MAX_CONNECTIONS) {
@@ -302,10 +358,30 @@ static void on_connection_closed(uint8_t conn_handle)
   if (advertisement_should_be_restarted) {
     sc = ble_peer_manager_peripheral_start_advertising(SL_BT_INVALID_ADVERTISING_SET_HANDLE);
     app_assert_status(sc);
+    MILESTONE_SCAN_STARTED(&milestones, get_time_ms());
     app_log_info(APP_PREFIX "Advertising restarted for new initiator connections..." APP_LOG_NL);
   }
 }
 
+#if APP_MILESTONES
+static uint32_t get_time_ms(void)
+{
+  uint64_t ms = 0u;
+  (void)sl_sleeptimer_tick64_to_ms(sl_sleeptimer_get_tick_count64(), &ms);
+  return (uint32_t)ms;
+}
+
+static void log_milestones(uint8_t conn_handle)
+{
+  char record_str[MILESTONE_RECORD_STR_LEN];
+  const milestone_record_t *record = milestone_get(&milestones, conn_handle);
+  if (record != NULL) {
+    (void)milestone_format(record, record_str, sizeof(record_str));
+    app_log_info(APP_INSTANCE_PREFIX "Milestones [ms]: %s" APP_LOG_NL, conn_handle, record_str);
+  }
+}
+#endif // APP_MILESTONES
+
 void ble_peer_manager_on_event_reflector(const ble_peer_manager_evt_type_t *event)
 {
   switch (event->evt_id) {
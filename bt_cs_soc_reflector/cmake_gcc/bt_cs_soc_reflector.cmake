@@ -204,7 +204,9 @@ add_library(slc OBJECT
     "../autogen/sl_iostream_handles.c"
     "../autogen/sl_iostream_init_eusart_instances.c"
     "../autogen/sl_power_manager_handler.c"
+    "../log_token.c"
     "../main.c"
+    "../milestone.c"
     "../sl_gatt_service_device_information_override.c"
 )
 
@@ -0,0 +1,225 @@
+/***************************************************************************//**
+ * @file
+ * @brief Tokenized logging: format strings are replaced by IDs on the wire.
+ * @note bt_cs_soc_initiator and bt_cs_soc_reflector have identical copies of
+ *       this file. Change both.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <string.h>
+#include "log_token.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define FRAME_DELIMITER               0x00
+#define CRC16_INIT                    0xFFFFu
+#define CRC16_POLY                    0x1021u
+#define CRC_LEN                       2u
+#define HEADER_LEN                    4u
+#define RAW_MAX_LEN                   (HEADER_LEN + LOG_TOKEN_MAX_ARGS_LEN + CRC_LEN)
+// Leading delimiter, COBS overhead and trailing delimiter
+#define FRAME_MAX_LEN                 (RAW_MAX_LEN + 3u)
+
+// Start of the token section, defined by the linker. Weak so that the module
+// links when no message is tokenized.
+extern const char __start_log_tokens[] __attribute__((weak));
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint16_t crc16(const uint8_t *data, size_t len);
+static size_t cobs_encode(const uint8_t *data, size_t len, uint8_t *out);
+static void put(log_token_args_t *args, const void *value, size_t len);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static sl_iostream_t *mirror_stream = NULL;
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+/******************************************************************************
+ * Send the token frames to a second stream as well.
+ *****************************************************************************/
+void log_token_set_mirror(sl_iostream_t *stream)
+{
+  mirror_stream = stream;
+}
+
+/******************************************************************************
+ * Check the level against the filter threshold of app_log_config.h.
+ *****************************************************************************/
+bool log_token_is_enabled(uint8_t level)
+{
+#if !APP_LOG_ENABLE
+  (void)level;
+  return false;
+#elif defined(APP_LOG_LEVEL_FILTER_ENABLE) && APP_LOG_LEVEL_FILTER_ENABLE
+  return level >= APP_LOG_LEVEL_FILTER_THRESHOLD;
+#else
+  (void)level;
+  return true;
+#endif
+}
+
+/******************************************************************************
+ * Send a token frame to the app_log stream.
+ *****************************************************************************/
+void log_token_write(uint8_t level, const char *format, const log_token_args_t *args)
+{
+  uint8_t raw[RAW_MAX_LEN];
+  uint8_t frame[FRAME_MAX_LEN];
+  uintptr_t token = (uintptr_t)(format - __start_log_tokens);
+  size_t len = 0u;
+
+  // 64 kB of format strings
+  if (token > UINT16_MAX) {
+    return;
+  }
+  raw[len++] = LOG_TOKEN_FRAME_TYPE;
+  raw[len++] = level;
+  raw[len++] = (uint8_t)token;
+  raw[len++] = (uint8_t)(token >> 8);
+  memcpy(&raw[len], args->data, args->len);
+  len += args->len;
+  uint16_t crc = crc16(raw, len);
+  raw[len++] = (uint8_t)crc;
+  raw[len++] = (uint8_t)(crc >> 8);
+
+  size_t frame_len = 0u;
+  frame[frame_len++] = FRAME_DELIMITER;
+  frame_len += cobs_encode(raw, len, &frame[frame_len]);
+  frame[frame_len++] = FRAME_DELIMITER;
+  (void)sl_iostream_write(app_log_iostream_get(), frame, frame_len);
+  if (mirror_stream != NULL) {
+    (void)sl_iostream_write(mirror_stream, frame, frame_len);
+  }
+}
+
+/******************************************************************************
+ * Append an argument.
+ *****************************************************************************/
+void log_token_put_u32(log_token_args_t *args, uint32_t value)
+{
+  uint8_t data[sizeof(value)];
+  for (size_t i = 0u; i < sizeof(value); i++) {
+    data[i] = (uint8_t)(value >> (8u * i));
+  }
+  put(args, data, sizeof(data));
+}
+
+void log_token_put_u64(log_token_args_t *args, uint64_t value)
+{
+  uint8_t data[sizeof(value)];
+  for (size_t i = 0u; i < sizeof(value); i++) {
+    data[i] = (uint8_t)(value >> (8u * i));
+  }
+  put(args, data, sizeof(data));
+}
+
+void log_token_put_float(log_token_args_t *args, double value)
+{
+  float single = (float)value;
+  uint32_t bits;
+  memcpy(&bits, &single, sizeof(bits));
+  log_token_put_u32(args, bits);
+}
+
+void log_token_put_string(log_token_args_t *args, const char *value)
+{
+  size_t max_len = sizeof(args->data) - args->len;
+  size_t len = 0u;
+
+  if (max_len > LOG_TOKEN_MAX_STRING_LEN) {
+    max_len = LOG_TOKEN_MAX_STRING_LEN;
+  }
+  if (max_len == 0u) {
+    return;
+  }
+  // Cut the string, the terminating zero is always sent.
+  while (value != NULL && len < max_len - 1u && value[len] != '\0') {
+    args->data[args->len + len] = (uint8_t)value[len];
+    len++;
+  }
+  args->data[args->len + len] = '\0';
+  args->len += len + 1u;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static void put(log_token_args_t *args, const void *value, size_t len)
+{
+  if (args->len + len <= sizeof(args->data)) {
+    memcpy(&args->data[args->len], value, len);
+    args->len += len;
+  }
+}
+
+/******************************************************************************
+ * CRC-16/CCITT-FALSE, as in output_frame.c
+ *****************************************************************************/
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = CRC16_INIT;
+  for (size_t i = 0u; i < len; i++) {
+    crc ^= (uint16_t)((uint16_t)data[i] << 8);
+    for (uint8_t bit = 0u; bit < 8u; bit++) {
+      crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ CRC16_POLY) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+/******************************************************************************
+ * Consistent overhead byte stuffing. Frames are shorter than 254 bytes, so
+ * a single overhead byte is always sufficient.
+ *****************************************************************************/
+static size_t cobs_encode(const uint8_t *data, size_t len, uint8_t *out)
+{
+  size_t code_pos = 0u;
+  size_t out_len = 1u;
+  uint8_t code = 1u;
+
+  for (size_t i = 0u; i < len; i++) {
+    if (data[i] == FRAME_DELIMITER) {
+      out[code_pos] = code;
+      code_pos = out_len++;
+      code = 1u;
+    } else {
+      out[out_len++] = data[i];
+      code++;
+    }
+  }
+  out[code_pos] = code;
+  return out_len;
+}
@@ -0,0 +1,174 @@
+/***************************************************************************//**
+ * @file
+ * @brief Per connection milestone timestamps from boot to the first result.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+#ifndef MILESTONE_H
+#define MILESTONE_H
+
+// The tracker has no SDK dependencies so that it can be built into host tools.
+// Timestamps are passed in by the caller.
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+/// Enable milestone tracking. When disabled, the MILESTONE_* macros compile
+/// to nothing and no tracker state is needed.
+#ifndef APP_MILESTONES
+#define APP_MILESTONES                     0
+#endif
+
+/// Bit of a milestone in milestone_record_t.reached
+#define MILESTONE_BIT(id)                  (1u << (id))
+
+/// Length of a formatted record including the terminating zero
+#define MILESTONE_RECORD_STR_LEN           136u
+
+#if APP_MILESTONES
+#define MILESTONE_INIT(tracker, records, now_ms) \
+  milestone_init((tracker), (records), sizeof(records) / sizeof((records)[0]), (now_ms))
+#define MILESTONE_SCAN_STARTED(tracker, now_ms)          milestone_scan_started((tracker), (now_ms))
+#define MILESTONE_OPEN(tracker, conn_handle, now_ms)     (void)milestone_open((tracker), (conn_handle), (now_ms))
+#define MILESTONE_MARK(tracker, conn_handle, id, now_ms) (void)milestone_mark((tracker), (conn_handle), (id), (now_ms))
+#else
+#define MILESTONE_INIT(tracker, records, now_ms)         ((void)0)
+#define MILESTONE_SCAN_STARTED(tracker, now_ms)          ((void)0)
+#define MILESTONE_OPEN(tracker, conn_handle, now_ms)     ((void)0)
+#define MILESTONE_MARK(tracker, conn_handle, id, now_ms) ((void)0)
+#endif // APP_MILESTONES
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Milestones of a connection in the order they are expected
+typedef enum {
+  MILESTONE_SCAN = 0,          ///< Last scan or advertising start before the connection
+  MILESTONE_CONNECTION_OPENED, ///< Connection opened
+  MILESTONE_SECURITY,          ///< Link encrypted
+  MILESTONE_CAPABILITIES,      ///< Remote CS capabilities read
+  MILESTONE_CS_CONFIG,         ///< CS configuration complete
+  MILESTONE_PROCEDURE_ENABLED, ///< CS procedures enabled, RAS set up
+  MILESTONE_FIRST_RESULT,      ///< First result of the connection
+  MILESTONE_COUNT
+} milestone_id_t;
+
+/// Milestones of one connection
+typedef struct {
+  uint8_t conn_handle;
+  uint8_t reached;                      ///< Bit mask of reached milestones
+  uint32_t time_ms[MILESTONE_COUNT];    ///< Time since boot
+} milestone_record_t;
+
+/// Milestone tracker
+typedef struct {
+  milestone_record_t *records;
+  size_t record_count;
+  uint32_t boot_ms;
+  uint32_t scan_ms;
+} milestone_tracker_t;
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Initialize the tracker.
+ * @param[out] tracker      Tracker to initialize.
+ * @param[in]  records      Record storage, one record per connection.
+ * @param[in]  record_count Number of records.
+ * @param[in]  now_ms       Time of the boot event.
+ *****************************************************************************/
+void milestone_init(milestone_tracker_t *tracker,
+                    milestone_record_t *records,
+                    size_t record_count,
+                    uint32_t now_ms);
+
+/**************************************************************************//**
+ * Note the start of scanning or advertising.
+ * @param[in] tracker Tracker.
+ * @param[in] now_ms  Current time.
+ *****************************************************************************/
+void milestone_scan_started(milestone_tracker_t *tracker, uint32_t now_ms);
+
+/**************************************************************************//**
+ * Start the record of a new connection.
+ * @param[in] tracker     Tracker.
+ * @param[in] conn_handle Connection handle.
+ * @param[in] now_ms      Time the connection has been opened.
+ * @return Record of the connection, NULL if no record is free.
+ *****************************************************************************/
+milestone_record_t *milestone_open(milestone_tracker_t *tracker,
+                                   uint8_t conn_handle,
+                                   uint32_t now_ms);
+
+/**************************************************************************//**
+ * Mark a milestone of a connection. Only the first occurrence is kept.
+ * @param[in] tracker     Tracker.
+ * @param[in] conn_handle Connection handle.
+ * @param[in] id          Milestone.
+ * @param[in] now_ms      Current time.
+ * @return true if the milestone has been reached for the first time.
+ *****************************************************************************/
+bool milestone_mark(milestone_tracker_t *tracker,
+                    uint8_t conn_handle,
+                    milestone_id_t id,
+                    uint32_t now_ms);
+
+/**************************************************************************//**
+ * Get the record of a connection.
+ * @param[in] tracker     Tracker.
+ * @param[in] conn_handle Connection handle.
+ * @return Record of the connection, NULL if not tracked.
+ *****************************************************************************/
+const milestone_record_t *milestone_get(const milestone_tracker_t *tracker,
+                                        uint8_t conn_handle);
+
+/**************************************************************************//**
+ * Free the record of a connection.
+ * @param[in] tracker     Tracker.
+ * @param[in] conn_handle Connection handle.
+ *****************************************************************************/
+void milestone_close(milestone_tracker_t *tracker, uint8_t conn_handle);
+
+/**************************************************************************//**
+ * Format a record as one line.
+ * The scan start is given relative to boot, every other milestone relative to
+ * the previous reached one, followed by the total from boot. Milestones not
+ * reached are shown as "-".
+ * Example: "scan=12 open=+340 sec=+85 caps=+40 cfg=+31 en=+210 first=+95 total=813"
+ * @param[in]  record Record to format.
+ * @param[out] buf    Output buffer of at least MILESTONE_RECORD_STR_LEN bytes.
+ * @param[in]  size   Size of the output buffer.
+ * @return Length of the string without the terminating zero.
+ *****************************************************************************/
+size_t milestone_format(const milestone_record_t *record, char *buf, size_t size);
+
+#endif // MILESTONE_H
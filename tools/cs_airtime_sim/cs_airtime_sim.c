@@ -0,0 +1,759 @@
+/***************************************************************************//**
+ * @file
+ * @brief Discrete-event simulator of CS airtime and measurement rates.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -o cs_airtime_sim cs_airtime_sim.c -lm
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define MAX_TAGS                      32u
+#define MAX_ROTATION_TAGS             64u     // CS_INITIATOR_TAG_ROTATION_MAX_TAGS
+#define CONN_INTERVAL_UNIT_US         1250.0
+
+// CS timing parameters [us], Bluetooth Core 6.0 Vol 6 Part H. The values
+// selected by the controllers are given by the options.
+#define T_SY_1M_US                    44.0    // CS_SYNC on LE 1M PHY
+#define T_SY_2M_US                    26.0    // CS_SYNC on LE 2M PHY
+#define T_RD_US                       5.0     // ramp down
+#define T_FM_US                       80.0    // frequency measurement of a mode 0 step
+
+// Link layer [us and bytes]
+#define T_IFS_US                      150.0
+#define LL_MAX_PAYLOAD                251u    // with data length extension
+#define LL_OVERHEAD                   9u      // access address, header, CRC
+#define LL_MIC                        4u      // encrypted link
+#define L2CAP_ATT_HEADER              7u      // L2CAP header and ATT notification header
+#define RAS_SEGMENT_HEADER            1u
+
+// Ranging data sizes of the readme of bt_cs_soc_initiator
+#define RANGING_HEADER_SIZE           4u
+#define SUBEVENT_HEADER_SIZE          8u
+#define MODE0_SIZE_REFLECTOR          4u
+#define MODE0_SIZE_INITIATOR          6u
+#define MODE1_SIZE                    6u
+
+// Defaults of bt_cs_soc_initiator/config/cs_initiator_config.h
+#define DEFAULT_CONNECTION_INTERVAL   15u
+#define DEFAULT_PROCEDURE_INTERVAL    80u
+#define DEFAULT_MODE0_STEPS           3u
+#define DEFAULT_MAX_RANGING_DATA_SIZE 1866u
+
+// Defaults of the tag rotation in bt_cs_soc_initiator/config/app_config.h
+#define DEFAULT_VISIT_RESULTS         5u
+#define DEFAULT_REVISIT_MS            10000.0
+// Scan start to the first result, the total of the milestone example in the
+// initiator readme
+#define DEFAULT_SETUP_MS              800.0
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// The cs_initiator_config_t fields the simulation depends on, same names
+typedef struct {
+  uint8_t cs_main_mode;               // MODE_PBR or MODE_RTT
+  uint8_t cs_sub_mode;                // MODE_RTT or SUBMODE_DISABLED
+  uint8_t min_main_mode_steps;
+  uint8_t mode0_step;
+  uint8_t channel_map_repetition;
+  uint8_t cs_tone_antenna_config_idx;
+  uint8_t channel_map_preset;         // PRESET_LOW, PRESET_MEDIUM or PRESET_HIGH
+  uint8_t conn_phy;                   // 1 or 2 (LE 1M or LE 2M)
+  uint8_t cs_sync_phy;                // 1 or 2 (LE 1M or LE 2M)
+  uint16_t max_connection_interval;   // 1.25 ms units
+  uint16_t max_procedure_interval;    // connection events
+  uint16_t mtu;
+} sim_config_t;
+
+enum { MODE_RTT = 1, MODE_PBR = 2, SUBMODE_DISABLED = 0xff };
+enum { PRESET_LOW, PRESET_MEDIUM, PRESET_HIGH };
+
+// Controller timing and host processing
+typedef struct {
+  double t_fcs_us;
+  double t_ip1_us;
+  double t_ip2_us;
+  double t_pm_us;
+  double t_sw_us;
+  double rtl_ms;
+  double packet_error_rate;
+} sim_timing_t;
+
+typedef struct {
+  // Schedule
+  double anchor_us;
+  uint32_t next_procedure_event;
+  bool procedure_due;
+  // Ranging data transfer of the last procedure
+  uint32_t ras_packets_left;
+  double procedure_start_us;
+  // Statistics
+  uint32_t procedures;
+  uint32_t results;
+  uint32_t deferred;
+  uint32_t overwritten;
+  double *latency_ms;
+  uint32_t latency_count;
+} sim_tag_t;
+
+// Figures of one link derived from the configuration
+typedef struct {
+  double ci_us;
+  double procedure_us;
+  uint32_t ras_packets;
+  double packet_us;
+  double empty_event_us;
+} sim_link_t;
+
+// Tag rotation of bt_cs_soc_initiator/tag_rotation.c
+typedef struct {
+  uint32_t max_tags;                  // Tag counts swept, 0 without rotation
+  uint32_t visit_results;             // CS_INITIATOR_TAG_ROTATION_PROCEDURES
+  double setup_ms;                    // Scan start to the first result of a visit
+  double revisit_ms;                  // CS_INITIATOR_TAG_ROTATION_REVISIT_MS
+} sim_rotation_t;
+
+typedef struct {
+  double cs_us;
+  double ras_us;
+  double acl_us;
+  double cpu_us;
+  uint32_t busy_events;
+} sim_totals_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint32_t get_channels(uint8_t preset);
+static uint32_t get_antenna_paths(uint8_t antenna_config_idx);
+static uint32_t get_ranging_data_size(const sim_config_t *config, uint32_t mode0_size);
+static double get_step_time_us(const sim_config_t *config, const sim_timing_t *timing, uint8_t mode);
+static double get_procedure_time_us(const sim_config_t *config, const sim_timing_t *timing);
+static double get_pdu_time_us(uint32_t payload, uint8_t phy);
+static double get_ras_packet_time_us(const sim_config_t *config, uint32_t *payload);
+static int compare_double(const void *a, const void *b);
+static double percentile(const double *sorted, uint32_t count, double p);
+static void simulate_links(const sim_link_t *link,
+                           const sim_timing_t *timing,
+                           uint32_t procedure_interval,
+                           uint32_t tag_count,
+                           double sim_us,
+                           sim_tag_t *tags,
+                           sim_totals_t *totals);
+static void simulate_rotation(const sim_rotation_t *rotation,
+                              uint32_t slot_count,
+                              double result_period_ms,
+                              double duration_s);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static uint32_t get_channels(uint8_t preset)
+{
+  switch (preset) {
+    case PRESET_LOW:
+      return 20u;
+    case PRESET_MEDIUM:
+      return 37u;
+    default:
+      return 72u;
+  }
+}
+
+/******************************************************************************
+ * Antenna paths of the CS tone antenna configuration index
+ *****************************************************************************/
+static uint32_t get_antenna_paths(uint8_t antenna_config_idx)
+{
+  static const uint8_t paths[] = { 1u, 2u, 3u, 4u, 2u, 3u, 4u, 4u };
+  return (antenna_config_idx < sizeof(paths)) ? paths[antenna_config_idx] : 1u;
+}
+
+/******************************************************************************
+ * Size of the ranging data of one procedure, see "Calculating the size of
+ * Maximum ranging data size" in the readme of bt_cs_soc_initiator
+ *****************************************************************************/
+static uint32_t get_ranging_data_size(const sim_config_t *config, uint32_t mode0_size)
+{
+  uint32_t channels = get_channels(config->channel_map_preset) * config->channel_map_repetition;
+  uint32_t size = RANGING_HEADER_SIZE + SUBEVENT_HEADER_SIZE + config->mode0_step * mode0_size;
+
+  if (config->cs_main_mode == MODE_PBR) {
+    size += channels * ((1u + (get_antenna_paths(config->cs_tone_antenna_config_idx) + 1u) * 4u) + 1u);
+  } else {
+    size += channels * (1u + MODE1_SIZE);
+  }
+  if (config->cs_sub_mode != SUBMODE_DISABLED && config->min_main_mode_steps != 0u) {
+    size += (1u + MODE1_SIZE) * channels / config->min_main_mode_steps;
+  }
+  return size;
+}
+
+/******************************************************************************
+ * Duration of one CS step
+ *****************************************************************************/
+static double get_step_time_us(const sim_config_t *config, const sim_timing_t *timing, uint8_t mode)
+{
+  double t_sy = (config->cs_sync_phy == 2u) ? T_SY_2M_US : T_SY_1M_US;
+  double paths = (double)get_antenna_paths(config->cs_tone_antenna_config_idx);
+
+  switch (mode) {
+    case 0u:
+      return timing->t_fcs_us + 2.0 * t_sy + timing->t_ip1_us + T_FM_US + T_RD_US;
+    case 1u:
+      return timing->t_fcs_us + 2.0 * t_sy + timing->t_ip1_us + T_RD_US;
+    default:
+      // Tones on every antenna path plus the extension slot in both directions
+      return timing->t_fcs_us + timing->t_ip2_us + 2.0 * (paths + 1.0) * (timing->t_sw_us + timing->t_pm_us);
+  }
+}
+
+/******************************************************************************
+ * Duration of one CS procedure with a single subevent
+ *****************************************************************************/
+static double get_procedure_time_us(const sim_config_t *config, const sim_timing_t *timing)
+{
+  uint32_t channels = get_channels(config->channel_map_preset) * config->channel_map_repetition;
+  double time = config->mode0_step * get_step_time_us(config, timing, 0u);
+
+  time += channels * get_step_time_us(config, timing, (config->cs_main_mode == MODE_PBR) ? 2u : 1u);
+  if (config->cs_sub_mode != SUBMODE_DISABLED && config->min_main_mode_steps != 0u) {
+    time += (double)(channels / config->min_main_mode_steps) * get_step_time_us(config, timing, 1u);
+  }
+  return time;
+}
+
+/******************************************************************************
+ * Air time of a link layer PDU
+ *****************************************************************************/
+static double get_pdu_time_us(uint32_t payload, uint8_t phy)
+{
+  // The preamble is one byte longer on LE 2M
+  uint32_t bytes = payload + LL_OVERHEAD + ((phy == 2u) ? 2u : 1u);
+  return bytes * 8.0 / (double)phy;
+}
+
+/******************************************************************************
+ * Air time of one RAS segment notification and its acknowledgement
+ *****************************************************************************/
+static double get_ras_packet_time_us(const sim_config_t *config, uint32_t *payload)
+{
+  uint32_t att_len = L2CAP_ATT_HEADER + (config->mtu - 3u);
+  double time = 0.0;
+
+  *payload = config->mtu - 3u - RAS_SEGMENT_HEADER;
+  // Fragmented by the link layer if the MTU exceeds the PDU size
+  while (att_len > 0u) {
+    uint32_t pdu = (att_len > LL_MAX_PAYLOAD) ? LL_MAX_PAYLOAD : att_len;
+    time += get_pdu_time_us(pdu + LL_MIC, config->conn_phy) + T_IFS_US
+            + get_pdu_time_us(0u, config->conn_phy) + T_IFS_US;
+    att_len -= pdu;
+  }
+  return time;
+}
+
+static int compare_double(const void *a, const void *b)
+{
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double percentile(const double *sorted, uint32_t count, double p)
+{
+  if (count == 0u) {
+    return 0.0;
+  }
+  uint32_t index = (uint32_t)ceil(p * count);
+  return sorted[(index == 0u) ? 0u : index - 1u];
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --tags N                 number of tags (1..%u, default 1)\n"
+         "  --preset high|medium|low channel map preset (default high)\n"
+         "  --mode pbr|rtt           main mode (default pbr)\n"
+         "  --submode rtt|none       sub mode (default none)\n"
+         "  --main-mode-steps N      main mode steps per sub mode step (default 2)\n"
+         "  --antenna-config N       CS tone antenna configuration index 0..7 (default 7, dual)\n"
+         "  --mode0-steps N          mode 0 steps (default %u)\n"
+         "  --conn-interval N        connection interval [1.25 ms] (default %u)\n"
+         "  --proc-interval N        procedure interval [connection events] (default %u)\n"
+         "  --mtu N                  ATT MTU (default 247)\n"
+         "  --phy 1m|2m              connection PHY (default 2m)\n"
+         "  --sync-phy 1m|2m         CS_SYNC PHY (default 1m)\n"
+         "  --t-fcs US --t-ip1 US --t-ip2 US --t-pm US --t-sw US\n"
+         "                           CS timing (default 100 80 80 20 10)\n"
+         "  --rtl-ms MS              RTL processing time per result (default 10)\n"
+         "  --per P                  RAS packet error rate 0..0.9 (default 0.02)\n"
+         "  --seed N                 random seed (default 1)\n"
+         "  --duration S             simulated time (default 600)\n"
+         "  --rotation N             sweep tag rotation over 1..N tags (1..%u) with --tags\n"
+         "                           connection slots\n"
+         "  --visit-results N        results per rotation visit (default %u)\n"
+         "  --setup-ms MS            scan start to first result of a visit (default %.0f)\n"
+         "  --revisit-ms MS          rotation revisit period (default %.0f)\n",
+         name,
+         MAX_TAGS,
+         DEFAULT_MODE0_STEPS,
+         DEFAULT_CONNECTION_INTERVAL,
+         DEFAULT_PROCEDURE_INTERVAL,
+         MAX_ROTATION_TAGS,
+         DEFAULT_VISIT_RESULTS,
+         DEFAULT_SETUP_MS,
+         DEFAULT_REVISIT_MS);
+}
+
+// -----------------------------------------------------------------------------
+// Simulation
+
+/******************************************************************************
+ * Walk the connection events of tag_count links that stay connected.
+ *****************************************************************************/
+static void simulate_links(const sim_link_t *link,
+                           const sim_timing_t *timing,
+                           uint32_t procedure_interval,
+                           uint32_t tag_count,
+                           double sim_us,
+                           sim_tag_t *tags,
+                           sim_totals_t *totals)
+{
+  // The controller spreads the anchors of the links evenly over the interval
+  double slot_us = link->ci_us / tag_count;
+  uint32_t packets_per_event = (uint32_t)(slot_us / link->packet_us);
+
+  if (packets_per_event == 0u) {
+    packets_per_event = 1u;
+  }
+  for (uint32_t i = 0u; i < tag_count; i++) {
+    tags[i].anchor_us = i * slot_us;
+    // Tags connect one after the other
+    tags[i].next_procedure_event = i;
+  }
+
+  double radio_free_us = 0.0;
+  double cpu_free_us = 0.0;
+  uint32_t event = 0u;
+
+  // Walk the connection events of all links in time order
+  for (double base_us = 0.0; base_us < sim_us; base_us += link->ci_us, event++) {
+    for (uint32_t i = 0u; i < tag_count; i++) {
+      sim_tag_t *tag = &tags[i];
+      double now_us = base_us + tag->anchor_us;
+
+      if (event >= tag->next_procedure_event) {
+        tag->procedure_due = true;
+        tag->next_procedure_event += procedure_interval;
+      }
+      if (now_us < radio_free_us) {
+        // The radio is busy with another link
+        totals->busy_events++;
+        if (tag->procedure_due) {
+          tag->deferred++;
+        }
+        continue;
+      }
+      if (tag->procedure_due) {
+        tag->procedure_due = false;
+        if (tag->ras_packets_left != 0u) {
+          // Real time RAS data of the last procedure is overwritten
+          tag->overwritten++;
+        }
+        tag->procedures++;
+        tag->procedure_start_us = now_us;
+        tag->ras_packets_left = link->ras_packets;
+        radio_free_us = now_us + link->procedure_us;
+        totals->cs_us += link->procedure_us;
+      } else if (tag->ras_packets_left != 0u) {
+        // Lost segments are retransmitted in the same event while it lasts
+        uint32_t attempts = 0u;
+        while (attempts < packets_per_event && tag->ras_packets_left != 0u) {
+          attempts++;
+          if (rand() >= timing->packet_error_rate * RAND_MAX) {
+            tag->ras_packets_left--;
+          }
+        }
+        double done_us = now_us + attempts * link->packet_us;
+        radio_free_us = done_us;
+        totals->ras_us += attempts * link->packet_us;
+        if (tag->ras_packets_left == 0u) {
+          // The estimation runs on the initiator one result at a time
+          double start_us = (cpu_free_us > done_us) ? cpu_free_us : done_us;
+          cpu_free_us = start_us + timing->rtl_ms * 1000.0;
+          totals->cpu_us += timing->rtl_ms * 1000.0;
+          tag->results++;
+          tag->latency_ms[tag->latency_count++] = (cpu_free_us - tag->procedure_start_us) / 1000.0;
+        }
+      } else {
+        radio_free_us = now_us + link->empty_event_us;
+        totals->acl_us += link->empty_event_us;
+      }
+    }
+  }
+}
+
+/******************************************************************************
+ * Sweep the tag count of the tag rotation. Every connection slot picks the
+ * due tag that has been waiting the longest, like tag_rotation_select(), and
+ * a visit ends after the results of the visit. Tags that are not found are
+ * not modeled.
+ *****************************************************************************/
+static void simulate_rotation(const sim_rotation_t *rotation,
+                              uint32_t slot_count,
+                              double result_period_ms,
+                              double duration_s)
+{
+  double visit_ms = rotation->setup_ms + (rotation->visit_results - 1u) * result_period_ms;
+  double end_ms = duration_s * 1000.0;
+
+  printf("\nTag rotation: %u slot(s), %u result(s) per visit, result period %.1f ms, visit %.1f ms, revisit period %.0f ms\n",
+         slot_count,
+         rotation->visit_results,
+         result_period_ms,
+         visit_ms,
+         rotation->revisit_ms);
+  printf("tags  revisit [s] mean / max  rate per tag [Hz]  slot use [%%]\n");
+  for (uint32_t tag_count = 1u; tag_count <= rotation->max_tags; tag_count++) {
+    double due_ms[MAX_ROTATION_TAGS];
+    double last_start_ms[MAX_ROTATION_TAGS];
+    double slot_free_ms[MAX_TAGS];
+    double revisit_sum_ms = 0.0;
+    double revisit_max_ms = 0.0;
+    uint32_t revisits = 0u;
+    uint32_t visits = 0u;
+    double busy_ms = 0.0;
+
+    for (uint32_t i = 0u; i < tag_count; i++) {
+      due_ms[i] = 0.0;
+      last_start_ms[i] = -1.0;
+    }
+    for (uint32_t s = 0u; s < slot_count; s++) {
+      slot_free_ms[s] = 0.0;
+    }
+    while (true) {
+      // The slot that is free first starts the next visit
+      uint32_t slot = 0u;
+      for (uint32_t s = 1u; s < slot_count; s++) {
+        if (slot_free_ms[s] < slot_free_ms[slot]) {
+          slot = s;
+        }
+      }
+      // A tag is due again only after its visit, so every due tag is idle
+      uint32_t tag = 0u;
+      for (uint32_t i = 1u; i < tag_count; i++) {
+        if (due_ms[i] < due_ms[tag]) {
+          tag = i;
+        }
+      }
+      double start_ms = (due_ms[tag] > slot_free_ms[slot]) ? due_ms[tag] : slot_free_ms[slot];
+      if (start_ms + visit_ms > end_ms) {
+        break;
+      }
+      if (last_start_ms[tag] >= 0.0) {
+        double revisit_ms = start_ms - last_start_ms[tag];
+        revisit_sum_ms += revisit_ms;
+        revisits++;
+        if (revisit_ms > revisit_max_ms) {
+          revisit_max_ms = revisit_ms;
+        }
+      }
+      last_start_ms[tag] = start_ms;
+      slot_free_ms[slot] = start_ms + visit_ms;
+      due_ms[tag] = start_ms + visit_ms + rotation->revisit_ms;
+      busy_ms += visit_ms;
+      visits++;
+    }
+    printf("%4u  %10.1f / %6.1f  %17.3f  %12.1f\n",
+           tag_count,
+           (revisits > 0u) ? revisit_sum_ms / revisits / 1000.0 : 0.0,
+           revisit_max_ms / 1000.0,
+           (double)visits * rotation->visit_results / tag_count / duration_s,
+           100.0 * busy_ms / (end_ms * slot_count));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  sim_config_t config = {
+    .cs_main_mode = MODE_PBR,
+    .cs_sub_mode = SUBMODE_DISABLED,
+    .min_main_mode_steps = 2u,
+    .mode0_step = DEFAULT_MODE0_STEPS,
+    .channel_map_repetition = 1u,
+    .cs_tone_antenna_config_idx = 7u,
+    .channel_map_preset = PRESET_HIGH,
+    .conn_phy = 2u,
+    .cs_sync_phy = 1u,
+    .max_connection_interval = DEFAULT_CONNECTION_INTERVAL,
+    .max_procedure_interval = DEFAULT_PROCEDURE_INTERVAL,
+    .mtu = 247u
+  };
+  sim_timing_t timing = {
+    .t_fcs_us = 100.0,
+    .t_ip1_us = 80.0,
+    .t_ip2_us = 80.0,
+    .t_pm_us = 20.0,
+    .t_sw_us = 10.0,
+    .rtl_ms = 10.0,
+    .packet_error_rate = 0.02
+  };
+  sim_rotation_t rotation = {
+    .max_tags = 0u,
+    .visit_results = DEFAULT_VISIT_RESULTS,
+    .setup_ms = DEFAULT_SETUP_MS,
+    .revisit_ms = DEFAULT_REVISIT_MS
+  };
+  uint32_t tag_count = 1u;
+  double duration_s = 600.0;
+  static const struct option options[] = {
+    { "tags", required_argument, NULL, 'n' },
+    { "preset", required_argument, NULL, 'p' },
+    { "mode", required_argument, NULL, 'm' },
+    { "submode", required_argument, NULL, 's' },
+    { "main-mode-steps", required_argument, NULL, 'k' },
+    { "antenna-config", required_argument, NULL, 'a' },
+    { "mode0-steps", required_argument, NULL, '0' },
+    { "conn-interval", required_argument, NULL, 'c' },
+    { "proc-interval", required_argument, NULL, 'i' },
+    { "mtu", required_argument, NULL, 'u' },
+    { "phy", required_argument, NULL, 'y' },
+    { "sync-phy", required_argument, NULL, 'Y' },
+    { "t-fcs", required_argument, NULL, 'F' },
+    { "t-ip1", required_argument, NULL, '1' },
+    { "t-ip2", required_argument, NULL, '2' },
+    { "t-pm", required_argument, NULL, 'P' },
+    { "t-sw", required_argument, NULL, 'W' },
+    { "rtl-ms", required_argument, NULL, 'r' },
+    { "per", required_argument, NULL, 'e' },
+    { "seed", required_argument, NULL, 'S' },
+    { "duration", required_argument, NULL, 'd' },
+    { "rotation", required_argument, NULL, 'R' },
+    { "visit-results", required_argument, NULL, 'K' },
+    { "setup-ms", required_argument, NULL, 'T' },
+    { "revisit-ms", required_argument, NULL, 'V' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        tag_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        config.channel_map_preset = (strcmp(optarg, "low") == 0) ? PRESET_LOW
+                                    : (strcmp(optarg, "medium") == 0) ? PRESET_MEDIUM
+                                    : PRESET_HIGH;
+        break;
+      case 'm':
+        config.cs_main_mode = (strcmp(optarg, "rtt") == 0) ? MODE_RTT : MODE_PBR;
+        break;
+      case 's':
+        config.cs_sub_mode = (strcmp(optarg, "rtt") == 0) ? MODE_RTT : SUBMODE_DISABLED;
+        break;
+      case 'k':
+        config.min_main_mode_steps = (uint8_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'a':
+        config.cs_tone_antenna_config_idx = (uint8_t)strtoul(optarg, NULL, 0);
+        break;
+      case '0':
+        config.mode0_step = (uint8_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'c':
+        config.max_connection_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'i':
+        config.max_procedure_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'u':
+        config.mtu = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'y':
+        config.conn_phy = (strcmp(optarg, "1m") == 0) ? 1u : 2u;
+        break;
+      case 'Y':
+        config.cs_sync_phy = (strcmp(optarg, "2m") == 0) ? 2u : 1u;
+        break;
+      case 'F':
+        timing.t_fcs_us = strtod(optarg, NULL);
+        break;
+      case '1':
+        timing.t_ip1_us = strtod(optarg, NULL);
+        break;
+      case '2':
+        timing.t_ip2_us = strtod(optarg, NULL);
+        break;
+      case 'P':
+        timing.t_pm_us = strtod(optarg, NULL);
+        break;
+      case 'W':
+        timing.t_sw_us = strtod(optarg, NULL);
+        break;
+      case 'r':
+        timing.rtl_ms = strtod(optarg, NULL);
+        break;
+      case 'e':
+        timing.packet_error_rate = strtod(optarg, NULL);
+        break;
+      case 'S':
+        srand((unsigned)strtoul(optarg, NULL, 0));
+        break;
+      case 'd':
+        duration_s = strtod(optarg, NULL);
+        break;
+      case 'R':
+        rotation.max_tags = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'K':
+        rotation.visit_results = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'T':
+        rotation.setup_ms = strtod(optarg, NULL);
+        break;
+      case 'V':
+        rotation.revisit_ms = strtod(optarg, NULL);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (tag_count == 0u || tag_count > MAX_TAGS || config.max_connection_interval < 6u
+      || config.max_procedure_interval == 0u || config.mtu < 23u || duration_s <= 0.0
+      || timing.packet_error_rate < 0.0 || timing.packet_error_rate > 0.9
+      || rotation.max_tags > MAX_ROTATION_TAGS || rotation.visit_results == 0u
+      || rotation.setup_ms < 0.0 || rotation.revisit_ms < 0.0) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Derived figures
+  sim_link_t link;
+  uint32_t reflector_size = get_ranging_data_size(&config, MODE0_SIZE_REFLECTOR);
+  uint32_t initiator_size = get_ranging_data_size(&config, MODE0_SIZE_INITIATOR);
+  uint32_t segment_payload;
+  link.ci_us = config.max_connection_interval * CONN_INTERVAL_UNIT_US;
+  link.procedure_us = get_procedure_time_us(&config, &timing);
+  link.packet_us = get_ras_packet_time_us(&config, &segment_payload);
+  link.ras_packets = (reflector_size + segment_payload - 1u) / segment_payload;
+  link.empty_event_us = 2.0 * get_pdu_time_us(0u, config.conn_phy) + T_IFS_US;
+  uint32_t packets_per_event = (uint32_t)(link.ci_us / tag_count / link.packet_us);
+  double sim_us = duration_s * 1e6;
+  uint32_t max_results = (uint32_t)(sim_us / link.ci_us) + 1u;
+
+  if (packets_per_event == 0u) {
+    packets_per_event = 1u;
+  }
+
+  printf("Procedure: %u channels, %u antenna paths, %.2f ms\n",
+         get_channels(config.channel_map_preset) * config.channel_map_repetition,
+         get_antenna_paths(config.cs_tone_antenna_config_idx),
+         link.procedure_us / 1000.0);
+  printf("Ranging data: initiator %u bytes, reflector %u bytes%s\n",
+         initiator_size,
+         reflector_size,
+         (initiator_size > DEFAULT_MAX_RANGING_DATA_SIZE) ? " (exceeds the default maximum ranging data size)" : "");
+  printf("RAS transfer: %u segments of %u bytes, %.2f ms air time, %u segments per connection event\n",
+         link.ras_packets,
+         segment_payload,
+         link.ras_packets * link.packet_us / 1000.0,
+         packets_per_event);
+  printf("Connection interval %.2f ms, procedure interval %u, target rate %.3f Hz per tag\n\n",
+         link.ci_us / 1000.0,
+         config.max_procedure_interval,
+         1e6 / (link.ci_us * config.max_procedure_interval));
+
+  sim_tag_t *tags = calloc(tag_count, sizeof(sim_tag_t));
+  if (tags == NULL) {
+    return EXIT_FAILURE;
+  }
+  for (uint32_t i = 0u; i < tag_count; i++) {
+    tags[i].latency_ms = malloc(max_results * sizeof(double));
+    if (tags[i].latency_ms == NULL) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  sim_totals_t totals = { 0 };
+  simulate_links(&link, &timing, config.max_procedure_interval, tag_count, sim_us, tags, &totals);
+
+  // The slowest link sets the result period of the rotation
+  uint32_t min_results = UINT32_MAX;
+  printf("tag  rate [Hz]  deferred  overwritten  latency [ms] min / p50 / p95 / max\n");
+  for (uint32_t i = 0u; i < tag_count; i++) {
+    sim_tag_t *tag = &tags[i];
+    qsort(tag->latency_ms, tag->latency_count, sizeof(double), compare_double);
+    printf("%3u  %9.3f  %8u  %11u  %8.1f / %6.1f / %6.1f / %6.1f\n",
+           i,
+           tag->results / duration_s,
+           tag->deferred,
+           tag->overwritten,
+           percentile(tag->latency_ms, tag->latency_count, 0.0),
+           percentile(tag->latency_ms, tag->latency_count, 0.5),
+           percentile(tag->latency_ms, tag->latency_count, 0.95),
+           percentile(tag->latency_ms, tag->latency_count, 1.0));
+    free(tag->latency_ms);
+    if (tag->results < min_results) {
+      min_results = tag->results;
+    }
+  }
+  printf("\nRadio duty cycle: %.1f %% (CS %.1f %%, RAS %.1f %%, empty ACL %.1f %%), connection events with the radio busy: %u\n",
+         100.0 * (totals.cs_us + totals.ras_us + totals.acl_us) / sim_us,
+         100.0 * totals.cs_us / sim_us,
+         100.0 * totals.ras_us / sim_us,
+         100.0 * totals.acl_us / sim_us,
+         totals.busy_events);
+  printf("RTL processing load: %.1f %%\n", 100.0 * totals.cpu_us / sim_us);
+  free(tags);
+  if (rotation.max_tags > 0u) {
+    if (min_results == 0u) {
+      printf("\nNo results, the tag rotation is not simulated\n");
+      return EXIT_FAILURE;
+    }
+    simulate_rotation(&rotation, tag_count, 1000.0 * duration_s / min_results, duration_s);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,251 @@
+/***************************************************************************//**
+ * @file
+ * @brief Benchmark of the single pass CS result decoder against per field lookups.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -Wextra -I../host_initiator/sdk -I../../bt_cs_soc_initiator
+//       -I../../bt_cs_soc_initiator/config -o cs_result_decode_bench
+//       cs_result_decode_bench.c ../../bt_cs_soc_initiator/cs_result_decode.c
+// The SDK headers are the stand-ins of the host build of the initiator.
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cs_result_decode.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define FIELD_SIZE                    (sizeof(uint8_t) + sizeof(float))
+#define MAX_FIELDS                    9u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Fields in the result buffer of a measurement mode, in the order of the RTL
+typedef struct {
+  const char *name;
+  uint8_t fields[MAX_FIELDS];
+  uint8_t count;
+} layout_t;
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+// Keeps the compiler from dropping the decoded values
+static volatile float sink;
+
+static const layout_t layouts[] = {
+  { "PBR", { CS_RESULT_FIELD_DISTANCE_MAINMODE, CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE,
+             CS_RESULT_FIELD_LIKELINESS_MAINMODE, CS_RESULT_FIELD_DISTANCE_RSSI,
+             CS_RESULT_FIELD_VELOCITY_MAINMODE }, 5u },
+  { "PBR + RTT", { CS_RESULT_FIELD_DISTANCE_MAINMODE, CS_RESULT_FIELD_DISTANCE_SUBMODE,
+                   CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE, CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE,
+                   CS_RESULT_FIELD_LIKELINESS_MAINMODE, CS_RESULT_FIELD_LIKELINESS_SUBMODE,
+                   CS_RESULT_FIELD_DISTANCE_RSSI, CS_RESULT_FIELD_VELOCITY_MAINMODE }, 8u },
+  { "RTT", { CS_RESULT_FIELD_DISTANCE_MAINMODE, CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE,
+             CS_RESULT_FIELD_LIKELINESS_MAINMODE, CS_RESULT_FIELD_DISTANCE_RSSI,
+             CS_RESULT_FIELD_BIT_ERROR_RATE }, 5u }
+};
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static float *get_destination(uint8_t field,
+                              cs_measurement_data_t *mainmode,
+                              cs_measurement_data_t *submode);
+static double get_time_ns(void);
+
+// -----------------------------------------------------------------------------
+// CS result component
+
+// Model of cs_result_extract_field(): a search from the start of the buffer
+sl_status_t cs_result_extract_field(cs_result_session_data_t *session_data,
+                                    cs_result_field_type_t field_type,
+                                    uint8_t *result,
+                                    uint8_t *value)
+{
+  for (size_t offset = 0u; offset + FIELD_SIZE <= session_data->size; offset += FIELD_SIZE) {
+    if (result[offset] == (uint8_t)field_type) {
+      memcpy(value, &result[offset + sizeof(uint8_t)], sizeof(float));
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+// Member of the measurement the application stores a field in
+static float *get_destination(uint8_t field,
+                              cs_measurement_data_t *mainmode,
+                              cs_measurement_data_t *submode)
+{
+  switch (field) {
+    case CS_RESULT_FIELD_DISTANCE_MAINMODE:
+      return &mainmode->distance_filtered;
+    case CS_RESULT_FIELD_DISTANCE_SUBMODE:
+      return &submode->distance_filtered;
+    case CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE:
+      return &mainmode->distance_raw;
+    case CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE:
+      return &submode->distance_raw;
+    case CS_RESULT_FIELD_LIKELINESS_MAINMODE:
+      return &mainmode->likeliness;
+    case CS_RESULT_FIELD_LIKELINESS_SUBMODE:
+      return &submode->likeliness;
+    case CS_RESULT_FIELD_VELOCITY_MAINMODE:
+      return &mainmode->velocity;
+    case CS_RESULT_FIELD_BIT_ERROR_RATE:
+      return &mainmode->bit_error_rate;
+    default:
+      return &mainmode->distance_estimate_rssi;
+  }
+}
+
+static double get_time_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --results N              number of results per layout (default 1000000)\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark
+
+int main(int argc, char **argv)
+{
+  uint32_t result_count = 1000000u;
+  static const struct option options[] = {
+    { "results", required_argument, NULL, 'n' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+  bool failed = false;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        result_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (result_count == 0u) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("Compiled fields: mask 0x%03lx (sub mode %d, velocity %d, BER %d), %u results per layout\n\n",
+         (unsigned long)CS_RESULT_DECODE_FIELD_MASK,
+         CS_RESULT_DECODE_SUBMODE,
+         CS_RESULT_DECODE_VELOCITY,
+         CS_RESULT_DECODE_BIT_ERROR_RATE,
+         result_count);
+  printf("Layout      Fields  Per field lookup  Single pass  Speed-up\n");
+  for (size_t l = 0u; l < sizeof(layouts) / sizeof(layouts[0]); l++) {
+    const layout_t *layout = &layouts[l];
+    uint8_t buffer[MAX_FIELDS * FIELD_SIZE];
+    cs_result_session_data_t session_data = {
+      .num_fields = layout->count,
+      .size = (uint16_t)(layout->count * FIELD_SIZE)
+    };
+    uint32_t field_mask = 0u;
+    for (uint8_t i = 0u; i < layout->count; i++) {
+      float value = 1.0f + (float)i;
+      buffer[i * FIELD_SIZE] = layout->fields[i];
+      memcpy(&buffer[i * FIELD_SIZE + sizeof(uint8_t)], &value, sizeof(value));
+      field_mask |= CS_RESULT_DECODE_FIELD(layout->fields[i]);
+    }
+    // Fields compiled out are not requested by the application either
+    field_mask &= (uint32_t)CS_RESULT_DECODE_FIELD_MASK;
+
+    // Per field lookup, as cs_on_result did before the decoder
+    cs_measurement_data_t old_main = { 0 };
+    cs_measurement_data_t old_sub = { 0 };
+    double start_ns = get_time_ns();
+    for (uint32_t n = 0u; n < result_count; n++) {
+      buffer[sizeof(uint8_t)] ^= (uint8_t)n;   // A new value every result
+      for (uint8_t field = 0u; field < 32u; field++) {
+        if ((field_mask & CS_RESULT_DECODE_FIELD(field)) != 0u) {
+          (void)cs_result_extract_field(&session_data,
+                                        (cs_result_field_type_t)field,
+                                        buffer,
+                                        (uint8_t *)get_destination(field, &old_main, &old_sub));
+        }
+      }
+      sink = old_main.distance_filtered;
+    }
+    double old_ns = (get_time_ns() - start_ns) / result_count;
+
+    cs_measurement_data_t new_main = { 0 };
+    cs_measurement_data_t new_sub = { 0 };
+    uint32_t missing_mask = 0u;
+    start_ns = get_time_ns();
+    for (uint32_t n = 0u; n < result_count; n++) {
+      buffer[sizeof(uint8_t)] ^= (uint8_t)n;
+      (void)cs_result_decode(&session_data, buffer, field_mask, &new_main, &new_sub, &missing_mask);
+      sink = new_main.distance_filtered;
+    }
+    double new_ns = (get_time_ns() - start_ns) / result_count;
+
+    // Both ends with the buffer of the same iteration count, so both must agree
+    bool same = (missing_mask == 0u)
+                && (memcmp(&old_main, &new_main, sizeof(old_main)) == 0)
+                && (memcmp(&old_sub, &new_sub, sizeof(old_sub)) == 0);
+    failed |= !same;
+    printf("%-10s  %6u  %13.1f ns  %8.1f ns  %7.2fx%s\n",
+           layout->name,
+           (unsigned)__builtin_popcount(field_mask),
+           old_ns,
+           new_ns,
+           old_ns / new_ns,
+           same ? "" : "  MISMATCH");
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
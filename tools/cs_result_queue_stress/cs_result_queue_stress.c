@@ -0,0 +1,233 @@
+/***************************************************************************//**
+ * @file
+ * @brief Two thread stress test of the CS result queue of the initiator.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host test, build with:
+//   gcc -O2 -Wall -Wextra -pthread -I../host_initiator/sdk -I../../bt_cs_soc_initiator
+//       -I../../bt_cs_soc_initiator/config -o cs_result_queue_stress
+//       cs_result_queue_stress.c ../../bt_cs_soc_initiator/cs_result_queue.c
+// The SDK headers are the stand-ins of the host build of the initiator.
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cs_result_queue.h"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef struct {
+  uint32_t results;        ///< Results to produce
+  uint32_t producer_delay; ///< Spin loops per produced result
+  uint32_t consumer_delay; ///< Spin loops per consumed result
+} stress_config_t;
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static cs_result_queue_t queue;
+static atomic_bool producer_done;
+// Keeps the compiler from dropping the delay loop
+static volatile uint32_t sink;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static void fill(cs_result_queue_entry_t *entry, uint32_t sequence);
+static bool check(const cs_result_queue_entry_t *entry);
+static void delay(uint32_t loops);
+static void *producer(void *arg);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Every byte of an entry is derived from its sequence number, so an entry the
+ * consumer reads while the producer writes it does not pass check().
+ *****************************************************************************/
+static void fill(cs_result_queue_entry_t *entry, uint32_t sequence)
+{
+  entry->conn_handle = (uint8_t)sequence;
+  entry->ranging_counter = (uint16_t)sequence;
+  entry->timestamp_ms = sequence;
+  memset(&entry->mainmode, (int)(uint8_t)(sequence * 7u + 1u), sizeof(entry->mainmode));
+  memset(&entry->submode, (int)(uint8_t)(sequence * 13u + 2u), sizeof(entry->submode));
+}
+
+static bool check(const cs_result_queue_entry_t *entry)
+{
+  cs_result_queue_entry_t expected;
+
+  fill(&expected, entry->timestamp_ms);
+  return entry->conn_handle == expected.conn_handle
+         && entry->ranging_counter == expected.ranging_counter
+         && memcmp(&entry->mainmode, &expected.mainmode, sizeof(expected.mainmode)) == 0
+         && memcmp(&entry->submode, &expected.submode, sizeof(expected.submode)) == 0;
+}
+
+static void delay(uint32_t loops)
+{
+  for (uint32_t i = 0u; i < loops; i++) {
+    sink += i;
+  }
+}
+
+/******************************************************************************
+ * The CS result callback: one entry per procedure
+ *****************************************************************************/
+static void *producer(void *arg)
+{
+  const stress_config_t *config = arg;
+
+  for (uint32_t sequence = 0u; sequence < config->results; sequence++) {
+    cs_result_queue_entry_t *entry = cs_result_queue_reserve(&queue);
+    if (entry != NULL) {
+      fill(entry, sequence);
+      cs_result_queue_commit(&queue);
+    } else {
+      // Let the consumer run on a single core host
+      sched_yield();
+    }
+    delay(config->producer_delay);
+  }
+  atomic_store(&producer_done, true);
+  return NULL;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --results N              results to produce (default 10000000)\n"
+         "  --producer-delay N       spin loops per produced result (default 100)\n"
+         "  --consumer-delay N       spin loops per consumed result (default 100)\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Test
+
+int main(int argc, char **argv)
+{
+  stress_config_t config = { .results = 10000000u, .producer_delay = 100u, .consumer_delay = 100u };
+  static const struct option options[] = {
+    { "results", required_argument, NULL, 'n' },
+    { "producer-delay", required_argument, NULL, 'p' },
+    { "consumer-delay", required_argument, NULL, 'd' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  uint64_t consumed = 0u;
+  uint64_t skipped = 0u;
+  uint64_t corrupt = 0u;
+  uint64_t out_of_order = 0u;
+  uint32_t next = 0u;
+  pthread_t thread;
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        config.results = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        config.producer_delay = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'd':
+        config.consumer_delay = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+
+  cs_result_queue_init(&queue);
+  atomic_init(&producer_done, false);
+  if (pthread_create(&thread, NULL, producer, &config) != 0) {
+    perror("pthread_create");
+    return EXIT_FAILURE;
+  }
+
+  // The main loop: drain until the producer has finished and the queue is empty
+  for (;;) {
+    bool done = atomic_load(&producer_done);
+    const cs_result_queue_entry_t *entry = cs_result_queue_peek(&queue);
+    if (entry == NULL) {
+      if (done) {
+        break;
+      }
+      sched_yield();
+      continue;
+    }
+    if (!check(entry)) {
+      corrupt++;
+    } else if (entry->timestamp_ms < next) {
+      out_of_order++;
+    } else {
+      // Results dropped by the producer leave a gap
+      skipped += entry->timestamp_ms - next;
+      next = entry->timestamp_ms + 1u;
+    }
+    consumed++;
+    cs_result_queue_release(&queue);
+    delay(config.consumer_delay);
+  }
+  pthread_join(thread, NULL);
+  skipped += config.results - next;
+
+  uint32_t overflows = cs_result_queue_get_overflow_count(&queue);
+  bool passed = (corrupt == 0u)
+                && (out_of_order == 0u)
+                && (consumed + overflows == config.results)
+                && (skipped == overflows);
+  printf("Queue size %u, %u results produced\n"
+         "consumed %llu, overflow count %u, missing from the sequence %llu\n"
+         "corrupt entries %llu, out of order %llu\n"
+         "%s\n",
+         CS_INITIATOR_RESULT_QUEUE_SIZE,
+         config.results,
+         (unsigned long long)consumed,
+         overflows,
+         (unsigned long long)skipped,
+         (unsigned long long)corrupt,
+         (unsigned long long)out_of_order,
+         passed ? "PASS" : "FAIL");
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
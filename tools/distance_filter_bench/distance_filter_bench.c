@@ -0,0 +1,300 @@
+/***************************************************************************//**
+ * @file
+ * @brief Benchmark of the fixed-point distance filter against a float reference.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// Host tool, build with:
+//   gcc -O2 -Wall -I../../bt_cs_soc_initiator -I../../bt_cs_soc_initiator/config
+//       -o distance_filter_bench distance_filter_bench.c ../../bt_cs_soc_initiator/distance_filter.c -lm
+// The filter settings are those of app_config.h and can be changed with -D,
+// e.g. -DCS_INITIATOR_DISTANCE_FILTER_WINDOW=9. Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "distance_filter.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define WINDOW                        CS_INITIATOR_DISTANCE_FILTER_WINDOW
+#define HAMPEL_K                      (CS_INITIATOR_DISTANCE_FILTER_HAMPEL_K_X10 / 10.0)
+#define MAD_SCALE                     1.4826
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Float reference of distance_filter_t
+typedef struct {
+  double samples[WINDOW];
+  uint32_t next;
+  uint32_t count;
+} reference_filter_t;
+
+// Error of a filter output against the true distance
+typedef struct {
+  double sum_squares;
+  double max_abs;
+} error_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static double gauss(void);
+static int compare_double(const void *a, const void *b);
+static double reference_median(double *values, uint32_t count);
+static double reference_update(reference_filter_t *filter, double distance);
+static void add_error(error_t *error, double value, double truth);
+static double get_time_ns(void);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static double gauss(void)
+{
+  double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+  double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+  return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+static int compare_double(const void *a, const void *b)
+{
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static double reference_median(double *values, uint32_t count)
+{
+  qsort(values, count, sizeof(double), compare_double);
+  return ((count & 1u) != 0u) ? values[count / 2u]
+         : 0.5 * (values[count / 2u - 1u] + values[count / 2u]);
+}
+
+/******************************************************************************
+ * Median or Hampel filter in double precision, the definition the fixed-point
+ * filter is checked against
+ *****************************************************************************/
+static double reference_update(reference_filter_t *filter, double distance)
+{
+  double sorted[WINDOW];
+
+  filter->samples[filter->next] = distance;
+  filter->next = (filter->next + 1u) % WINDOW;
+  if (filter->count < WINDOW) {
+    filter->count++;
+  }
+  memcpy(sorted, filter->samples, filter->count * sizeof(double));
+  double median = reference_median(sorted, filter->count);
+#if (CS_INITIATOR_DISTANCE_FILTER_TYPE == DISTANCE_FILTER_TYPE_HAMPEL)
+  for (uint32_t i = 0u; i < filter->count; i++) {
+    sorted[i] = fabs(sorted[i] - median);
+  }
+  double mad = reference_median(sorted, filter->count);
+  return (fabs(distance - median) > HAMPEL_K * MAD_SCALE * mad) ? median : distance;
+#else
+  return median;
+#endif // CS_INITIATOR_DISTANCE_FILTER_TYPE
+}
+
+static void add_error(error_t *error, double value, double truth)
+{
+  double difference = value - truth;
+  error->sum_squares += difference * difference;
+  if (fabs(difference) > error->max_abs) {
+    error->max_abs = fabs(difference);
+  }
+}
+
+static double get_time_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --results N              number of results (default 1000000)\n"
+         "  --noise MM               standard deviation of the distance noise (default 30)\n"
+         "  --outliers P             share of outliers 0..1 (default 0.05)\n"
+         "  --outlier-range MM       largest outlier error (default 3000)\n"
+         "  --speed MM_S             speed of the tag, back and forth over 1..6 m (default 500)\n"
+         "  --rate HZ                result rate (default 10)\n"
+         "  --seed N                 random seed (default 1)\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark
+
+int main(int argc, char **argv)
+{
+  uint32_t result_count = 1000000u;
+  double noise_mm = 30.0;
+  double outlier_share = 0.05;
+  double outlier_range_mm = 3000.0;
+  double speed_mm_s = 500.0;
+  double rate_hz = 10.0;
+  unsigned int seed = 1u;
+  static const struct option options[] = {
+    { "results", required_argument, NULL, 'n' },
+    { "noise", required_argument, NULL, 'e' },
+    { "outliers", required_argument, NULL, 'o' },
+    { "outlier-range", required_argument, NULL, 'r' },
+    { "speed", required_argument, NULL, 'v' },
+    { "rate", required_argument, NULL, 'f' },
+    { "seed", required_argument, NULL, 'S' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        result_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'e':
+        noise_mm = strtod(optarg, NULL);
+        break;
+      case 'o':
+        outlier_share = strtod(optarg, NULL);
+        break;
+      case 'r':
+        outlier_range_mm = strtod(optarg, NULL);
+        break;
+      case 'v':
+        speed_mm_s = strtod(optarg, NULL);
+        break;
+      case 'f':
+        rate_hz = strtod(optarg, NULL);
+        break;
+      case 'S':
+        seed = (unsigned int)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (result_count == 0u || rate_hz <= 0.0) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  // Input: a tag moving back and forth with noise and outliers
+  double *truth = malloc(result_count * sizeof(double));
+  int32_t *input_mm = malloc(result_count * sizeof(int32_t));
+  int32_t *fixed_mm = malloc(result_count * sizeof(int32_t));
+  double *reference = malloc(result_count * sizeof(double));
+  if (truth == NULL || input_mm == NULL || fixed_mm == NULL || reference == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    return EXIT_FAILURE;
+  }
+  srand(seed);
+  for (uint32_t i = 0u; i < result_count; i++) {
+    double travel_mm = fmod(i * speed_mm_s / rate_hz, 10000.0);
+    truth[i] = 1000.0 + ((travel_mm < 5000.0) ? travel_mm : 10000.0 - travel_mm);
+    double distance = truth[i] + noise_mm * gauss();
+    if (rand() < outlier_share * RAND_MAX) {
+      distance += outlier_range_mm * (2.0 * rand() / RAND_MAX - 1.0);
+    }
+    input_mm[i] = (int32_t)lround(distance);
+  }
+
+  distance_filter_t filter;
+  distance_filter_init(&filter);
+  double start_ns = get_time_ns();
+  for (uint32_t i = 0u; i < result_count; i++) {
+    fixed_mm[i] = distance_filter_update(&filter, input_mm[i]);
+  }
+  double fixed_ns = (get_time_ns() - start_ns) / result_count;
+
+  reference_filter_t reference_filter = { 0 };
+  start_ns = get_time_ns();
+  for (uint32_t i = 0u; i < result_count; i++) {
+    reference[i] = reference_update(&reference_filter, input_mm[i]);
+  }
+  double reference_ns = (get_time_ns() - start_ns) / result_count;
+
+  error_t input_error = { 0 };
+  error_t fixed_error = { 0 };
+  error_t reference_error = { 0 };
+  double max_difference_mm = 0.0;
+  uint32_t decisions_differ = 0u;
+  for (uint32_t i = 0u; i < result_count; i++) {
+    add_error(&input_error, input_mm[i], truth[i]);
+    add_error(&fixed_error, fixed_mm[i], truth[i]);
+    add_error(&reference_error, reference[i], truth[i]);
+    double difference_mm = fabs(fixed_mm[i] - reference[i]);
+    if (difference_mm > max_difference_mm) {
+      max_difference_mm = difference_mm;
+    }
+    // An output differing by more than the rounding of an even count median
+    // is a different outlier decision.
+    if (difference_mm > 0.5) {
+      decisions_differ++;
+    }
+  }
+
+  printf("%s filter, window %u, %u results, noise %.0f mm, outliers %.1f %% up to %.0f mm\n\n",
+         (CS_INITIATOR_DISTANCE_FILTER_TYPE == DISTANCE_FILTER_TYPE_HAMPEL) ? "Hampel" : "Median",
+         WINDOW,
+         result_count,
+         noise_mm,
+         100.0 * outlier_share,
+         outlier_range_mm);
+  printf("              RMS error   Max error   Time/result\n");
+  printf("input        %7.1f mm  %7.0f mm\n",
+         sqrt(input_error.sum_squares / result_count), input_error.max_abs);
+  printf("fixed-point  %7.1f mm  %7.0f mm  %8.1f ns\n",
+         sqrt(fixed_error.sum_squares / result_count), fixed_error.max_abs, fixed_ns);
+  printf("float        %7.1f mm  %7.0f mm  %8.1f ns\n\n",
+         sqrt(reference_error.sum_squares / result_count), reference_error.max_abs, reference_ns);
+  printf("Fixed-point against float: max difference %.1f mm, %u result(s) differ by more than 0.5 mm\n",
+         max_difference_mm,
+         decisions_differ);
+
+  free(truth);
+  free(input_mm);
+  free(fixed_mm);
+  free(reference);
+  return EXIT_SUCCESS;
+}
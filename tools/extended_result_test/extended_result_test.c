@@ -0,0 +1,663 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the extended result queue of the NCP.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host test, build with:
+//   gcc -O2 -Wall -Wextra -I../host_initiator/sdk -I../../bt_cs_ncp -I../../bt_cs_ncp/config
+//       -o extended_result_test extended_result_test.c ../../bt_cs_ncp/extended_result.c
+// The SDK headers are the stand-ins of the host build of the initiator.
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cs_acp.h"
+#include "extended_result.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define CONNECTIONS                   4u
+#define EVT_OVERHEAD                  (sizeof(cs_acp_event_id_t) + 3u)
+#define EVT_MAX_DATA                  (UINT8_MAX - EVT_OVERHEAD)
+#define RESULT_FIELD_SIZE             5u
+// Serialized procedure, see cs_acp_extended_result_evt_t
+#define PROCEDURE_MAX_LEN             (1u + CS_RESULT_MAX_BUFFER_SIZE + 1u + CS_MAX_STEP_COUNT \
+                                       + 2u * (sizeof(uint32_t) + CS_INITIATOR_MAX_RANGING_DATA_SIZE))
+// Procedures a connection can have between being queued and delivered
+#define MAX_PENDING                   16u
+#define MAX_STEPS_PER_PROCEDURE       64u
+// Main loop passes after which a queue that has not drained is a failure
+#define MAX_PASSES                    (MAX_PENDING * MAX_STEPS_PER_PROCEDURE \
+                                       * (EXTENDED_RESULT_STEP_MAX_HELD_PASSES + 1u))
+#define SLEEPTIMER_HZ                 32768u
+#define BGAPI_HEADER_LEN              4u
+#define UART_BITS_PER_BYTE            10u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// A procedure as the CS initiator component hands it over
+typedef struct {
+  uint8_t result[CS_RESULT_MAX_BUFFER_SIZE];
+  cs_result_session_data_t result_data;
+  cs_ranging_data_t ranging_data;
+  uint8_t initiator[CS_INITIATOR_MAX_RANGING_DATA_SIZE];
+  uint8_t reflector[CS_INITIATOR_MAX_RANGING_DATA_SIZE];
+} procedure_t;
+
+// Expected wire content of a queued procedure
+typedef struct {
+  uint8_t data[PROCEDURE_MAX_LEN];
+  size_t len;
+} expected_t;
+
+// Host side of one connection
+typedef struct {
+  expected_t pending[MAX_PENDING];
+  uint8_t pending_head;
+  uint8_t pending_count;
+  uint8_t data[PROCEDURE_MAX_LEN];
+  size_t len;
+  bool in_progress;
+  uint8_t fragments_left;
+  uint32_t delivered;
+} host_connection_t;
+
+// NCP transport: events wait in the Bluetooth buffer memory and leave on the
+// UART at the baud rate. The byte counts are cumulative.
+typedef struct {
+  bool instant;               ///< Events leave as soon as they are sent
+  bool always_pending;        ///< The stack reports pending events in every pass
+  uint32_t messages;          ///< Events handed to the stack
+  uint32_t bytes_per_s;
+  uint64_t now_us;
+  uint64_t queued_bytes;
+  double sent_bytes;
+  uint64_t peak_bytes;        ///< Most bytes waiting at once
+  uint64_t last_fragment_us;  ///< Last fragment of a procedure handed to the stack
+} transport_t;
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static bool verbose = false;
+static uint32_t random_state = 1u;
+static uint32_t tick = 0u;
+static int32_t em1_requirements = 0;
+static uint32_t errors = 0u;
+static host_connection_t host[CONNECTIONS];
+static procedure_t procedure;
+static transport_t transport = { .instant = true };
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint32_t get_random(void);
+static void make_procedure(bool max_size);
+static size_t serialize_reference(uint8_t *data);
+static size_t get_reference_fragment(const host_connection_t *conn, uint8_t connection, uint8_t *evt_data);
+static bool queue_procedure(uint8_t connection, bool max_size);
+static uint32_t drain(void);
+static void fail(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static bool run_burst(uint32_t burst);
+static void advance(uint64_t time_us);
+static bool run_latency(uint32_t pass_ms);
+static bool run_always_pending(void);
+/******************************************************************************
+ * Let the UART send what it can up to a time
+ *****************************************************************************/
+static void advance(uint64_t time_us)
+{
+  double sendable = (double)(time_us - transport.now_us) * transport.bytes_per_s / 1e6;
+  double waiting = (double)transport.queued_bytes - transport.sent_bytes;
+
+  transport.sent_bytes += (sendable < waiting) ? sendable : waiting;
+  transport.now_us = time_us;
+  tick = (uint32_t)(time_us * SLEEPTIMER_HZ / 1000000u);
+}
+
+/******************************************************************************
+ * Queue the largest procedure of as many connections as the queue takes and
+ * run a main loop pass every pass_ms until they are sent. Reports the time
+ * until the last fragment is handed to the stack, as measured by the test and
+ * by the drain time statistic of the module, and until its last byte has left
+ * on the UART.
+ *****************************************************************************/
+static bool run_latency(uint32_t pass_ms)
+{
+  extended_result_stats_t before;
+  extended_result_stats_t after;
+  uint32_t errors_before = errors;
+  uint32_t passes = 0u;
+
+  transport.now_us = 0u;
+  transport.queued_bytes = 0u;
+  transport.sent_bytes = 0.0;
+  transport.peak_bytes = 0u;
+  transport.last_fragment_us = 0u;
+  advance(0u);
+  extended_result_get_stats(&before);
+  for (uint32_t i = 0u; i < EXTENDED_RESULT_QUEUE_SIZE; i++) {
+    if (!queue_procedure((uint8_t)(i % CONNECTIONS), true)) {
+      fail("Procedure %u not queued\n", i);
+    }
+  }
+  // The first pass follows the result callback right away
+  for (extended_result_get_stats(&after);
+       after.depth > 0u && passes < MAX_PASSES;
+       extended_result_get_stats(&after)) {
+    advance((uint64_t)passes * pass_ms * 1000u);
+    extended_result_step();
+    passes++;
+  }
+  if (after.depth > 0u) {
+    fail("Queue not drained after %u passes\n", passes);
+  }
+  double uart_done_ms = (transport.now_us
+                         + ((double)transport.queued_bytes - transport.sent_bytes) * 1e6 / transport.bytes_per_s)
+                        / 1000.0;
+  advance(transport.now_us);
+  printf("%4u %7u %7.1f ms %8u ms %5.1f ms %13llu %10u  %s\n",
+         pass_ms,
+         passes,
+         transport.last_fragment_us / 1000.0,
+         after.last_drain_time_ms,
+         uart_done_ms,
+         (unsigned long long)transport.peak_bytes,
+         after.throttled_passes - before.throttled_passes,
+         (errors == errors_before) ? "ok" : "FAIL");
+  return errors == errors_before;
+}
+
+/******************************************************************************
+ * Queue the largest procedure of as many connections as the queue takes while
+ * the stack reports pending events in every pass. A fragment must still be
+ * sent after EXTENDED_RESULT_STEP_MAX_HELD_PASSES held passes, so that the
+ * queue drains and every procedure is delivered.
+ *****************************************************************************/
+static bool run_always_pending(void)
+{
+  extended_result_stats_t before;
+  extended_result_stats_t after;
+  uint32_t errors_before = errors;
+  uint32_t messages_before = transport.messages;
+
+  transport.always_pending = true;
+  extended_result_get_stats(&before);
+  for (uint32_t i = 0u; i < EXTENDED_RESULT_QUEUE_SIZE; i++) {
+    if (!queue_procedure((uint8_t)(i % CONNECTIONS), true)) {
+      fail("Procedure %u not queued\n", i);
+    }
+  }
+  uint32_t passes = drain();
+  transport.always_pending = false;
+  extended_result_get_stats(&after);
+  for (uint8_t c = 0u; c < CONNECTIONS; c++) {
+    if (host[c].pending_count != 0u || host[c].in_progress) {
+      fail("Connection %u: %u procedures not delivered\n", c, host[c].pending_count);
+    }
+  }
+  uint32_t fragments = transport.messages - messages_before;
+  uint32_t throttled = after.throttled_passes - before.throttled_passes;
+  if (fragments == 0u
+      || passes != fragments * (EXTENDED_RESULT_STEP_MAX_HELD_PASSES + 1u)
+      || throttled != passes - fragments) {
+    fail("%u fragments in %u passes, %u throttled, expected one fragment every %u passes\n",
+         fragments, passes, throttled, EXTENDED_RESULT_STEP_MAX_HELD_PASSES + 1u);
+  }
+  if (em1_requirements != 0) {
+    fail("%d EM1 requirements left\n", (int)em1_requirements);
+  }
+  printf("%6u %10u %10u  %s\n",
+         passes,
+         fragments,
+         throttled,
+         (errors == errors_before) ? "ok" : "FAIL");
+  return errors == errors_before;
+}
+
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// SDK
+
+uint32_t sl_sleeptimer_get_tick_count(void)
+{
+  return tick;
+}
+
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t ticks)
+{
+  return (uint32_t)((uint64_t)ticks * 1000u / SLEEPTIMER_HZ);
+}
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em)
+{
+  (void)em;
+  em1_requirements++;
+}
+
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em)
+{
+  (void)em;
+  em1_requirements--;
+}
+
+bool sl_bt_event_pending(void)
+{
+  return transport.always_pending
+         || (!transport.instant && transport.sent_bytes < (double)transport.queued_bytes);
+}
+
+void fake_app_log(uint8_t level, const char *format, ...)
+{
+  va_list args;
+
+  (void)level;
+  if (verbose) {
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+  }
+}
+
+/******************************************************************************
+ * Compare every message with the one the fragmenter of the original module
+ * sends for the procedure queued next for that connection, then reassemble
+ * the fragments on the host side and compare every completed procedure with
+ * its reference serialization.
+ *****************************************************************************/
+void sl_bt_send_evt_user_cs_service_message_to_host(uint8_t message_len, const uint8_t *message)
+{
+  const cs_acp_event_t *evt = (const cs_acp_event_t *)message;
+  uint8_t reference[sizeof(cs_acp_event_t)];
+
+  transport.messages++;
+  transport.queued_bytes += message_len + BGAPI_HEADER_LEN;
+  if (!transport.instant && transport.queued_bytes - (uint64_t)transport.sent_bytes > transport.peak_bytes) {
+    transport.peak_bytes = transport.queued_bytes - (uint64_t)transport.sent_bytes;
+  }
+
+  if (message_len < EVT_OVERHEAD || evt->acp_evt_id != CS_ACP_EVT_EXTENDED_RESULT_ID) {
+    fail("Unexpected event of %u bytes\n", message_len);
+    return;
+  }
+  if (evt->connection_id >= CONNECTIONS) {
+    fail("Unknown connection %u\n", evt->connection_id);
+    return;
+  }
+  host_connection_t *conn = &host[evt->connection_id];
+  if (conn->pending_count > 0u) {
+    size_t reference_len = get_reference_fragment(conn, evt->connection_id, reference);
+    if (message_len != reference_len || memcmp(message, reference, message_len) != 0) {
+      fail("Connection %u: message at offset %zu differs from the original fragmenter\n",
+           evt->connection_id, conn->in_progress ? conn->len : 0u);
+    }
+  }
+  uint8_t fragment_len = evt->data.ext_result.fragment.len;
+  uint8_t fragments_left = evt->data.ext_result.fragments_left & CS_ACP_FRAGMENTS_LEFT_MASK;
+  if (fragment_len != message_len - EVT_OVERHEAD) {
+    fail("Connection %u: fragment length %u in a message of %u bytes\n",
+         evt->connection_id, fragment_len, message_len);
+    return;
+  }
+  if (evt->data.ext_result.fragments_left & CS_ACP_FIRST_FRAGMENT_MASK) {
+    if (conn->in_progress) {
+      fail("Connection %u: new procedure before the last fragment\n", evt->connection_id);
+    }
+    conn->in_progress = true;
+    conn->len = 0u;
+  } else if (!conn->in_progress || fragments_left != conn->fragments_left - 1u) {
+    fail("Connection %u: fragment out of sequence\n", evt->connection_id);
+    return;
+  }
+  if (conn->len + fragment_len > sizeof(conn->data)) {
+    fail("Connection %u: procedure too long\n", evt->connection_id);
+    return;
+  }
+  memcpy(&conn->data[conn->len], evt->data.ext_result.fragment.data, fragment_len);
+  conn->len += fragment_len;
+  conn->fragments_left = fragments_left;
+  if (fragments_left > 0u) {
+    return;
+  }
+
+  conn->in_progress = false;
+  transport.last_fragment_us = transport.now_us;
+  if (conn->pending_count == 0u) {
+    fail("Connection %u: procedure that was not queued\n", evt->connection_id);
+    return;
+  }
+  const expected_t *expected = &conn->pending[conn->pending_head];
+  if (conn->len != expected->len || memcmp(conn->data, expected->data, conn->len) != 0) {
+    fail("Connection %u: procedure differs from the reference (%zu bytes, expected %zu)\n",
+         evt->connection_id, conn->len, expected->len);
+  }
+  conn->pending_head = (uint8_t)((conn->pending_head + 1u) % MAX_PENDING);
+  conn->pending_count--;
+  conn->delivered++;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * xorshift32, the same sequence on every run for a seed
+ *****************************************************************************/
+static uint32_t get_random(void)
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+/******************************************************************************
+ * Fill the procedure with random content, or the largest one that fits
+ *****************************************************************************/
+static void make_procedure(bool max_size)
+{
+  uint32_t fields = max_size ? CS_RESULT_MAX_BUFFER_SIZE / RESULT_FIELD_SIZE
+                    : 1u + get_random() % (CS_RESULT_MAX_BUFFER_SIZE / RESULT_FIELD_SIZE);
+
+  procedure.result_data.num_fields = (uint8_t)fields;
+  procedure.result_data.size = (uint16_t)(fields * RESULT_FIELD_SIZE);
+  procedure.ranging_data.num_steps = max_size ? UINT8_MAX : (uint8_t)(get_random() % 256u);
+  procedure.ranging_data.initiator.ranging_data_size
+    = max_size ? CS_INITIATOR_MAX_RANGING_DATA_SIZE : get_random() % (CS_INITIATOR_MAX_RANGING_DATA_SIZE + 1u);
+  procedure.ranging_data.reflector.ranging_data_size
+    = max_size ? CS_INITIATOR_MAX_RANGING_DATA_SIZE : get_random() % (CS_INITIATOR_MAX_RANGING_DATA_SIZE + 1u);
+  procedure.ranging_data.initiator.ranging_data = procedure.initiator;
+  procedure.ranging_data.reflector.ranging_data = procedure.reflector;
+  for (size_t i = 0u; i < sizeof(procedure.result); i++) {
+    procedure.result[i] = (uint8_t)get_random();
+  }
+  for (size_t i = 0u; i < CS_MAX_STEP_COUNT; i++) {
+    procedure.ranging_data.step_channels[i] = (uint8_t)get_random();
+  }
+  for (size_t i = 0u; i < CS_INITIATOR_MAX_RANGING_DATA_SIZE; i++) {
+    procedure.initiator[i] = (uint8_t)get_random();
+    procedure.reflector[i] = (uint8_t)get_random();
+  }
+}
+
+/******************************************************************************
+ * Content layout of cs_acp_extended_result_evt_t, written from its
+ * documentation in cs_acp.h. Sizes are little endian.
+ *****************************************************************************/
+static size_t serialize_reference(uint8_t *data)
+{
+  const cs_ranging_data_t *rd = &procedure.ranging_data;
+  const cs_rd_t *buffers[] = { &rd->initiator, &rd->reflector };
+  size_t len = 0u;
+
+  data[len++] = (uint8_t)procedure.result_data.size;
+  memcpy(&data[len], procedure.result, procedure.result_data.size);
+  len += procedure.result_data.size;
+  data[len++] = rd->num_steps;
+  memcpy(&data[len], rd->step_channels, rd->num_steps);
+  len += rd->num_steps;
+  for (size_t i = 0u; i < 2u; i++) {
+    uint32_t size = buffers[i]->ranging_data_size;
+    for (size_t b = 0u; b < sizeof(size); b++) {
+      data[len++] = (uint8_t)(size >> (8u * b));
+    }
+    memcpy(&data[len], buffers[i]->ranging_data, size);
+    len += size;
+  }
+  return len;
+}
+
+/******************************************************************************
+ * Next message of the procedure being received, built the way the original
+ * extended_result_step() did: header and fragment copied into a separate
+ * event buffer.
+ *****************************************************************************/
+static size_t get_reference_fragment(const host_connection_t *conn, uint8_t connection, uint8_t *evt_data)
+{
+  const expected_t *expected = &conn->pending[conn->pending_head];
+  size_t offset = conn->in_progress ? conn->len : 0u;
+  size_t left = expected->len - offset;
+  uint8_t evt_data_len = (uint8_t)((left < EVT_MAX_DATA) ? left : EVT_MAX_DATA);
+  cs_acp_event_t *evt = (cs_acp_event_t *)evt_data;
+
+  evt->connection_id = connection;
+  evt->acp_evt_id = CS_ACP_EVT_EXTENDED_RESULT_ID;
+  memcpy(evt->data.ext_result.fragment.data, &expected->data[offset], evt_data_len);
+  evt->data.ext_result.fragment.len = evt_data_len;
+  left -= evt_data_len;
+  evt->data.ext_result.fragments_left = (uint8_t)((left + EVT_MAX_DATA - 1u) / EVT_MAX_DATA);
+  if (offset == 0u) {
+    evt->data.ext_result.fragments_left |= CS_ACP_FIRST_FRAGMENT_MASK;
+  }
+  return evt_data_len + EVT_OVERHEAD;
+}
+
+/******************************************************************************
+ * Hand a new procedure of a connection to the NCP. Returns true if it was
+ * queued, its reference serialization is then expected on the host.
+ *****************************************************************************/
+static bool queue_procedure(uint8_t connection, bool max_size)
+{
+  extended_result_stats_t before;
+  extended_result_stats_t after;
+
+  make_procedure(max_size);
+  extended_result_get_stats(&before);
+  cs_on_extended_result(connection,
+                        0u,
+                        procedure.result,
+                        &procedure.result_data,
+                        &procedure.ranging_data,
+                        NULL);
+  extended_result_get_stats(&after);
+  if (after.queued == before.queued) {
+    return false;
+  }
+  host_connection_t *conn = &host[connection];
+  if (conn->pending_count == MAX_PENDING) {
+    fail("Connection %u: more than %u procedures pending\n", connection, MAX_PENDING);
+    return true;
+  }
+  expected_t *expected = &conn->pending[(conn->pending_head + conn->pending_count) % MAX_PENDING];
+  expected->len = serialize_reference(expected->data);
+  conn->pending_count++;
+  return true;
+}
+
+/******************************************************************************
+ * Run main loop passes until the queue is empty. Returns the passes.
+ *****************************************************************************/
+static uint32_t drain(void)
+{
+  extended_result_stats_t stats;
+  uint32_t passes = 0u;
+
+  for (extended_result_get_stats(&stats);
+       stats.depth > 0u && passes < MAX_PASSES;
+       extended_result_get_stats(&stats)) {
+    extended_result_step();
+    passes++;
+  }
+  if (stats.depth > 0u) {
+    fail("Queue not drained after %u passes\n", passes);
+  }
+  return passes;
+}
+
+static void fail(const char *format, ...)
+{
+  va_list args;
+
+  errors++;
+  va_start(args, format);
+  vprintf(format, args);
+  va_end(args);
+}
+
+/******************************************************************************
+ * Queue a burst of procedures from the connections in turn without a main
+ * loop pass in between, then drain the queue. The first procedure of every
+ * connection has the largest size. Below the queue capacity nothing may be
+ * lost, above it exactly the procedures that do not fit are dropped.
+ *****************************************************************************/
+static bool run_burst(uint32_t burst)
+{
+  extended_result_stats_t before;
+  extended_result_stats_t after;
+  uint32_t delivered_before = 0u;
+  uint32_t delivered = 0u;
+  uint32_t accepted = 0u;
+  uint32_t errors_before = errors;
+
+  extended_result_get_stats(&before);
+  for (uint8_t c = 0u; c < CONNECTIONS; c++) {
+    delivered_before += host[c].delivered;
+  }
+  for (uint32_t i = 0u; i < burst; i++) {
+    accepted += queue_procedure((uint8_t)(i % CONNECTIONS), i < CONNECTIONS) ? 1u : 0u;
+  }
+  uint32_t passes = drain();
+  extended_result_get_stats(&after);
+  for (uint8_t c = 0u; c < CONNECTIONS; c++) {
+    delivered += host[c].delivered;
+    if (host[c].pending_count != 0u || host[c].in_progress) {
+      fail("Connection %u: %u procedures not delivered\n", c, host[c].pending_count);
+    }
+  }
+  delivered -= delivered_before;
+
+  uint32_t expected = (burst < EXTENDED_RESULT_QUEUE_SIZE) ? burst : EXTENDED_RESULT_QUEUE_SIZE;
+  uint32_t dropped = after.dropped_queue_full - before.dropped_queue_full;
+  if (accepted != expected || delivered != expected || dropped != burst - expected) {
+    fail("Burst of %u: %u queued, %u delivered, %u dropped, expected %u queued\n",
+         burst, accepted, delivered, dropped, expected);
+  }
+  if (after.dropped_serialization != before.dropped_serialization) {
+    fail("Burst of %u: serialization failed\n", burst);
+  }
+  if (em1_requirements != 0) {
+    fail("Burst of %u: %d EM1 requirements left\n", burst, (int)em1_requirements);
+  }
+  printf("%5u %8u %10u %8u %7u %10u  %s\n",
+         burst,
+         accepted,
+         delivered,
+         dropped,
+         passes,
+         after.high_watermark,
+         (errors == errors_before) ? "ok" : "FAIL");
+  return errors == errors_before;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --bursts N               largest burst (default 2 * EXTENDED_RESULT_QUEUE_SIZE + 2)\n"
+         "  --seed N                 seed of the procedure content (default 1)\n"
+         "  --baud B                 UART baud rate of the NCP transport (default 115200)\n"
+         "  --verbose                show the log of the module\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Test
+
+int main(int argc, char **argv)
+{
+  static const uint32_t pass_ms[] = { 1u, 2u, 5u, 10u, 20u };
+  uint32_t max_burst = 2u * EXTENDED_RESULT_QUEUE_SIZE + 2u;
+  static const struct option options[] = {
+    { "bursts", required_argument, NULL, 'b' },
+    { "seed", required_argument, NULL, 's' },
+    { "baud", required_argument, NULL, 'u' },
+    { "verbose", no_argument, NULL, 'v' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  bool passed = true;
+  int opt;
+
+  transport.bytes_per_s = 115200u / UART_BITS_PER_BYTE;
+  while ((opt = getopt_long(argc, argv, "hv", options, NULL)) != -1) {
+    switch (opt) {
+      case 'b':
+        max_burst = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        random_state = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'u':
+        transport.bytes_per_s = (uint32_t)strtoul(optarg, NULL, 0) / UART_BITS_PER_BYTE;
+        break;
+      case 'v':
+        verbose = true;
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (random_state == 0u || max_burst == 0u || max_burst > MAX_PENDING || transport.bytes_per_s == 0u) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("Queue size %u, %u connections, procedures of up to %u bytes\n\n",
+         EXTENDED_RESULT_QUEUE_SIZE, CONNECTIONS, (unsigned)PROCEDURE_MAX_LEN);
+  printf("Burst   Queued  Delivered  Dropped  Passes  Watermark\n");
+  for (uint32_t burst = 1u; burst <= max_burst; burst++) {
+    passed &= run_burst(burst);
+  }
+
+  printf("\nLatency of %u largest procedures queued at once, up to %u fragments or %u bytes per pass,\n"
+         "UART at %lu bytes/s\n\n",
+         EXTENDED_RESULT_QUEUE_SIZE,
+         EXTENDED_RESULT_STEP_MAX_FRAGMENTS,
+         EXTENDED_RESULT_STEP_MAX_BYTES,
+         (unsigned long)transport.bytes_per_s);
+  printf("Pass  Passes  To stack  Drain stat  On UART  Peak buffered  Throttled\n");
+  transport.instant = false;
+  for (size_t i = 0u; i < sizeof(pass_ms) / sizeof(pass_ms[0]); i++) {
+    passed &= run_latency(pass_ms[i]);
+  }
+
+  printf("\nStack with events pending in every pass\n\n");
+  printf("Passes  Fragments  Throttled\n");
+  passed &= run_always_pending();
+  return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
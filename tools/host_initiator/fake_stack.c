@@ -0,0 +1,1659 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scriptable fake of the Bluetooth stack and the CS initiator component.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// The fake runs on a virtual clock. Every response of the stack, the peer
+// manager and the CS initiator component is an event queued for a later
+// virtual time, and the driver dispatches the events in time order through
+// fake_stack_step(). Calls of the application into the fake never call back
+// into the application directly, like on the target.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include "fake_stack.h"
+#include "cs_initiator_config.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define EVENT_QUEUE_SIZE              4096u
+#define SLEEPTIMER_HZ                 32768u
+#define CONN_INTERVAL_UNIT_MS         1.25f
+#define RESULT_FIELD_SIZE             (sizeof(uint8_t) + sizeof(float))
+#define RESULT_MAX_FIELDS             9u
+#define NVM3_MAX_OBJECTS              64u
+#define NVM3_MAX_OBJECT_SIZE          256u
+#define CLI_MAX_GROUPS                8u
+#define CLI_MAX_ARGS                  16u
+#define DEFAULT_HEAP_SIZE             65536u
+#define DEFAULT_MAX_CONNECTIONS       4u
+#define TRACE_BUFFER_SIZE             512u
+#define RTL_LOG_MESSAGE_SIZE          256u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef enum {
+  EVENT_CALL,         // Call of the driver
+  EVENT_TIMER,        // app_timer expired
+  EVENT_BT,           // Bluetooth event of the connection or the system
+  EVENT_CS,           // Bluetooth event of the CS instance of the connection
+  EVENT_OPEN,         // Scanner found a reflector, connection opens
+  EVENT_CLOSED,       // Connection closed
+  EVENT_PROCEDURE,    // CS procedure of the connection done
+  EVENT_RESULT        // RTL processing of a procedure done
+} event_kind_t;
+
+typedef struct {
+  uint64_t time_ms;
+  uint64_t seq;
+  event_kind_t kind;
+  uint8_t connection;
+  uint8_t reflector;
+  uint32_t generation;
+  union {
+    struct {
+      fake_call_t call;
+      void *arg;
+    } call;
+    app_timer_t *timer;
+    sl_bt_msg_t msg;
+    struct {
+      uint16_t counter;
+      bool intermediate;
+      float progress;
+      float distance;
+      float velocity;
+    } result;
+  } data;
+} event_t;
+
+typedef struct {
+  bool open;
+  bool closing;
+  uint8_t reflector;
+  uint8_t security_mode;
+  uint32_t generation;
+  // CS initiator instance of the connection
+  bool cs_created;
+  uint32_t cs_generation;
+  cs_initiator_config_t config;
+  rtl_config_t rtl_config;
+  cs_result_cb_t result_cb;
+  cs_intermediate_result_cb_t intermediate_result_cb;
+  cs_error_cb_t error_cb;
+  uint16_t ranging_counter;
+  uint8_t static_count;
+  uint32_t cs_creates;
+} connection_t;
+
+typedef struct {
+  bool valid;
+  nvm3_ObjectKey_t key;
+  size_t len;
+  uint8_t data[NVM3_MAX_OBJECT_SIZE];
+} nvm3_object_t;
+
+struct sl_iostream {
+  const char *name;
+};
+
+struct nvm3_Handle {
+  int unused;
+};
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static void push_event(const event_t *event);
+static bool pop_event(event_t *event);
+static connection_t *get_connection(uint8_t handle);
+static void dispatch(event_t *event);
+static void deliver_bt_event(uint8_t connection, uint32_t delay_ms, const sl_bt_msg_t *msg, bool cs_event);
+static void deliver_peer_manager_event(uint8_t evt_id, uint8_t connection);
+static void update_scan(void);
+static bool reflector_matches(const fake_reflector_t *reflector);
+static void open_connection(uint8_t reflector_index);
+static void close_connection(uint8_t handle);
+static void schedule_close(uint8_t handle, uint32_t delay_ms);
+static void run_procedure(uint8_t handle);
+static void deliver_result(const event_t *event);
+static float get_distance(fake_reflector_t *reflector, float *velocity);
+static uint32_t random_u32(void);
+static size_t put_field(uint8_t *buffer, size_t offset, uint8_t type, float value);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static event_t queue[EVENT_QUEUE_SIZE];
+static size_t queue_len;
+static uint64_t next_seq;
+static uint64_t now_ms;
+static uint32_t random_state;
+
+static fake_delays_t delays;
+static fake_reflector_t reflectors[FAKE_MAX_REFLECTORS];
+static uint8_t reflector_count;
+static connection_t connections[FAKE_MAX_CONNECTIONS];
+static uint8_t max_connections;
+static uint8_t local_antennas;
+static uint8_t static_procedures;
+static size_t heap_size;
+static fake_stats_t stats;
+static fake_console_hook_t console_hook;
+static fake_console_hook_t log_hook;
+static uint64_t rtl_busy_until_ms;
+static uint32_t rtl_queue_len;
+static uint32_t atomic_depth;
+static uint32_t rtl_log_size;
+static uint32_t trace_rate;
+static uint64_t trace_credit;        // In 1/1000 bytes
+static uint64_t trace_credit_ms;
+
+// Peer manager
+static bool scanning;
+static uint32_t scan_generation;
+static char filter_name[FAKE_NAME_LEN];
+static uint8_t filter_name_len;
+static bool filter_name_prefix;
+static bool filter_name_set;
+static bool filter_uuid_set;
+static uint16_t filter_uuid;
+static bool filter_address_set;
+static bd_addr filter_address;
+
+static nvm3_object_t nvm3_objects[NVM3_MAX_OBJECTS];
+static nvm3_Handle_t nvm3_handle;
+static sl_cli_command_group_t *cli_groups[CLI_MAX_GROUPS];
+static sl_rtl_log_callback_t rtl_log_callback;
+
+static struct sl_iostream console_stream = { "console" };
+static struct sl_iostream trace_stream = { "trace" };
+static struct sl_iostream log_stream = { "log" };
+static sl_iostream_t *app_log_stream = &log_stream;
+
+// -----------------------------------------------------------------------------
+// Public variables of the SDK
+
+sl_iostream_t *sl_iostream_recommended_console_stream = &console_stream;
+sl_iostream_t *iostream_bgapi_trace_handle = &trace_stream;
+nvm3_Handle_t *nvm3_defaultHandle = &nvm3_handle;
+sl_cli_handle_t sl_cli_default_handle = NULL;
+
+// -----------------------------------------------------------------------------
+// Driver interface
+
+void fake_stack_init(uint32_t seed)
+{
+  queue_len = 0u;
+  next_seq = 0u;
+  now_ms = 0u;
+  random_state = (seed != 0u) ? seed : 1u;
+  delays = (fake_delays_t) {
+    .open_ms = 10u,
+    .mtu_ms = 60u,
+    .security_ms = 80u,
+    .capabilities_ms = 40u,
+    .config_ms = 60u,
+    .enable_ms = 40u,
+    .rtl_ms = 8u,
+    .close_ms = 30u,
+    .timeout_ms = CS_INITIATOR_DEFAULT_TIMEOUT * 10u
+  };
+  memset(reflectors, 0, sizeof(reflectors));
+  reflector_count = 0u;
+  memset(connections, 0, sizeof(connections));
+  max_connections = DEFAULT_MAX_CONNECTIONS;
+  local_antennas = 2u;
+  static_procedures = 5u;
+  heap_size = DEFAULT_HEAP_SIZE;
+  memset(&stats, 0, sizeof(stats));
+  rtl_busy_until_ms = 0u;
+  rtl_queue_len = 0u;
+  atomic_depth = 0u;
+  rtl_log_size = 0u;
+  trace_rate = 0u;
+  trace_credit = 0u;
+  trace_credit_ms = 0u;
+  scanning = false;
+  scan_generation = 0u;
+  filter_name_set = false;
+  filter_uuid_set = false;
+  filter_address_set = false;
+  memset(nvm3_objects, 0, sizeof(nvm3_objects));
+  memset(cli_groups, 0, sizeof(cli_groups));
+  app_log_stream = &log_stream;
+}
+
+fake_delays_t *fake_stack_get_delays(void)
+{
+  return &delays;
+}
+
+fake_reflector_t *fake_stack_add_reflector(void)
+{
+  if (reflector_count >= FAKE_MAX_REFLECTORS) {
+    return NULL;
+  }
+  uint8_t index = reflector_count++;
+  fake_reflector_t *reflector = &reflectors[index];
+  memset(reflector, 0, sizeof(*reflector));
+  // C0:FE:CA:00:00:01 onwards
+  reflector->address = (bd_addr) { { (uint8_t)(index + 1u), 0x00, 0x00, 0xCA, 0xFE, 0xC0 } };
+  snprintf(reflector->name, sizeof(reflector->name), "%s", REFLECTOR_DEVICE_NAME);
+  reflector->advertise_ras = true;
+  reflector->visible = true;
+  reflector->num_antennas = 1u;
+  reflector->adv_interval_ms = 100u;
+  reflector->adv_phase_ms = random_u32() % reflector->adv_interval_ms;
+  reflector->distance_m = 1.0f + (float)index * 0.5f;
+  reflector->min_m = 0.3f;
+  reflector->max_m = 10.0f;
+  reflector->likeliness = 0.9f;
+  reflector->noise_mm = 30u;
+  reflector->connection = SL_BT_INVALID_CONNECTION_HANDLE;
+  return reflector;
+}
+
+fake_reflector_t *fake_stack_get_reflector(uint8_t index)
+{
+  return (index < reflector_count) ? &reflectors[index] : NULL;
+}
+
+uint8_t fake_stack_get_reflector_count(void)
+{
+  return reflector_count;
+}
+
+void fake_stack_set_heap_size(size_t size)
+{
+  heap_size = size;
+}
+
+void fake_stack_set_max_connections(uint8_t count)
+{
+  max_connections = (uint8_t)SL_MIN(count, FAKE_MAX_CONNECTIONS);
+}
+
+void fake_stack_set_local_antennas(uint8_t count)
+{
+  local_antennas = count;
+}
+
+void fake_stack_set_static_procedures(uint8_t count)
+{
+  static_procedures = (count > 0u) ? count : 1u;
+}
+
+void fake_stack_set_rtl_log(uint32_t size, uint32_t rate)
+{
+  rtl_log_size = size;
+  trace_rate = rate;
+}
+
+void fake_stack_set_console_hook(fake_console_hook_t hook)
+{
+  console_hook = hook;
+}
+
+void fake_stack_set_log_hook(fake_console_hook_t hook)
+{
+  log_hook = hook;
+}
+
+void fake_stack_boot(void)
+{
+  sl_bt_msg_t msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_system_boot_id;
+  msg.data.evt_system_boot.major = SL_BT_VERSION_MAJOR;
+  deliver_bt_event(SL_BT_INVALID_CONNECTION_HANDLE, 0u, &msg, false);
+}
+
+void fake_stack_schedule_call(uint64_t time_ms, fake_call_t call, void *arg)
+{
+  event_t event = {
+    .time_ms = (time_ms > now_ms) ? time_ms : now_ms,
+    .kind = EVENT_CALL
+  };
+  event.data.call.call = call;
+  event.data.call.arg = arg;
+  push_event(&event);
+}
+
+bool fake_stack_step(uint64_t end_ms)
+{
+  event_t event;
+  if (queue_len == 0u || queue[0].time_ms > end_ms) {
+    if (end_ms > now_ms) {
+      now_ms = end_ms;
+    }
+    return false;
+  }
+  (void)pop_event(&event);
+  now_ms = event.time_ms;
+  dispatch(&event);
+  return true;
+}
+
+uint64_t fake_stack_get_time_ms(void)
+{
+  return now_ms;
+}
+
+const fake_stats_t *fake_stack_get_stats(void)
+{
+  return &stats;
+}
+
+void fake_stack_set_visible(uint8_t index, bool visible)
+{
+  fake_reflector_t *reflector = fake_stack_get_reflector(index);
+  if (reflector == NULL) {
+    return;
+  }
+  reflector->visible = visible;
+  if (!visible && reflector->connection != SL_BT_INVALID_CONNECTION_HANDLE) {
+    connection_t *connection = get_connection(reflector->connection);
+    if (!connection->closing) {
+      // The link is lost after the supervision timeout
+      connection->closing = true;
+      schedule_close(reflector->connection, delays.timeout_ms);
+    }
+  }
+  update_scan();
+}
+
+void fake_stack_inject_error(uint8_t index, cs_error_event_t error, sl_status_t sc)
+{
+  fake_reflector_t *reflector = fake_stack_get_reflector(index);
+  connection_t *connection = (reflector != NULL) ? get_connection(reflector->connection) : NULL;
+  if (connection == NULL || !connection->cs_created) {
+    return;
+  }
+  connection->error_cb(reflector->connection, error, sc);
+}
+
+void fake_stack_close(uint8_t index)
+{
+  fake_reflector_t *reflector = fake_stack_get_reflector(index);
+  connection_t *connection = (reflector != NULL) ? get_connection(reflector->connection) : NULL;
+  if (connection == NULL || connection->closing) {
+    return;
+  }
+  connection->closing = true;
+  schedule_close(reflector->connection, delays.close_ms);
+}
+
+bool fake_stack_run_cli(const char *line)
+{
+  char buffer[256];
+  char *argv[CLI_MAX_ARGS];
+  int argc = 0;
+
+  snprintf(buffer, sizeof(buffer), "%s", line);
+  for (char *token = strtok(buffer, " \t"); token != NULL && argc < (int)CLI_MAX_ARGS;
+       token = strtok(NULL, " \t")) {
+    argv[argc++] = token;
+  }
+  if (argc == 0) {
+    return false;
+  }
+  for (uint32_t g = 0u; g < CLI_MAX_GROUPS && cli_groups[g] != NULL; g++) {
+    for (const sl_cli_command_entry_t *entry = cli_groups[g]->command_table;
+         entry->name != NULL;
+         entry++) {
+      if (strcmp(entry->name, argv[0]) == 0) {
+        sl_cli_command_arg_t arguments = { .argc = argc, .argv = argv };
+        entry->command->function(&arguments);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+// Event queue, a binary heap ordered by time and then by insertion
+
+static bool event_before(const event_t *a, const event_t *b)
+{
+  return (a->time_ms < b->time_ms) || (a->time_ms == b->time_ms && a->seq < b->seq);
+}
+
+static void push_event(const event_t *event)
+{
+  if (queue_len >= EVENT_QUEUE_SIZE) {
+    fprintf(stderr, "fake_stack: event queue full\n");
+    exit(EXIT_FAILURE);
+  }
+  size_t i = queue_len++;
+  queue[i] = *event;
+  queue[i].seq = next_seq++;
+  while (i > 0u && event_before(&queue[i], &queue[(i - 1u) / 2u])) {
+    event_t tmp = queue[i];
+    queue[i] = queue[(i - 1u) / 2u];
+    queue[(i - 1u) / 2u] = tmp;
+    i = (i - 1u) / 2u;
+  }
+}
+
+static bool pop_event(event_t *event)
+{
+  if (queue_len == 0u) {
+    return false;
+  }
+  *event = queue[0];
+  queue[0] = queue[--queue_len];
+  size_t i = 0u;
+  for (;;) {
+    size_t smallest = i;
+    size_t left = 2u * i + 1u;
+    size_t right = left + 1u;
+    if (left < queue_len && event_before(&queue[left], &queue[smallest])) {
+      smallest = left;
+    }
+    if (right < queue_len && event_before(&queue[right], &queue[smallest])) {
+      smallest = right;
+    }
+    if (smallest == i) {
+      break;
+    }
+    event_t tmp = queue[i];
+    queue[i] = queue[smallest];
+    queue[smallest] = tmp;
+    i = smallest;
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Event dispatch
+
+static connection_t *get_connection(uint8_t handle)
+{
+  if (handle == 0u || handle > FAKE_MAX_CONNECTIONS) {
+    return NULL;
+  }
+  return &connections[handle - 1u];
+}
+
+static void dispatch(event_t *event)
+{
+  connection_t *connection = get_connection(event->connection);
+
+  switch (event->kind) {
+    case EVENT_CALL:
+      event->data.call.call(event->data.call.arg);
+      break;
+
+    case EVENT_TIMER:
+    {
+      app_timer_t *timer = event->data.timer;
+      if (!timer->running || timer->generation != event->generation) {
+        break;
+      }
+      if (timer->periodic) {
+        timer->due_ms += timer->timeout_ms;
+        event_t next = { .time_ms = timer->due_ms, .kind = EVENT_TIMER, .generation = timer->generation };
+        next.data.timer = timer;
+        push_event(&next);
+      } else {
+        timer->running = false;
+      }
+      timer->callback(timer, timer->data);
+      break;
+    }
+
+    case EVENT_BT:
+      if (connection != NULL
+          && (!connection->open || connection->generation != event->generation)) {
+        break;
+      }
+      if (connection != NULL
+          && SL_BT_MSG_ID(event->data.msg.header) == sl_bt_evt_connection_parameters_id) {
+        connection->security_mode = event->data.msg.data.evt_connection_parameters.security_mode;
+      }
+      sl_bt_on_event(&event->data.msg);
+      break;
+
+    case EVENT_CS:
+    {
+      if (connection == NULL || !connection->cs_created
+          || connection->cs_generation != event->generation) {
+        break;
+      }
+      uint32_t id = SL_BT_MSG_ID(event->data.msg.header);
+      sl_bt_on_event(&event->data.msg);
+      // The application may have deleted the instance from the event
+      if (!connection->cs_created || connection->cs_generation != event->generation) {
+        break;
+      }
+      if (id == sl_bt_evt_cs_config_complete_id) {
+        sl_bt_msg_t msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.header = sl_bt_evt_cs_procedure_enable_complete_id;
+        msg.data.evt_cs_procedure_enable_complete.connection = event->connection;
+        msg.data.evt_cs_procedure_enable_complete.state = 1u;
+        msg.data.evt_cs_procedure_enable_complete.procedure_interval = connection->config.max_procedure_interval;
+        deliver_bt_event(event->connection, delays.enable_ms, &msg, true);
+      } else if (id == sl_bt_evt_cs_procedure_enable_complete_id) {
+        run_procedure(event->connection);
+      }
+      break;
+    }
+
+    case EVENT_OPEN:
+      if (event->generation == scan_generation) {
+        open_connection(event->reflector);
+      }
+      break;
+
+    case EVENT_CLOSED:
+      if (connection != NULL && connection->open && connection->generation == event->generation) {
+        close_connection(event->connection);
+      }
+      break;
+
+    case EVENT_PROCEDURE:
+      if (connection != NULL && connection->cs_created
+          && connection->cs_generation == event->generation) {
+        run_procedure(event->connection);
+      }
+      break;
+
+    case EVENT_RESULT:
+      rtl_queue_len--;
+      if (connection != NULL && connection->cs_created
+          && connection->cs_generation == event->generation) {
+        deliver_result(event);
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+static void deliver_bt_event(uint8_t connection, uint32_t delay_ms, const sl_bt_msg_t *msg, bool cs_event)
+{
+  connection_t *conn = get_connection(connection);
+  event_t event = {
+    .time_ms = now_ms + delay_ms,
+    .kind = cs_event ? EVENT_CS : EVENT_BT,
+    .connection = connection,
+    .generation = (conn == NULL) ? 0u : (cs_event ? conn->cs_generation : conn->generation)
+  };
+  event.data.msg = *msg;
+  push_event(&event);
+}
+
+static void deliver_peer_manager_event(uint8_t evt_id, uint8_t connection)
+{
+  ble_peer_manager_evt_type_t event = { .evt_id = evt_id, .connection_id = connection };
+  ble_peer_manager_on_event_initiator(&event);
+}
+
+// -----------------------------------------------------------------------------
+// Scanning and connections
+
+static bool reflector_matches(const fake_reflector_t *reflector)
+{
+  if (filter_address_set && memcmp(&reflector->address, &filter_address, sizeof(bd_addr)) != 0) {
+    return false;
+  }
+  if (filter_uuid_set && (!reflector->advertise_ras || filter_uuid != CS_RAS_SERVICE_UUID)) {
+    return false;
+  }
+  if (filter_name_set) {
+    size_t name_len = strlen(reflector->name);
+    if (filter_name_prefix ? (name_len < filter_name_len) : (name_len != filter_name_len)) {
+      return false;
+    }
+    if (memcmp(reflector->name, filter_name, filter_name_len) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Point the scanner at the first matching advertisement
+static void update_scan(void)
+{
+  uint8_t open_count = 0u;
+  uint64_t first_ms = UINT64_MAX;
+  uint8_t first = 0u;
+
+  scan_generation++;
+  for (uint8_t i = 0u; i < FAKE_MAX_CONNECTIONS; i++) {
+    open_count += connections[i].open ? 1u : 0u;
+  }
+  if (!scanning || open_count >= max_connections) {
+    return;
+  }
+  for (uint8_t i = 0u; i < reflector_count; i++) {
+    fake_reflector_t *reflector = &reflectors[i];
+    if (!reflector->visible
+        || reflector->connection != SL_BT_INVALID_CONNECTION_HANDLE
+        || !reflector_matches(reflector)) {
+      continue;
+    }
+    uint64_t interval = reflector->adv_interval_ms;
+    uint64_t adv_ms = now_ms + (interval - (now_ms + interval - reflector->adv_phase_ms) % interval) % interval;
+    if (adv_ms < first_ms) {
+      first_ms = adv_ms;
+      first = i;
+    }
+  }
+  if (first_ms != UINT64_MAX) {
+    event_t event = {
+      .time_ms = first_ms + delays.open_ms,
+      .kind = EVENT_OPEN,
+      .reflector = first,
+      .generation = scan_generation
+    };
+    push_event(&event);
+  }
+}
+
+static void open_connection(uint8_t reflector_index)
+{
+  fake_reflector_t *reflector = &reflectors[reflector_index];
+  uint8_t handle = 0u;
+  sl_bt_msg_t msg;
+
+  for (uint8_t i = 0u; i < max_connections; i++) {
+    if (!connections[i].open) {
+      handle = (uint8_t)(i + 1u);
+      break;
+    }
+  }
+  if (handle == 0u) {
+    return;
+  }
+
+  // The advertisement that led to the connection
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_scanner_legacy_advertisement_report_id;
+  msg.data.evt_scanner_legacy_advertisement_report.address = reflector->address;
+  uint8_t *ad = msg.data.evt_scanner_legacy_advertisement_report.data.data;
+  size_t name_len = strlen(reflector->name);
+  size_t len = 0u;
+  ad[len++] = 2u;
+  ad[len++] = 0x01; // flags
+  ad[len++] = 0x06;
+  ad[len++] = (uint8_t)(name_len + 1u);
+  ad[len++] = 0x09; // complete local name
+  memcpy(&ad[len], reflector->name, name_len);
+  len += name_len;
+  if (reflector->advertise_ras) {
+    ad[len++] = 3u;
+    ad[len++] = 0x03; // complete list of 16-bit service UUIDs
+    ad[len++] = (uint8_t)(CS_RAS_SERVICE_UUID & 0xFF);
+    ad[len++] = (uint8_t)(CS_RAS_SERVICE_UUID >> 8);
+  }
+  msg.data.evt_scanner_legacy_advertisement_report.data.len = (uint8_t)len;
+  sl_bt_on_event(&msg);
+
+  connection_t *connection = get_connection(handle);
+  // Events of the previous connection on this handle must not match
+  uint32_t generation = connection->generation + 1u;
+  uint32_t cs_generation = connection->cs_generation + 1u;
+  memset(connection, 0, sizeof(*connection));
+  connection->open = true;
+  connection->generation = generation;
+  connection->cs_generation = cs_generation;
+  connection->reflector = reflector_index;
+  connection->security_mode = sl_bt_connection_mode1_level1;
+  reflector->connection = handle;
+  reflector->opened_ms = now_ms;
+  reflector->connections++;
+  uint32_t open_count = 0u;
+  for (uint8_t i = 0u; i < FAKE_MAX_CONNECTIONS; i++) {
+    open_count += connections[i].open ? 1u : 0u;
+  }
+  if (open_count > stats.open_max) {
+    stats.open_max = open_count;
+  }
+  // The peer manager stops scanning when it connects
+  scanning = false;
+  scan_generation++;
+  deliver_peer_manager_event(BLE_PEER_MANAGER_ON_CONN_OPENED_CENTRAL, handle);
+
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_connection_parameters_id;
+  msg.data.evt_connection_parameters.connection = handle;
+  msg.data.evt_connection_parameters.interval = CS_INITIATOR_DEFAULT_MAX_CONNECTION_INTERVAL;
+  msg.data.evt_connection_parameters.timeout = CS_INITIATOR_DEFAULT_TIMEOUT;
+  msg.data.evt_connection_parameters.security_mode = sl_bt_connection_mode1_level1;
+  deliver_bt_event(handle, 0u, &msg, false);
+
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_gatt_mtu_exchanged_id;
+  msg.data.evt_gatt_mtu_exchanged.connection = handle;
+  msg.data.evt_gatt_mtu_exchanged.mtu = 247u;
+  deliver_bt_event(handle, delays.mtu_ms, &msg, false);
+}
+
+static void schedule_close(uint8_t handle, uint32_t delay_ms)
+{
+  event_t event = {
+    .time_ms = now_ms + delay_ms,
+    .kind = EVENT_CLOSED,
+    .connection = handle,
+    .generation = get_connection(handle)->generation
+  };
+  push_event(&event);
+}
+
+static void close_connection(uint8_t handle)
+{
+  connection_t *connection = get_connection(handle);
+  fake_reflector_t *reflector = &reflectors[connection->reflector];
+
+  connection->open = false;
+  connection->closing = false;
+  connection->generation++;
+  reflector->connection = SL_BT_INVALID_CONNECTION_HANDLE;
+  deliver_peer_manager_event(BLE_PEER_MANAGER_ON_CONN_CLOSED, handle);
+  if (connection->cs_created) {
+    // The application has to delete the instance when the connection closes
+    stats.leaked_instances++;
+    connection->cs_created = false;
+    connection->cs_generation++;
+  }
+  update_scan();
+}
+
+// -----------------------------------------------------------------------------
+// CS procedures
+
+static void run_procedure(uint8_t handle)
+{
+  connection_t *connection = get_connection(handle);
+  fake_reflector_t *reflector = &reflectors[connection->reflector];
+  float period_ms = (float)connection->config.max_connection_interval * CONN_INTERVAL_UNIT_MS
+                    * (float)connection->config.max_procedure_interval;
+  event_t next = {
+    .time_ms = now_ms + (uint64_t)((period_ms >= 1.0f) ? period_ms : 1.0f),
+    .kind = EVENT_PROCEDURE,
+    .connection = handle,
+    .generation = connection->cs_generation
+  };
+  push_event(&next);
+
+  reflector->procedures++;
+  connection->ranging_counter++;
+  if (reflector->drop_results > 0u) {
+    reflector->drop_results--;
+    return;
+  }
+
+  // The RTL library processes one procedure at a time for all connections
+  event_t result = {
+    .kind = EVENT_RESULT,
+    .connection = handle,
+    .generation = connection->cs_generation
+  };
+  uint64_t start_ms = (rtl_busy_until_ms > now_ms) ? rtl_busy_until_ms : now_ms;
+  rtl_busy_until_ms = start_ms + delays.rtl_ms;
+  result.time_ms = rtl_busy_until_ms;
+  result.data.result.counter = connection->ranging_counter;
+  result.data.result.distance = get_distance(reflector, &result.data.result.velocity);
+  if (connection->rtl_config.algo_mode == SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY) {
+    // The static algorithm needs several procedures for one result
+    connection->static_count++;
+    result.data.result.intermediate = (connection->static_count < static_procedures);
+    result.data.result.progress = 100.0f * (float)connection->static_count / (float)static_procedures;
+    if (!result.data.result.intermediate) {
+      connection->static_count = 0u;
+    }
+  }
+  push_event(&result);
+  rtl_queue_len++;
+  if (rtl_queue_len > stats.rtl_queue_max) {
+    stats.rtl_queue_max = rtl_queue_len;
+  }
+}
+
+static void deliver_result(const event_t *event)
+{
+  connection_t *connection = get_connection(event->connection);
+  fake_reflector_t *reflector = &reflectors[connection->reflector];
+  uint8_t buffer[RESULT_MAX_FIELDS * RESULT_FIELD_SIZE];
+  size_t size = 0u;
+  float distance = event->data.result.distance;
+  float noise = 0.0f;
+
+  // The RTL library logs while it processes the procedure
+  for (uint32_t logged = 0u; rtl_log_callback != NULL && logged < rtl_log_size; logged += RTL_LOG_MESSAGE_SIZE) {
+    uint8_t message[RTL_LOG_MESSAGE_SIZE];
+    memset(message, (int)event->data.result.counter, sizeof(message));
+    rtl_log_callback(message, SL_MIN(rtl_log_size - logged, RTL_LOG_MESSAGE_SIZE));
+  }
+  if (event->data.result.intermediate) {
+    cs_intermediate_result_t intermediate = {
+      .connection = event->connection,
+      .progress_percentage = event->data.result.progress
+    };
+    connection->intermediate_result_cb(&intermediate, NULL);
+    return;
+  }
+  if (reflector->noise_mm > 0u) {
+    noise = (float)((int32_t)(random_u32() % (2u * reflector->noise_mm + 1u)) - (int32_t)reflector->noise_mm) / 1000.0f;
+  }
+  size = put_field(buffer, size, CS_RESULT_FIELD_DISTANCE_MAINMODE, distance + noise);
+  size = put_field(buffer, size, CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE, distance + 2.0f * noise);
+  size = put_field(buffer, size, CS_RESULT_FIELD_LIKELINESS_MAINMODE, reflector->likeliness);
+  size = put_field(buffer, size, CS_RESULT_FIELD_DISTANCE_RSSI, distance * 1.3f);
+  size = put_field(buffer, size, CS_RESULT_FIELD_VELOCITY_MAINMODE, event->data.result.velocity);
+  if (connection->config.cs_sub_mode != sl_bt_cs_submode_disabled) {
+    size = put_field(buffer, size, CS_RESULT_FIELD_DISTANCE_SUBMODE, distance + noise);
+    size = put_field(buffer, size, CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE, distance + 2.0f * noise);
+    size = put_field(buffer, size, CS_RESULT_FIELD_LIKELINESS_SUBMODE, reflector->likeliness);
+  }
+  if (connection->config.cs_main_mode == sl_bt_cs_mode_rtt) {
+    size = put_field(buffer, size, CS_RESULT_FIELD_BIT_ERROR_RATE, 0.0f);
+  }
+
+  cs_result_session_data_t session_data = {
+    .num_fields = (uint8_t)(size / RESULT_FIELD_SIZE),
+    .size = (uint16_t)size
+  };
+  cs_ranging_data_t ranging_data;
+  memset(&ranging_data, 0, sizeof(ranging_data));
+  reflector->results++;
+  connection->result_cb(event->connection,
+                        event->data.result.counter,
+                        buffer,
+                        &session_data,
+                        &ranging_data,
+                        NULL);
+}
+
+static size_t put_field(uint8_t *buffer, size_t offset, uint8_t type, float value)
+{
+  buffer[offset] = type;
+  memcpy(&buffer[offset + sizeof(uint8_t)], &value, sizeof(value));
+  return offset + RESULT_FIELD_SIZE;
+}
+
+// Position on a back and forth path between min_m and max_m
+static float get_distance(fake_reflector_t *reflector, float *velocity)
+{
+  float span = reflector->max_m - reflector->min_m;
+  float elapsed_s = (float)(now_ms - reflector->distance_time_ms) / 1000.0f;
+
+  *velocity = 0.0f;
+  if (reflector->speed_m_s == 0.0f || span <= 0.0f) {
+    return reflector->distance_m;
+  }
+  float x = fmodf(reflector->distance_m - reflector->min_m + reflector->speed_m_s * elapsed_s,
+                  2.0f * span);
+  if (x < 0.0f) {
+    x += 2.0f * span;
+  }
+  if (x > span) {
+    *velocity = -reflector->speed_m_s;
+    return reflector->min_m + 2.0f * span - x;
+  }
+  *velocity = reflector->speed_m_s;
+  return reflector->min_m + x;
+}
+
+static uint32_t random_u32(void)
+{
+  // xorshift32
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+// -----------------------------------------------------------------------------
+// sl_bt_api.h
+
+sl_status_t sl_bt_system_set_tx_power(int16_t min_power,
+                                      int16_t max_power,
+                                      int16_t *set_min,
+                                      int16_t *set_max)
+{
+  *set_min = min_power;
+  *set_max = (max_power > 100) ? 100 : max_power;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_gap_get_identity_address(bd_addr *address, uint8_t *type)
+{
+  *address = (bd_addr) { { 0x01, 0x00, 0x00, 0x57, 0x0B, 0x00 } };
+  *type = 0u;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_sm_increase_security(uint8_t connection)
+{
+  connection_t *conn = get_connection(connection);
+  sl_bt_msg_t msg;
+  if (conn == NULL || !conn->open) {
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_connection_parameters_id;
+  msg.data.evt_connection_parameters.connection = connection;
+  msg.data.evt_connection_parameters.interval = CS_INITIATOR_DEFAULT_MAX_CONNECTION_INTERVAL;
+  msg.data.evt_connection_parameters.timeout = CS_INITIATOR_DEFAULT_TIMEOUT;
+  msg.data.evt_connection_parameters.security_mode = sl_bt_connection_mode1_level2;
+  deliver_bt_event(connection, delays.security_ms, &msg, false);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_connection_get_security_status(uint8_t connection,
+                                                 uint8_t *security_mode,
+                                                 uint8_t *key_size,
+                                                 uint8_t *bonding_handle)
+{
+  connection_t *conn = get_connection(connection);
+  if (conn == NULL || !conn->open) {
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  *security_mode = conn->security_mode;
+  *key_size = 16u;
+  *bonding_handle = reflectors[conn->reflector].bonded ? conn->reflector : SL_BT_INVALID_BONDING_HANDLE;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_cs_read_remote_supported_capabilities(uint8_t connection)
+{
+  connection_t *conn = get_connection(connection);
+  sl_bt_msg_t msg;
+  if (conn == NULL || !conn->open) {
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_cs_read_remote_supported_capabilities_complete_id;
+  msg.data.evt_cs_read_remote_supported_capabilities_complete.connection = connection;
+  msg.data.evt_cs_read_remote_supported_capabilities_complete.num_antennas = reflectors[conn->reflector].num_antennas;
+  deliver_bt_event(connection, delays.capabilities_ms, &msg, false);
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_bt_cs_read_local_supported_capabilities(uint8_t *num_config,
+                                                       uint16_t *max_consecutive_procedures,
+                                                       uint8_t *num_antennas,
+                                                       uint8_t *max_antenna_paths,
+                                                       uint8_t *roles,
+                                                       uint8_t *modes,
+                                                       uint8_t *rtt_capability,
+                                                       uint8_t *rtt_aa_only,
+                                                       uint8_t *rtt_sounding,
+                                                       uint8_t *rtt_random_payload,
+                                                       uint8_t *cs_sync_phys,
+                                                       uint16_t *subfeatures,
+                                                       uint16_t *t_ip1_times,
+                                                       uint16_t *t_ip2_times,
+                                                       uint16_t *t_fcs_times,
+                                                       uint16_t *t_pm_times,
+                                                       uint8_t *t_sw_times,
+                                                       uint8_t *tx_snr_capability)
+{
+  uint8_t *u8_out[] = { num_config, max_antenna_paths, roles, modes, rtt_capability, rtt_aa_only,
+                        rtt_sounding, rtt_random_payload, cs_sync_phys, t_sw_times, tx_snr_capability };
+  uint16_t *u16_out[] = { max_consecutive_procedures, subfeatures, t_ip1_times, t_ip2_times,
+                          t_fcs_times, t_pm_times };
+  for (size_t i = 0u; i < sizeof(u8_out) / sizeof(u8_out[0]); i++) {
+    if (u8_out[i] != NULL) {
+      *u8_out[i] = 0u;
+    }
+  }
+  for (size_t i = 0u; i < sizeof(u16_out) / sizeof(u16_out[0]); i++) {
+    if (u16_out[i] != NULL) {
+      *u16_out[i] = 0u;
+    }
+  }
+  if (num_antennas != NULL) {
+    *num_antennas = local_antennas;
+  }
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// cs_initiator.h, cs_initiator_client.h, cs_result.h
+
+void cs_initiator_init(void)
+{
+}
+
+sl_status_t cs_initiator_create(const uint8_t conn_handle,
+                                cs_initiator_config_t *initiator_config,
+                                const rtl_config_t *rtl_config,
+                                cs_result_cb_t result_cb,
+                                cs_intermediate_result_cb_t intermediate_result_cb,
+                                cs_error_cb_t error_cb,
+                                uint8_t *instance_id)
+{
+  connection_t *connection = get_connection(conn_handle);
+  sl_bt_msg_t msg;
+
+  if (connection == NULL || !connection->open) {
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  if (connection->cs_created) {
+    return SL_STATUS_ALREADY_EXISTS;
+  }
+  if (reflectors[connection->reflector].fail_create > 0u) {
+    reflectors[connection->reflector].fail_create--;
+    stats.failed_creates++;
+    return SL_STATUS_FAIL;
+  }
+  if (connection->cs_creates > 0u && rtl_config->algo_mode != connection->rtl_config.algo_mode) {
+    reflectors[connection->reflector].algo_transitions++;
+  }
+  reflectors[connection->reflector].algo_mode = rtl_config->algo_mode;
+  reflectors[connection->reflector].creates++;
+  connection->cs_creates++;
+  connection->cs_created = true;
+  connection->cs_generation++;
+  connection->config = *initiator_config;
+  connection->rtl_config = *rtl_config;
+  connection->result_cb = result_cb;
+  connection->intermediate_result_cb = intermediate_result_cb;
+  connection->error_cb = error_cb;
+  connection->static_count = 0u;
+  reflectors[connection->reflector].procedure_interval = initiator_config->max_procedure_interval;
+  if (instance_id != NULL) {
+    *instance_id = (uint8_t)(conn_handle - 1u);
+  }
+  stats.creates++;
+
+  memset(&msg, 0, sizeof(msg));
+  msg.header = sl_bt_evt_cs_config_complete_id;
+  msg.data.evt_cs_config_complete.connection = conn_handle;
+  msg.data.evt_cs_config_complete.config_id = initiator_config->config_id;
+  msg.data.evt_cs_config_complete.state = 1u;
+  deliver_bt_event(conn_handle, delays.config_ms, &msg, true);
+  return SL_STATUS_OK;
+}
+
+sl_status_t cs_initiator_delete(const uint8_t conn_handle)
+{
+  connection_t *connection = get_connection(conn_handle);
+  if (connection == NULL) {
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  if (!connection->cs_created) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  connection->cs_created = false;
+  connection->cs_generation++;
+  stats.deletes++;
+  return SL_STATUS_OK;
+}
+
+void cs_initiator_apply_channel_map_preset(cs_channel_map_preset_t preset,
+                                           uint8_t *channel_map)
+{
+  static const uint8_t maps[][10] = {
+    { 0x10, 0x42, 0x08, 0x20, 0x84, 0x10, 0x42, 0x08, 0x21, 0x04 }, // low
+    { 0xB4, 0x6D, 0x5B, 0xB4, 0x6D, 0xDB, 0xB6, 0x6D, 0xDB, 0x16 }, // medium
+    { 0xFC, 0xFF, 0x7F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F }  // high
+  };
+  if (preset <= CS_CHANNEL_MAP_PRESET_HIGH) {
+    memcpy(channel_map, maps[preset], sizeof(maps[preset]));
+  }
+}
+
+sl_status_t cs_initiator_get_intervals(uint8_t main_mode,
+                                       uint8_t sub_mode,
+                                       cs_procedure_scheduling_t procedure_scheduling,
+                                       uint8_t channel_map_preset,
+                                       uint8_t algo_mode,
+                                       uint8_t antenna_config,
+                                       uint8_t use_real_time_ras_mode,
+                                       uint16_t *conn_interval,
+                                       uint16_t *proc_interval)
+{
+  (void)main_mode;
+  (void)sub_mode;
+  (void)channel_map_preset;
+  (void)algo_mode;
+  (void)antenna_config;
+  (void)use_real_time_ras_mode;
+  if (procedure_scheduling == CS_PROCEDURE_SCHEDULING_CUSTOM) {
+    return SL_STATUS_IDLE;
+  }
+  *conn_interval = 24u;
+  *proc_interval = (procedure_scheduling == CS_PROCEDURE_SCHEDULING_OPTIMIZED_FOR_FREQUENCY) ? 3u : 30u;
+  return SL_STATUS_OK;
+}
+
+sl_status_t cs_result_extract_field(cs_result_session_data_t *session_data,
+                                    cs_result_field_type_t field_type,
+                                    uint8_t *result,
+                                    uint8_t *value)
+{
+  for (size_t offset = 0u; offset + RESULT_FIELD_SIZE <= session_data->size; offset += RESULT_FIELD_SIZE) {
+    if (result[offset] == (uint8_t)field_type) {
+      memcpy(value, &result[offset + sizeof(uint8_t)], sizeof(float));
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_NOT_FOUND;
+}
+
+// -----------------------------------------------------------------------------
+// cs_initiator_cli.h, the values set by the CLI are the defaults
+
+uint8_t cs_initiator_cli_get_antenna_config_index(void)
+{
+  return CS_INITIATOR_DEFAULT_CS_TONE_ANTENNA_CONFIG_IDX_REQ;
+}
+
+uint8_t cs_initiator_cli_get_cs_sync_antenna_usage(void)
+{
+  return CS_INITIATOR_DEFAULT_CS_SYNC_ANTENNA_REQ;
+}
+
+uint8_t cs_initiator_cli_get_sub_mode(void)
+{
+  return CS_INITIATOR_DEFAULT_CS_SUB_MODE;
+}
+
+uint8_t cs_initiator_cli_get_mode(void)
+{
+  return CS_INITIATOR_DEFAULT_CS_MAIN_MODE;
+}
+
+uint8_t cs_initiator_cli_get_conn_phy(void)
+{
+  return CS_INITIATOR_DEFAULT_CONN_PHY;
+}
+
+uint8_t cs_initiator_cli_get_procedure_counter(void)
+{
+  return CS_INITIATOR_DEFAULT_MAX_PROCEDURE_COUNT;
+}
+
+uint8_t cs_initiator_cli_get_algo_mode(void)
+{
+  return CS_INITIATOR_DEFAULT_ALGO_MODE;
+}
+
+uint8_t cs_initiator_cli_get_preset(void)
+{
+  return CS_INITIATOR_DEFAULT_CHANNEL_MAP_PRESET;
+}
+
+// -----------------------------------------------------------------------------
+// cs_initiator_display.h, cs_antenna.h
+
+sl_status_t cs_initiator_display_init(void)
+{
+  return SL_STATUS_OK;
+}
+
+void cs_initiator_display_set_measurement_mode(uint8_t mode, uint8_t algo_mode)
+{
+  (void)mode;
+  (void)algo_mode;
+}
+
+void cs_initiator_display_update_data(uint8_t instance_num,
+                                      uint8_t conn_handle,
+                                      uint8_t status,
+                                      float distance,
+                                      float rssi_distance,
+                                      float likeliness,
+                                      float bit_error_rate,
+                                      float distance_raw,
+                                      float progress_percentage,
+                                      uint8_t algo_mode,
+                                      uint8_t cs_mode)
+{
+  (void)instance_num;
+  (void)conn_handle;
+  (void)status;
+  (void)distance;
+  (void)rssi_distance;
+  (void)likeliness;
+  (void)bit_error_rate;
+  (void)distance_raw;
+  (void)progress_percentage;
+  (void)algo_mode;
+  (void)cs_mode;
+}
+
+void cs_initiator_display_update(void)
+{
+}
+
+void cs_initiator_display_start_scanning(void)
+{
+}
+
+sl_status_t cs_antenna_configure(uint8_t wired)
+{
+  (void)wired;
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// ble_peer_manager_*.h
+
+void ble_peer_manager_central_init(void)
+{
+  scanning = false;
+  scan_generation++;
+}
+
+sl_status_t ble_peer_manager_central_create_connection(void)
+{
+  if (!scanning) {
+    scanning = true;
+    stats.scan_starts++;
+    update_scan();
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t ble_peer_manager_central_close_connection(uint8_t connection)
+{
+  connection_t *conn = get_connection(connection);
+  if (conn == NULL || !conn->open) {
+    stats.invalid_closes++;
+    return SL_STATUS_INVALID_HANDLE;
+  }
+  if (conn->closing) {
+    stats.duplicate_closes++;
+    return SL_STATUS_INVALID_STATE;
+  }
+  conn->closing = true;
+  schedule_close(connection, delays.close_ms);
+  return SL_STATUS_OK;
+}
+
+bd_addr *ble_peer_manager_get_bt_address(uint8_t connection)
+{
+  connection_t *conn = get_connection(connection);
+  if (conn == NULL || !conn->open) {
+    return NULL;
+  }
+  return &reflectors[conn->reflector].address;
+}
+
+void ble_peer_manager_filter_init(void)
+{
+  filter_name_set = false;
+  filter_uuid_set = false;
+  filter_address_set = false;
+  stats.filter_resets++;
+  update_scan();
+}
+
+sl_status_t ble_peer_manager_set_filter_device_name(const char *device_name,
+                                                    uint8_t device_name_len,
+                                                    bool is_prefix)
+{
+  if (device_name_len >= sizeof(filter_name)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  memcpy(filter_name, device_name, device_name_len);
+  filter_name_len = device_name_len;
+  filter_name_prefix = is_prefix;
+  filter_name_set = true;
+  update_scan();
+  return SL_STATUS_OK;
+}
+
+sl_status_t ble_peer_manager_set_filter_service_uuid16(sl_bt_uuid_16_t *service_uuid16)
+{
+  filter_uuid = (uint16_t)(service_uuid16->data[0] | (service_uuid16->data[1] << 8));
+  filter_uuid_set = true;
+  update_scan();
+  return SL_STATUS_OK;
+}
+
+sl_status_t ble_peer_manager_set_filter_bt_address(bd_addr *address)
+{
+  filter_address = *address;
+  filter_address_set = true;
+  update_scan();
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// app_timer.h
+
+sl_status_t app_timer_start(app_timer_t *timer,
+                            uint32_t timeout_ms,
+                            app_timer_callback_t callback,
+                            void *callback_data,
+                            bool is_periodic)
+{
+  timer->generation++;
+  timer->timeout_ms = (is_periodic && timeout_ms == 0u) ? 1u : timeout_ms;
+  timer->due_ms = now_ms + timer->timeout_ms;
+  timer->callback = callback;
+  timer->data = callback_data;
+  timer->periodic = is_periodic;
+  timer->running = true;
+  event_t event = { .time_ms = timer->due_ms, .kind = EVENT_TIMER, .generation = timer->generation };
+  event.data.timer = timer;
+  push_event(&event);
+  return SL_STATUS_OK;
+}
+
+sl_status_t app_timer_stop(app_timer_t *timer)
+{
+  timer->running = false;
+  timer->generation++;
+  return SL_STATUS_OK;
+}
+
+// -----------------------------------------------------------------------------
+// sl_sleeptimer.h
+
+uint64_t sl_sleeptimer_get_tick_count64(void)
+{
+  return now_ms * SLEEPTIMER_HZ / 1000u;
+}
+
+uint32_t sl_sleeptimer_get_tick_count(void)
+{
+  return (uint32_t)sl_sleeptimer_get_tick_count64();
+}
+
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick)
+{
+  return (uint32_t)((uint64_t)tick * 1000u / SLEEPTIMER_HZ);
+}
+
+sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick, uint64_t *ms)
+{
+  *ms = tick * 1000u / SLEEPTIMER_HZ;
+  return SL_STATUS_OK;
+}
+
+uint32_t sl_sleeptimer_get_timer_frequency(void)
+{
+  return SLEEPTIMER_HZ;
+}
+
+// -----------------------------------------------------------------------------
+// sl_memory_manager.h
+
+sl_status_t sl_memory_alloc(size_t size, sl_memory_block_type_t type, void **block)
+{
+  (void)type;
+  if (size > heap_size - stats.heap_used) {
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+  *block = calloc(1u, size);
+  if (*block == NULL) {
+    return SL_STATUS_ALLOCATION_FAILED;
+  }
+  stats.heap_used += size;
+  return SL_STATUS_OK;
+}
+
+size_t sl_memory_get_free_heap_size(void)
+{
+  return heap_size - stats.heap_used;
+}
+
+// -----------------------------------------------------------------------------
+// sl_power_manager.h
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em)
+{
+  if (em == SL_POWER_MANAGER_EM1) {
+    stats.em1_requirements++;
+  }
+}
+
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em)
+{
+  if (em == SL_POWER_MANAGER_EM1) {
+    stats.em1_requirements--;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// sl_core.h
+
+CORE_irqState_t fake_core_enter_atomic(void)
+{
+  return atomic_depth++;
+}
+
+void fake_core_exit_atomic(CORE_irqState_t state)
+{
+  if (atomic_depth == 0u || state != atomic_depth - 1u) {
+    fake_assert_failed(__FILE__, __LINE__, "unbalanced CORE_EXIT_ATOMIC()");
+  }
+  atomic_depth = state;
+}
+
+// -----------------------------------------------------------------------------
+// nvm3_default.h
+
+static nvm3_object_t *find_nvm3_object(nvm3_ObjectKey_t key)
+{
+  for (uint32_t i = 0u; i < NVM3_MAX_OBJECTS; i++) {
+    if (nvm3_objects[i].valid && nvm3_objects[i].key == key) {
+      return &nvm3_objects[i];
+    }
+  }
+  return NULL;
+}
+
+Ecode_t nvm3_readData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, void *value, size_t len)
+{
+  (void)h;
+  nvm3_object_t *object = find_nvm3_object(key);
+  if (object == NULL) {
+    return ECODE_NVM3_ERR_KEY_NOT_FOUND;
+  }
+  memcpy(value, object->data, SL_MIN(len, object->len));
+  return ECODE_NVM3_OK;
+}
+
+Ecode_t nvm3_writeData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, const void *value, size_t len)
+{
+  (void)h;
+  nvm3_object_t *object = find_nvm3_object(key);
+  for (uint32_t i = 0u; object == NULL && i < NVM3_MAX_OBJECTS; i++) {
+    if (!nvm3_objects[i].valid) {
+      object = &nvm3_objects[i];
+    }
+  }
+  if (object == NULL || len > NVM3_MAX_OBJECT_SIZE) {
+    return ECODE_NVM3_ERR_KEY_NOT_FOUND;
+  }
+  object->valid = true;
+  object->key = key;
+  object->len = len;
+  memcpy(object->data, value, len);
+  return ECODE_NVM3_OK;
+}
+
+Ecode_t nvm3_deleteObject(nvm3_Handle_t *h, nvm3_ObjectKey_t key)
+{
+  (void)h;
+  nvm3_object_t *object = find_nvm3_object(key);
+  if (object == NULL) {
+    return ECODE_NVM3_ERR_KEY_NOT_FOUND;
+  }
+  object->valid = false;
+  return ECODE_NVM3_OK;
+}
+
+// -----------------------------------------------------------------------------
+// sl_iostream.h, app_log.h, app_assert.h
+
+sl_status_t sl_iostream_write(sl_iostream_t *stream, const void *buffer, size_t buffer_length)
+{
+  if (stream == &console_stream) {
+    if (console_hook != NULL) {
+      console_hook((const uint8_t *)buffer, buffer_length);
+    }
+  } else if (stream == &log_stream) {
+    if (log_hook != NULL) {
+      log_hook((const uint8_t *)buffer, buffer_length);
+    }
+  } else if (stream == &trace_stream) {
+    stats.trace_bytes += (uint32_t)buffer_length;
+  }
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_iostream_printf(sl_iostream_t *stream, const char *format, ...)
+{
+  char buffer[512];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (len < 0) {
+    return SL_STATUS_FAIL;
+  }
+  return sl_iostream_write(stream, buffer, SL_MIN((size_t)len, sizeof(buffer) - 1u));
+}
+
+void fake_app_log(uint8_t level, const char *format, ...)
+{
+  char buffer[512];
+  va_list args;
+  (void)level;
+  va_start(args, format);
+  int len = vsnprintf(buffer, sizeof(buffer), format, args);
+  va_end(args);
+  if (len > 0) {
+    (void)sl_iostream_write(app_log_stream, buffer, SL_MIN((size_t)len, sizeof(buffer) - 1u));
+  }
+}
+
+sl_iostream_t *app_log_iostream_get(void)
+{
+  return app_log_stream;
+}
+
+void app_log_iostream_set(sl_iostream_t *stream)
+{
+  app_log_stream = stream;
+}
+
+void fake_assert_failed(const char *file, int line, const char *format, ...)
+{
+  va_list args;
+  fprintf(stderr, "[%8llu] assertion failed at %s:%d: ", (unsigned long long)now_ms, file, line);
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  fprintf(stderr, "\n");
+  exit(3);
+}
+
+// -----------------------------------------------------------------------------
+// sl_rtl_clib_api.h, sli_bgapi_trace.h
+
+enum sl_rtl_error_code sl_rtl_log_init(void)
+{
+  return SL_RTL_ERROR_SUCCESS;
+}
+
+enum sl_rtl_error_code sl_rtl_log_configure(sl_rtl_log_params *params)
+{
+  rtl_log_callback = params->log_callback_function;
+  return SL_RTL_ERROR_SUCCESS;
+}
+
+enum sl_rtl_error_code sl_rtl_log_deinit(void)
+{
+  rtl_log_callback = NULL;
+  return SL_RTL_ERROR_SUCCESS;
+}
+
+size_t sli_bgapi_trace_log_custom_message(uint8_t *data, size_t len)
+{
+  (void)data;
+  if (trace_rate > 0u) {
+    // The trace channel takes trace_rate bytes per second, and buffers at
+    // most TRACE_BUFFER_SIZE of them
+    trace_credit += (now_ms - trace_credit_ms) * trace_rate;
+    trace_credit = SL_MIN(trace_credit, (uint64_t)TRACE_BUFFER_SIZE * 1000u);
+    trace_credit_ms = now_ms;
+    len = SL_MIN(len, (size_t)(trace_credit / 1000u));
+    trace_credit -= (uint64_t)len * 1000u;
+  }
+  stats.trace_bytes += (uint32_t)len;
+  stats.rtl_log_bytes += (uint32_t)len;
+  return len;
+}
+
+void sli_bgapi_trace_start(void)
+{
+}
+
+void sli_bgapi_trace_sync(void)
+{
+}
+
+// -----------------------------------------------------------------------------
+// sl_cli.h
+
+bool sl_cli_command_add_command_group(sl_cli_handle_t handle, sl_cli_command_group_t *group)
+{
+  (void)handle;
+  for (uint32_t g = 0u; g < CLI_MAX_GROUPS; g++) {
+    if (cli_groups[g] == NULL) {
+      cli_groups[g] = group;
+      return true;
+    }
+  }
+  return false;
+}
+
+int sl_cli_get_argument_count(sl_cli_command_arg_t *arguments)
+{
+  return arguments->argc - 1;
+}
+
+uint8_t sl_cli_get_argument_uint8(sl_cli_command_arg_t *arguments, int n)
+{
+  return (n + 1 < arguments->argc) ? (uint8_t)strtoul(arguments->argv[n + 1], NULL, 0) : 0u;
+}
+
+uint32_t sl_cli_get_argument_uint32(sl_cli_command_arg_t *arguments, int n)
+{
+  return (n + 1 < arguments->argc) ? (uint32_t)strtoul(arguments->argv[n + 1], NULL, 0) : 0u;
+}
@@ -0,0 +1,211 @@
+/***************************************************************************//**
+ * @file
+ * @brief Scriptable fake of the Bluetooth stack and the CS initiator component.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef FAKE_STACK_H
+#define FAKE_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "fake_sdk.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define FAKE_MAX_REFLECTORS           32u
+#define FAKE_MAX_CONNECTIONS          32u
+#define FAKE_NAME_LEN                 32u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+/// Response times of the stack and the reflectors in ms
+typedef struct {
+  uint32_t open_ms;         ///< Connection set up after the advertisement is seen
+  uint32_t mtu_ms;          ///< MTU exchange after the connection has opened
+  uint32_t security_ms;     ///< Encryption after the security increase request
+  uint32_t capabilities_ms; ///< Remote CS capabilities after the request
+  uint32_t config_ms;       ///< CS configuration after the instance is created
+  uint32_t enable_ms;       ///< First procedure enabled after the configuration
+  uint32_t rtl_ms;          ///< RTL processing of one procedure, shared by all tags
+  uint32_t close_ms;        ///< Connection closed after the close request
+  uint32_t timeout_ms;      ///< Supervision timeout after a reflector is gone
+} fake_delays_t;
+
+/// A virtual reflector
+typedef struct {
+  // Set up by the driver
+  bd_addr address;
+  char name[FAKE_NAME_LEN];
+  bool advertise_ras;       ///< RAS service UUID in the advertisement
+  bool visible;             ///< Advertising and in range
+  bool bonded;              ///< Keeps a bonding with the initiator
+  uint8_t num_antennas;
+  uint32_t adv_interval_ms;
+  uint32_t adv_phase_ms;
+  float distance_m;         ///< Distance at distance_time_ms
+  float speed_m_s;          ///< Moves back and forth between min_m and max_m
+  float min_m;
+  float max_m;
+  float likeliness;
+  uint32_t noise_mm;        ///< Peak noise added to the distance
+  uint32_t fail_create;     ///< Number of CS instance creations to fail
+  uint32_t drop_results;    ///< Number of procedures without a result
+  // State, read by the driver
+  uint64_t distance_time_ms;
+  uint8_t connection;       ///< SL_BT_INVALID_CONNECTION_HANDLE if not connected
+  uint64_t opened_ms;
+  uint32_t connections;
+  uint32_t procedures;
+  uint32_t results;
+  uint32_t creates;             ///< Initiator instances created, on all connections
+  uint16_t procedure_interval;  ///< Of the last initiator instance created
+  uint8_t algo_mode;            ///< Of the last initiator instance created
+  uint32_t algo_transitions;    ///< Instances created with another algorithm
+                                ///< mode than the one before on the connection
+} fake_reflector_t;
+
+/// Counters of API misuse and resource use
+typedef struct {
+  uint32_t creates;              ///< CS instances created
+  uint32_t failed_creates;       ///< CS instance creations failed on purpose
+  uint32_t deletes;              ///< CS instances deleted
+  uint32_t duplicate_closes;     ///< Close requests of a connection already closing
+  uint32_t invalid_closes;       ///< Close requests of an unknown connection
+  uint32_t leaked_instances;     ///< CS instances left when their connection closed
+  uint32_t scan_starts;          ///< Scanning started
+  uint32_t filter_resets;        ///< ble_peer_manager_filter_init() calls
+  uint32_t open_max;             ///< Most connections open at once
+  uint32_t rtl_queue_max;        ///< Most procedures waiting for the RTL at once
+  uint32_t em1_requirements;     ///< EM1 requirements left
+  uint32_t trace_bytes;          ///< Bytes sent on the BGAPI trace channel
+  uint32_t rtl_log_bytes;        ///< RTL log bytes taken by the trace channel
+  size_t heap_used;              ///< Bytes allocated from the heap
+} fake_stats_t;
+
+/// Receives everything written to a stream
+typedef void (*fake_console_hook_t)(const uint8_t *data, size_t len);
+
+/// A call scheduled by the driver
+typedef void (*fake_call_t)(void *arg);
+
+// -----------------------------------------------------------------------------
+// Function declarations
+
+/**************************************************************************//**
+ * Reset the fake to the state before boot.
+ * @param[in] seed Seed of the noise and of the advertising phases.
+ *****************************************************************************/
+void fake_stack_init(uint32_t seed);
+
+/// Response times, may be changed until the first event is dispatched
+fake_delays_t *fake_stack_get_delays(void);
+
+/**************************************************************************//**
+ * Add a virtual reflector with the default settings.
+ * @return The reflector, NULL if there are FAKE_MAX_REFLECTORS already.
+ *****************************************************************************/
+fake_reflector_t *fake_stack_add_reflector(void);
+
+/// Reflector by index, NULL if out of range
+fake_reflector_t *fake_stack_get_reflector(uint8_t index);
+
+/// Number of reflectors
+uint8_t fake_stack_get_reflector_count(void);
+
+/// Free heap seen by the application at boot
+void fake_stack_set_heap_size(size_t size);
+
+/// Connection limit of the stack
+void fake_stack_set_max_connections(uint8_t count);
+
+/// Antennas of the initiator
+void fake_stack_set_local_antennas(uint8_t count);
+
+/// Procedures the static RTL algorithm needs for one result
+void fake_stack_set_static_procedures(uint8_t count);
+
+/**************************************************************************//**
+ * Set the RTL log load.
+ * @param[in] size Bytes the RTL library logs per procedure, in messages of at
+ *                 most 256 bytes.
+ * @param[in] rate Bytes per second the trace channel takes, 0 for no limit.
+ *****************************************************************************/
+void fake_stack_set_rtl_log(uint32_t size, uint32_t rate);
+
+/// Receive the console output
+void fake_stack_set_console_hook(fake_console_hook_t hook);
+
+/// Receive the app_log output. It has its own stream, like the RTT channel on
+/// the target, so that it does not mix with binary frames on the console.
+void fake_stack_set_log_hook(fake_console_hook_t hook);
+
+/// Queue the system boot event at the current time
+void fake_stack_boot(void);
+
+/**************************************************************************//**
+ * Call a function of the driver at a virtual time.
+ * @param[in] time_ms Virtual time, not earlier than now.
+ * @param[in] call Function to call.
+ * @param[in] arg Argument of the function.
+ *****************************************************************************/
+void fake_stack_schedule_call(uint64_t time_ms, fake_call_t call, void *arg);
+
+/**************************************************************************//**
+ * Advance the virtual time to the next event and dispatch it.
+ * @param[in] end_ms Events after this time are not dispatched.
+ * @return false if there is no event up to end_ms. The time is end_ms then.
+ *****************************************************************************/
+bool fake_stack_step(uint64_t end_ms);
+
+/// Virtual time since boot
+uint64_t fake_stack_get_time_ms(void);
+
+/// Counters
+const fake_stats_t *fake_stack_get_stats(void);
+
+/// Show or hide a reflector. A connected reflector that is hidden is lost
+/// after the supervision timeout.
+void fake_stack_set_visible(uint8_t index, bool visible);
+
+/// Report a CS error of the connection of a reflector to the application
+void fake_stack_inject_error(uint8_t index, cs_error_event_t error, sl_status_t sc);
+
+/// Close the connection of a reflector from the reflector side
+void fake_stack_close(uint8_t index);
+
+/**************************************************************************//**
+ * Run a command of the application CLI.
+ * @param[in] line Command name and arguments separated by spaces.
+ * @return false if the command is not registered.
+ *****************************************************************************/
+bool fake_stack_run_cli(const char *line);
+
+#endif // FAKE_STACK_H
@@ -0,0 +1,754 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host build of the CS initiator driven by virtual reflectors.
+ *
+ * Build and run with the Makefile in this directory:
+ *   make
+ *   ./build/default/host_initiator -n 4 -d 60000
+ *   ./build/default/host_initiator scenarios/reconnect.txt
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdlib.h>
+#include "fake_stack.h"
+#include "app_config.h"
+#include "output_frame.h"
+#include "rtl_log.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define MAX_LINES           256u
+#define MAX_LINE_LEN        256u
+#define MAX_ACTIONS         256u
+#define MAX_EXPECTS         64u
+#define STREAM_BUFFER_LEN   512u
+#define NO_TAG              0xFFu
+#define ALL_TAGS            0xFEu
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef struct {
+  uint32_t outputs;
+  uint32_t zones;
+  uint64_t opened_ms;       // Connection of the last output
+  uint64_t last_output_ms;
+  uint32_t ttfd_count;
+  uint64_t ttfd_sum_ms;
+  uint64_t ttfd_max_ms;
+  uint64_t ttfd_first_ms;   // First connection of the run
+  uint64_t ttfd_reconnect_sum_ms;
+  uint64_t gap_max_ms;
+  int32_t last_distance_mm;
+} tag_stats_t;
+
+typedef struct {
+  uint64_t time_ms;
+  char command[16];
+  uint8_t reflector;
+  char arg[MAX_LINE_LEN];
+} action_t;
+
+typedef struct {
+  char metric[32];
+  uint8_t reflector;
+  char op[3];
+  double value;
+  unsigned line;
+} expect_t;
+
+typedef struct {
+  uint8_t data[STREAM_BUFFER_LEN];
+  size_t len;
+  bool binary;
+  const char *name;
+} stream_parser_t;
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static tag_stats_t tag_stats[FAKE_MAX_REFLECTORS];
+static uint8_t tag_index_map[256];
+static uint32_t corrupt_frames;
+static bool verbose;
+static action_t actions[MAX_ACTIONS];
+static uint32_t action_count;
+static expect_t expects[MAX_EXPECTS];
+static uint32_t expect_count;
+static char lines[MAX_LINES][MAX_LINE_LEN];
+static uint32_t line_count;
+
+static stream_parser_t console_parser = {
+  .binary = (CS_INITIATOR_OUTPUT_FORMAT == CS_INITIATOR_OUTPUT_FORMAT_BINARY),
+  .name = "console"
+};
+static stream_parser_t log_parser = { .binary = false, .name = "log" };
+
+// -----------------------------------------------------------------------------
+// Application entry points
+
+void app_init(void);
+void app_process_action(void);
+
+// -----------------------------------------------------------------------------
+// Output parsing
+
+static uint8_t find_reflector(const uint8_t *address)
+{
+  for (uint8_t i = 0u; i < fake_stack_get_reflector_count(); i++) {
+    if (memcmp(fake_stack_get_reflector(i)->address.addr, address, 6u) == 0) {
+      return i;
+    }
+  }
+  return NO_TAG;
+}
+
+static void record_output(uint8_t index, int32_t distance_mm)
+{
+  fake_reflector_t *reflector = fake_stack_get_reflector(index);
+  tag_stats_t *stats = &tag_stats[index];
+  uint64_t now_ms = fake_stack_get_time_ms();
+
+  if (reflector == NULL) {
+    return;
+  }
+  if (stats->outputs == 0u || stats->opened_ms != reflector->opened_ms) {
+    // First output of a connection
+    uint64_t ttfd_ms = now_ms - reflector->opened_ms;
+    stats->opened_ms = reflector->opened_ms;
+    if (stats->ttfd_count == 0u) {
+      stats->ttfd_first_ms = ttfd_ms;
+    } else {
+      stats->ttfd_reconnect_sum_ms += ttfd_ms;
+    }
+    stats->ttfd_count++;
+    stats->ttfd_sum_ms += ttfd_ms;
+    if (ttfd_ms > stats->ttfd_max_ms) {
+      stats->ttfd_max_ms = ttfd_ms;
+    }
+  } else if (now_ms - stats->last_output_ms > stats->gap_max_ms) {
+    stats->gap_max_ms = now_ms - stats->last_output_ms;
+  }
+  stats->last_output_ms = now_ms;
+  stats->last_distance_mm = distance_mm;
+  stats->outputs++;
+}
+
+static void parse_text_line(const char *line)
+{
+  unsigned a[6];
+  long value;
+  int used = 0;
+
+  if (sscanf(line, "{\"id\": \"%2X:%2X:%2X:%2X:%2X:%2X\", %n",
+             &a[5], &a[4], &a[3], &a[2], &a[1], &a[0], &used) < 6 || used == 0) {
+    return;
+  }
+  uint8_t address[6] = { (uint8_t)a[0], (uint8_t)a[1], (uint8_t)a[2],
+                         (uint8_t)a[3], (uint8_t)a[4], (uint8_t)a[5] };
+  uint8_t index = find_reflector(address);
+  if (index == NO_TAG) {
+    return;
+  }
+  if (sscanf(line + used, "\"distance\": %ld", &value) == 1) {
+    record_output(index, (int32_t)value);
+  } else if (strncmp(line + used, "\"zone\"", 6u) == 0) {
+    tag_stats[index].zones++;
+  }
+}
+
+static void parse_frame(const uint8_t *frame, size_t len)
+{
+  uint8_t type;
+  output_frame_measurement_t measurement;
+  output_frame_tag_t tag;
+  output_frame_zone_t zone;
+
+  if (!output_frame_decode(frame, len, &type, &measurement, &tag, &zone)) {
+    corrupt_frames++;
+    return;
+  }
+  switch (type) {
+    case OUTPUT_FRAME_TYPE_TAG:
+      tag_index_map[tag.tag_index] = find_reflector(tag.address);
+      break;
+    case OUTPUT_FRAME_TYPE_MEASUREMENT:
+      record_output(tag_index_map[measurement.tag_index], measurement.distance_mm);
+      break;
+    case OUTPUT_FRAME_TYPE_ZONE:
+      if (tag_index_map[zone.tag_index] != NO_TAG) {
+        tag_stats[tag_index_map[zone.tag_index]].zones++;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+static void feed(stream_parser_t *parser, const uint8_t *data, size_t len)
+{
+  for (size_t i = 0u; i < len; i++) {
+    uint8_t byte = data[i];
+    bool end = parser->binary ? (byte == OUTPUT_FRAME_DELIMITER) : (byte == '\n');
+    if (!end) {
+      if (parser->len < STREAM_BUFFER_LEN - 1u) {
+        parser->data[parser->len++] = byte;
+      }
+      continue;
+    }
+    if (parser->binary) {
+      if (parser->len > 0u) {
+        parse_frame(parser->data, parser->len);
+      }
+    } else {
+      while (parser->len > 0u && parser->data[parser->len - 1u] == '\r') {
+        parser->len--;
+      }
+      parser->data[parser->len] = '\0';
+      if (verbose) {
+        printf("[%8llu] %s: %s\n",
+               (unsigned long long)fake_stack_get_time_ms(),
+               parser->name,
+               (const char *)parser->data);
+      }
+      parse_text_line((const char *)parser->data);
+    }
+    parser->len = 0u;
+  }
+}
+
+static void on_console(const uint8_t *data, size_t len)
+{
+  feed(&console_parser, data, len);
+}
+
+static void on_log(const uint8_t *data, size_t len)
+{
+#if APP_LOG_TOKENIZED
+  // Tokenized log frames, decoded by tools/log_token_decode
+  (void)data;
+  (void)len;
+#else
+  feed(&log_parser, data, len);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// Scenario
+
+static void run_action(void *arg)
+{
+  const action_t *action = (const action_t *)arg;
+  fake_reflector_t *reflector = fake_stack_get_reflector(action->reflector);
+
+  if (verbose) {
+    printf("[%8llu] scenario: %s %u %s\n",
+           (unsigned long long)fake_stack_get_time_ms(),
+           action->command,
+           action->reflector,
+           action->arg);
+  }
+  if (strcmp(action->command, "cli") == 0) {
+    if (!fake_stack_run_cli(action->arg)) {
+      fprintf(stderr, "unknown CLI command: %s\n", action->arg);
+    }
+    return;
+  }
+  if (reflector == NULL) {
+    return;
+  }
+  if (strcmp(action->command, "show") == 0) {
+    fake_stack_set_visible(action->reflector, true);
+  } else if (strcmp(action->command, "hide") == 0) {
+    fake_stack_set_visible(action->reflector, false);
+  } else if (strcmp(action->command, "close") == 0) {
+    fake_stack_close(action->reflector);
+  } else if (strcmp(action->command, "error") == 0) {
+    fake_stack_inject_error(action->reflector, (cs_error_event_t)atoi(action->arg), SL_STATUS_FAIL);
+  } else if (strcmp(action->command, "fail_create") == 0) {
+    reflector->fail_create = (uint32_t)atoi(action->arg);
+  } else if (strcmp(action->command, "drop") == 0) {
+    reflector->drop_results = (uint32_t)atoi(action->arg);
+  } else if (strcmp(action->command, "distance") == 0) {
+    reflector->distance_m = strtof(action->arg, NULL);
+    reflector->distance_time_ms = fake_stack_get_time_ms();
+  } else if (strcmp(action->command, "speed") == 0) {
+    reflector->speed_m_s = strtof(action->arg, NULL);
+    reflector->distance_time_ms = fake_stack_get_time_ms();
+  }
+}
+
+static bool parse_reflector(const char *text, uint8_t *reflector)
+{
+  if (strcmp(text, "*") == 0) {
+    *reflector = ALL_TAGS;
+    return true;
+  }
+  if (strcmp(text, "-") == 0) {
+    *reflector = NO_TAG;
+    return true;
+  }
+  char *end;
+  long value = strtol(text, &end, 10);
+  if (*end != '\0' || value < 0 || value >= FAKE_MAX_REFLECTORS) {
+    return false;
+  }
+  *reflector = (uint8_t)value;
+  return true;
+}
+
+static bool set_reflector_field(fake_reflector_t *reflector, const char *field, const char *value)
+{
+  if (strcmp(field, "antennas") == 0) {
+    reflector->num_antennas = (uint8_t)atoi(value);
+  } else if (strcmp(field, "distance") == 0) {
+    reflector->distance_m = strtof(value, NULL);
+  } else if (strcmp(field, "speed") == 0) {
+    reflector->speed_m_s = strtof(value, NULL);
+  } else if (strcmp(field, "min") == 0) {
+    reflector->min_m = strtof(value, NULL);
+  } else if (strcmp(field, "max") == 0) {
+    reflector->max_m = strtof(value, NULL);
+  } else if (strcmp(field, "likeliness") == 0) {
+    reflector->likeliness = strtof(value, NULL);
+  } else if (strcmp(field, "noise_mm") == 0) {
+    reflector->noise_mm = (uint32_t)atoi(value);
+  } else if (strcmp(field, "adv_interval") == 0) {
+    reflector->adv_interval_ms = (uint32_t)SL_MAX(atoi(value), 1);
+    reflector->adv_phase_ms %= reflector->adv_interval_ms;
+  } else if (strcmp(field, "visible") == 0) {
+    reflector->visible = (atoi(value) != 0);
+  } else if (strcmp(field, "bonded") == 0) {
+    reflector->bonded = (atoi(value) != 0);
+  } else if (strcmp(field, "ras") == 0) {
+    reflector->advertise_ras = (atoi(value) != 0);
+  } else if (strcmp(field, "name") == 0) {
+    snprintf(reflector->name, sizeof(reflector->name), "%.31s", value);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static bool set_delay(const char *stage, uint32_t value)
+{
+  fake_delays_t *delays = fake_stack_get_delays();
+  struct {
+    const char *name;
+    uint32_t *value;
+  } stages[] = {
+    { "open", &delays->open_ms },
+    { "mtu", &delays->mtu_ms },
+    { "security", &delays->security_ms },
+    { "capabilities", &delays->capabilities_ms },
+    { "config", &delays->config_ms },
+    { "enable", &delays->enable_ms },
+    { "rtl", &delays->rtl_ms },
+    { "close", &delays->close_ms },
+    { "timeout", &delays->timeout_ms }
+  };
+  for (size_t i = 0u; i < sizeof(stages) / sizeof(stages[0]); i++) {
+    if (strcmp(stages[i].name, stage) == 0) {
+      *stages[i].value = value;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool load_lines(const char *path)
+{
+  FILE *file = fopen(path, "r");
+  char line[MAX_LINE_LEN];
+  if (file == NULL) {
+    perror(path);
+    return false;
+  }
+  while (fgets(line, sizeof(line), file) != NULL && line_count < MAX_LINES) {
+    char *comment = strchr(line, '#');
+    if (comment != NULL) {
+      *comment = '\0';
+    }
+    line[strcspn(line, "\r\n")] = '\0';
+    snprintf(lines[line_count++], MAX_LINE_LEN, "%s", line);
+  }
+  fclose(file);
+  return true;
+}
+
+// Settings that are needed before the fake is set up
+static void parse_globals(uint32_t *reflectors, uint32_t *duration_ms, uint32_t *seed)
+{
+  for (uint32_t n = 0u; n < line_count; n++) {
+    char key[32];
+    unsigned long value;
+    if (sscanf(lines[n], "%31s %lu", key, &value) != 2) {
+      continue;
+    }
+    if (strcmp(key, "reflectors") == 0) {
+      *reflectors = (uint32_t)value;
+    } else if (strcmp(key, "duration") == 0) {
+      *duration_ms = (uint32_t)value;
+    } else if (strcmp(key, "seed") == 0) {
+      *seed = (uint32_t)value;
+    }
+  }
+}
+
+static bool parse_scenario(const char *path)
+{
+  for (uint32_t n = 0u; n < line_count; n++) {
+    char word[5][MAX_LINE_LEN];
+    int rest = 0;
+    int count = sscanf(lines[n], "%255s %255s %255s %255s %n%255s",
+                       word[0], word[1], word[2], word[3], &rest, word[4]);
+    bool ok = true;
+    if (count <= 0) {
+      continue;
+    }
+    if (strcmp(word[0], "reflectors") == 0 || strcmp(word[0], "duration") == 0
+        || strcmp(word[0], "seed") == 0) {
+      // Handled by parse_globals()
+    } else if (strcmp(word[0], "heap") == 0 && count >= 2) {
+      fake_stack_set_heap_size((size_t)strtoul(word[1], NULL, 0));
+    } else if (strcmp(word[0], "connections") == 0 && count >= 2) {
+      fake_stack_set_max_connections((uint8_t)atoi(word[1]));
+    } else if (strcmp(word[0], "local_antennas") == 0 && count >= 2) {
+      fake_stack_set_local_antennas((uint8_t)atoi(word[1]));
+    } else if (strcmp(word[0], "static_procedures") == 0 && count >= 2) {
+      fake_stack_set_static_procedures((uint8_t)atoi(word[1]));
+    } else if (strcmp(word[0], "rtl_log") == 0 && count >= 3) {
+      fake_stack_set_rtl_log((uint32_t)strtoul(word[1], NULL, 0), (uint32_t)strtoul(word[2], NULL, 0));
+    } else if (strcmp(word[0], "delay") == 0 && count >= 3) {
+      ok = set_delay(word[1], (uint32_t)strtoul(word[2], NULL, 0));
+    } else if (strcmp(word[0], "set") == 0 && count >= 4) {
+      uint8_t r;
+      ok = parse_reflector(word[1], &r) && r != NO_TAG;
+      for (uint8_t i = 0u; ok && i < fake_stack_get_reflector_count(); i++) {
+        if (r == ALL_TAGS || r == i) {
+          ok = set_reflector_field(fake_stack_get_reflector(i), word[2], word[3]);
+        }
+      }
+    } else if (strcmp(word[0], "at") == 0 && count >= 3 && action_count < MAX_ACTIONS) {
+      action_t *action = &actions[action_count++];
+      action->time_ms = strtoull(word[1], NULL, 0);
+      snprintf(action->command, sizeof(action->command), "%.15s", word[2]);
+      if (strcmp(word[2], "cli") == 0) {
+        // The rest of the line is the command
+        const char *command = strstr(lines[n], "cli") + 3;
+        command += strspn(command, " \t");
+        snprintf(action->arg, sizeof(action->arg), "%s", command);
+      } else {
+        ok = (count >= 4) && parse_reflector(word[3], &action->reflector);
+        if (ok && count >= 5) {
+          snprintf(action->arg, sizeof(action->arg), "%s", lines[n] + rest);
+        }
+      }
+      if (ok) {
+        fake_stack_schedule_call(action->time_ms, run_action, action);
+      }
+    } else if (strcmp(word[0], "expect") == 0 && count >= 5 && expect_count < MAX_EXPECTS) {
+      expect_t *expect = &expects[expect_count++];
+      snprintf(expect->metric, sizeof(expect->metric), "%.31s", word[1]);
+      snprintf(expect->op, sizeof(expect->op), "%.2s", word[3]);
+      expect->value = strtod(word[4], NULL);
+      expect->line = n + 1u;
+      ok = parse_reflector(word[2], &expect->reflector);
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      fprintf(stderr, "%s:%u: cannot parse '%s'\n", path, n + 1u, lines[n]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+// Report
+
+static bool get_tag_metric(const char *metric, uint8_t index, double *value)
+{
+  const tag_stats_t *stats = &tag_stats[index];
+  const fake_reflector_t *reflector = fake_stack_get_reflector(index);
+  if (strcmp(metric, "outputs") == 0) {
+    *value = stats->outputs;
+  } else if (strcmp(metric, "zones") == 0) {
+    *value = stats->zones;
+  } else if (strcmp(metric, "connections") == 0) {
+    *value = reflector->connections;
+  } else if (strcmp(metric, "procedures") == 0) {
+    *value = reflector->procedures;
+  } else if (strcmp(metric, "results") == 0) {
+    *value = reflector->results;
+  } else if (strcmp(metric, "ttfd_max") == 0) {
+    *value = (double)stats->ttfd_max_ms;
+  } else if (strcmp(metric, "ttfd_mean") == 0) {
+    *value = (stats->ttfd_count > 0u) ? (double)stats->ttfd_sum_ms / stats->ttfd_count : 0.0;
+  } else if (strcmp(metric, "ttfd_first") == 0) {
+    *value = (double)stats->ttfd_first_ms;
+  } else if (strcmp(metric, "ttfd_reconnect") == 0) {
+    *value = (stats->ttfd_count > 1u)
+             ? (double)stats->ttfd_reconnect_sum_ms / (stats->ttfd_count - 1u) : 0.0;
+  } else if (strcmp(metric, "creates") == 0) {
+    *value = reflector->creates;
+  } else if (strcmp(metric, "procedure_interval") == 0) {
+    *value = reflector->procedure_interval;
+  } else if (strcmp(metric, "static_mode") == 0) {
+    *value = (reflector->algo_mode == SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY) ? 1.0 : 0.0;
+  } else if (strcmp(metric, "algo_transitions") == 0) {
+    *value = reflector->algo_transitions;
+  } else if (strcmp(metric, "gap_max") == 0) {
+    *value = (double)stats->gap_max_ms;
+  } else if (strcmp(metric, "distance") == 0) {
+    *value = stats->last_distance_mm;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static bool get_global_metric(const char *metric, double *value)
+{
+  const fake_stats_t *stats = fake_stack_get_stats();
+  rtl_log_stats_t rtl_log_stats;
+  rtl_log_get_stats(&rtl_log_stats);
+  struct {
+    const char *name;
+    double value;
+  } metrics[] = {
+    { "creates", stats->creates },
+    { "failed_creates", stats->failed_creates },
+    { "deletes", stats->deletes },
+    { "duplicate_closes", stats->duplicate_closes },
+    { "invalid_closes", stats->invalid_closes },
+    { "leaked_instances", stats->leaked_instances },
+    { "scan_starts", stats->scan_starts },
+    { "filter_resets", stats->filter_resets },
+    { "open_max", stats->open_max },
+    { "rtl_queue_max", stats->rtl_queue_max },
+    { "em1_requirements", stats->em1_requirements },
+    { "trace_bytes", stats->trace_bytes },
+    { "rtl_log_bytes", stats->rtl_log_bytes },
+    { "rtl_log_dropped", rtl_log_stats.dropped_messages },
+    { "rtl_log_max", rtl_log_stats.high_watermark },
+    { "heap_used", (double)stats->heap_used },
+    { "corrupt_frames", corrupt_frames }
+  };
+  for (size_t i = 0u; i < sizeof(metrics) / sizeof(metrics[0]); i++) {
+    if (strcmp(metrics[i].name, metric) == 0) {
+      *value = metrics[i].value;
+      return true;
+    }
+  }
+  if (strcmp(metric, "outputs") == 0) {
+    *value = 0.0;
+    for (uint8_t i = 0u; i < fake_stack_get_reflector_count(); i++) {
+      *value += tag_stats[i].outputs;
+    }
+    return true;
+  }
+  if (strcmp(metric, "served_tags") == 0) {
+    *value = 0.0;
+    for (uint8_t i = 0u; i < fake_stack_get_reflector_count(); i++) {
+      *value += (tag_stats[i].outputs > 0u) ? 1.0 : 0.0;
+    }
+    return true;
+  }
+  return false;
+}
+
+static bool compare(double actual, const char *op, double expected)
+{
+  if (strcmp(op, "==") == 0) {
+    return actual == expected;
+  } else if (strcmp(op, "!=") == 0) {
+    return actual != expected;
+  } else if (strcmp(op, "<") == 0) {
+    return actual < expected;
+  } else if (strcmp(op, "<=") == 0) {
+    return actual <= expected;
+  } else if (strcmp(op, ">") == 0) {
+    return actual > expected;
+  } else if (strcmp(op, ">=") == 0) {
+    return actual >= expected;
+  }
+  return false;
+}
+
+static bool check_expects(void)
+{
+  bool passed = true;
+  for (uint32_t e = 0u; e < expect_count; e++) {
+    const expect_t *expect = &expects[e];
+    double actual;
+    for (uint8_t i = 0u; i < fake_stack_get_reflector_count() || expect->reflector == NO_TAG; i++) {
+      bool known;
+      if (expect->reflector == NO_TAG) {
+        known = get_global_metric(expect->metric, &actual);
+      } else if (expect->reflector == ALL_TAGS || expect->reflector == i) {
+        known = get_tag_metric(expect->metric, i, &actual);
+      } else {
+        continue;
+      }
+      if (!known) {
+        printf("FAIL line %u: unknown metric %s\n", expect->line, expect->metric);
+        passed = false;
+      } else if (!compare(actual, expect->op, expect->value)) {
+        printf("FAIL line %u: %s", expect->line, expect->metric);
+        if (expect->reflector != NO_TAG) {
+          printf(" of tag %u", i);
+        }
+        printf(" is %g, expected %s %g\n", actual, expect->op, expect->value);
+        passed = false;
+      }
+      if (expect->reflector == NO_TAG) {
+        break;
+      }
+    }
+  }
+  return passed;
+}
+
+static void print_report(uint64_t duration_ms)
+{
+  const fake_stats_t *stats = fake_stack_get_stats();
+  printf("%-3s %-17s %5s %6s %7s %7s %9s %9s %8s %9s\n",
+         "tag", "address", "conns", "procs", "results", "outputs",
+         "ttfd mean", "ttfd max", "gap max", "rate/s");
+  for (uint8_t i = 0u; i < fake_stack_get_reflector_count(); i++) {
+    const fake_reflector_t *reflector = fake_stack_get_reflector(i);
+    const tag_stats_t *tag = &tag_stats[i];
+    const uint8_t *a = reflector->address.addr;
+    printf("%-3u %02X:%02X:%02X:%02X:%02X:%02X %5u %6u %7u %7u %9.0f %9llu %8llu %9.2f\n",
+           i, a[5], a[4], a[3], a[2], a[1], a[0],
+           reflector->connections,
+           reflector->procedures,
+           reflector->results,
+           tag->outputs,
+           (tag->ttfd_count > 0u) ? (double)tag->ttfd_sum_ms / tag->ttfd_count : 0.0,
+           (unsigned long long)tag->ttfd_max_ms,
+           (unsigned long long)tag->gap_max_ms,
+           1000.0 * tag->outputs / (double)duration_ms);
+  }
+  printf("creates %u, failed creates %u, deletes %u, leaked instances %u\n",
+         stats->creates, stats->failed_creates, stats->deletes, stats->leaked_instances);
+  printf("duplicate closes %u, invalid closes %u, scan starts %u, filter resets %u\n",
+         stats->duplicate_closes, stats->invalid_closes, stats->scan_starts, stats->filter_resets);
+  printf("RTL queue max %u, heap used %zu bytes, corrupt frames %u\n",
+         stats->rtl_queue_max, stats->heap_used, corrupt_frames);
+}
+
+// -----------------------------------------------------------------------------
+// Main
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "usage: %s [-n reflectors] [-d duration_ms] [-s seed] [-v] [scenario]\n",
+          name);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t reflectors = 4u;
+  uint32_t duration_ms = 60000u;
+  uint32_t seed = 1u;
+  long option_reflectors = -1;
+  long option_duration_ms = -1;
+  long option_seed = -1;
+  const char *scenario = NULL;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:d:s:vh")) != -1) {
+    switch (option) {
+      case 'n':
+        option_reflectors = strtol(optarg, NULL, 0);
+        break;
+      case 'd':
+        option_duration_ms = strtol(optarg, NULL, 0);
+        break;
+      case 's':
+        option_seed = strtol(optarg, NULL, 0);
+        break;
+      case 'v':
+        verbose = true;
+        break;
+      default:
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+  }
+  if (optind < argc) {
+    scenario = argv[optind];
+    if (!load_lines(scenario)) {
+      return EXIT_FAILURE;
+    }
+    parse_globals(&reflectors, &duration_ms, &seed);
+  }
+  // The command line overrides the scenario
+  reflectors = (option_reflectors >= 0) ? (uint32_t)option_reflectors : reflectors;
+  duration_ms = (option_duration_ms >= 0) ? (uint32_t)option_duration_ms : duration_ms;
+  seed = (option_seed >= 0) ? (uint32_t)option_seed : seed;
+  if (reflectors > FAKE_MAX_REFLECTORS) {
+    fprintf(stderr, "at most %u reflectors\n", FAKE_MAX_REFLECTORS);
+    return EXIT_FAILURE;
+  }
+
+  fake_stack_init(seed);
+  memset(tag_index_map, NO_TAG, sizeof(tag_index_map));
+  for (uint32_t i = 0u; i < reflectors; i++) {
+    (void)fake_stack_add_reflector();
+  }
+  if (scenario != NULL && !parse_scenario(scenario)) {
+    return EXIT_FAILURE;
+  }
+  fake_stack_set_console_hook(on_console);
+  fake_stack_set_log_hook(on_log);
+
+  app_init();
+  fake_stack_boot();
+  while (fake_stack_step(duration_ms)) {
+    app_process_action();
+  }
+  app_process_action();
+
+  print_report(duration_ms);
+  if (!check_expects()) {
+    return EXIT_FAILURE;
+  }
+  if (expect_count > 0u) {
+    printf("PASS %u expectations\n", expect_count);
+  }
+  return EXIT_SUCCESS;
+}
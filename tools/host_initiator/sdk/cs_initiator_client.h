@@ -0,0 +1,3 @@
+// Host build, see fake_sdk.h
+#include "fake_sdk.h"
+#include "cs_initiator_config.h"
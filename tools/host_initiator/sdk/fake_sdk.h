@@ -0,0 +1,839 @@
+/***************************************************************************//**
+ * @file
+ * @brief Declarations of the SDK parts used by the initiator, for the host build.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Only the types, constants and functions the initiator sources and the
+// NCP modules built on the host use are declared, grouped by the SDK header
+// they come from. Every SDK header they include is a one line file in this
+// directory that includes this one. Values of constants are not those of the SDK unless
+// the application depends on them.
+
+#ifndef FAKE_SDK_H
+#define FAKE_SDK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// sl_status.h
+
+typedef uint32_t sl_status_t;
+
+#define SL_STATUS_OK                      ((sl_status_t)0x0000)
+#define SL_STATUS_FAIL                    ((sl_status_t)0x0001)
+#define SL_STATUS_INVALID_STATE           ((sl_status_t)0x0002)
+#define SL_STATUS_NOT_READY               ((sl_status_t)0x0003)
+#define SL_STATUS_IN_PROGRESS             ((sl_status_t)0x0005)
+#define SL_STATUS_IDLE                    ((sl_status_t)0x000A)
+#define SL_STATUS_NOT_SUPPORTED           ((sl_status_t)0x000F)
+#define SL_STATUS_ALLOCATION_FAILED       ((sl_status_t)0x0019)
+#define SL_STATUS_EMPTY                   ((sl_status_t)0x001B)
+#define SL_STATUS_FULL                    ((sl_status_t)0x001C)
+#define SL_STATUS_WOULD_OVERFLOW          ((sl_status_t)0x001D)
+#define SL_STATUS_INVALID_PARAMETER       ((sl_status_t)0x0021)
+#define SL_STATUS_INVALID_HANDLE          ((sl_status_t)0x0024)
+#define SL_STATUS_INVALID_INDEX           ((sl_status_t)0x0026)
+#define SL_STATUS_NOT_FOUND               ((sl_status_t)0x0030)
+#define SL_STATUS_ALREADY_EXISTS          ((sl_status_t)0x0034)
+#define SL_STATUS_FLASH_PROGRAM_FAILED    ((sl_status_t)0x004A)
+
+// -----------------------------------------------------------------------------
+// sl_common.h, sl_enum.h
+
+#define SL_ENUM(name)                     typedef uint8_t name; enum name##_enum
+#define SL_MIN(a, b)                      (((a) < (b)) ? (a) : (b))
+#define SL_MAX(a, b)                      (((a) > (b)) ? (a) : (b))
+#define SL_WEAK                           __attribute__((weak))
+#define SL_ATTRIBUTE_PACKED               __attribute__((packed))
+#define SL_PACK_START(x)
+#define SL_PACK_END()
+
+// -----------------------------------------------------------------------------
+// sl_bt_api.h
+
+#define SL_BT_INVALID_CONNECTION_HANDLE   ((uint8_t)0xFF)
+#define SL_BT_INVALID_BONDING_HANDLE      ((uint8_t)0xFF)
+#define SL_BT_MSG_ID(header)              ((header) & 0xffff00f8)
+
+typedef struct {
+  uint8_t addr[6];
+} bd_addr;
+
+typedef struct {
+  uint8_t data[2];
+} sl_bt_uuid_16_t;
+
+typedef struct {
+  uint8_t data[10];
+} sl_bt_cs_channel_map_t;
+
+typedef struct {
+  uint8_t len;
+  uint8_t data[255];
+} uint8array;
+
+enum {
+  sl_bt_gap_phy_1m = 0x1,
+  sl_bt_gap_phy_2m = 0x2,
+  sl_bt_gap_phy_coded = 0x4
+};
+
+enum {
+  sl_bt_gap_phy_coding_1m_uncoded = 0x1,
+  sl_bt_gap_phy_coding_2m_uncoded = 0x2,
+  sl_bt_gap_phy_coding_125k_coded = 0x4,
+  sl_bt_gap_phy_coding_500k_coded = 0x8
+};
+
+enum {
+  sl_bt_connection_mode1_level1 = 0x0,
+  sl_bt_connection_mode1_level2 = 0x1,
+  sl_bt_connection_mode1_level3 = 0x2,
+  sl_bt_connection_mode1_level4 = 0x3
+};
+
+enum {
+  sl_bt_cs_mode_rtt = 0x1,
+  sl_bt_cs_mode_pbr = 0x2,
+  sl_bt_cs_submode_disabled = 0xff
+};
+
+enum {
+  sl_bt_cs_rtt_type_aa_only = 0x0,
+  sl_bt_cs_rtt_type_fractional_32_bit_sounding = 0x1,
+  sl_bt_cs_rtt_type_fractional_96_bit_sounding = 0x2,
+  sl_bt_cs_rtt_type_fractional_32_bit_random = 0x3,
+  sl_bt_cs_rtt_type_fractional_64_bit_random = 0x4,
+  sl_bt_cs_rtt_type_fractional_96_bit_random = 0x5,
+  sl_bt_cs_rtt_type_fractional_128_bit_random = 0x6
+};
+
+enum {
+  sl_bt_cs_channel_selection_algorithm_3b = 0x0,
+  sl_bt_cs_channel_selection_algorithm_3c = 0x1
+};
+
+enum {
+  sl_bt_cs_ch3c_shape_hat = 0x0,
+  sl_bt_cs_ch3c_shape_x = 0x1
+};
+
+enum {
+  sl_bt_scanner_discover_limited = 0x0,
+  sl_bt_scanner_discover_generic = 0x1,
+  sl_bt_scanner_discover_observation = 0x2
+};
+
+enum {
+  sl_bt_scanner_scan_mode_passive = 0x0,
+  sl_bt_scanner_scan_mode_active = 0x1
+};
+
+#define sl_bt_evt_system_boot_id                                   0x000100a0
+#define sl_bt_evt_connection_opened_id                             0x000600a0
+#define sl_bt_evt_connection_parameters_id                         0x010600a0
+#define sl_bt_evt_connection_closed_id                             0x020600a0
+#define sl_bt_evt_gatt_mtu_exchanged_id                            0x000900a0
+#define sl_bt_evt_scanner_legacy_advertisement_report_id           0x000500a0
+#define sl_bt_evt_scanner_extended_advertisement_report_id         0x020500a0
+#define sl_bt_evt_cs_read_remote_supported_capabilities_complete_id 0x005900a0
+#define sl_bt_evt_cs_config_complete_id                            0x025900a0
+#define sl_bt_evt_cs_procedure_enable_complete_id                  0x045900a0
+#define sl_bt_evt_cs_result_id                                     0x055900a0
+
+typedef struct {
+  uint16_t major;
+  uint16_t minor;
+} sl_bt_evt_system_boot_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t interval;
+  uint16_t latency;
+  uint16_t timeout;
+  uint8_t security_mode;
+  uint16_t txsize;
+} sl_bt_evt_connection_parameters_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t mtu;
+} sl_bt_evt_gatt_mtu_exchanged_t;
+
+typedef struct {
+  uint8_t event_flags;
+  bd_addr address;
+  uint8_t address_type;
+  uint8_t bonding;
+  int8_t rssi;
+  uint8_t channel;
+  bd_addr target_address;
+  uint8_t target_address_type;
+  uint8array data;
+} sl_bt_evt_scanner_advertisement_report_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t status;
+  uint8_t num_config;
+  uint16_t max_consecutive_procedures;
+  uint8_t num_antennas;
+  uint8_t max_antenna_paths;
+  uint8_t roles;
+  uint8_t modes;
+  uint8_t rtt_capability;
+  uint8_t rtt_aa_only;
+  uint8_t rtt_sounding;
+  uint8_t rtt_random_payload;
+  uint8_t cs_sync_phys;
+  uint16_t subfeatures;
+  uint16_t t_ip1_times;
+  uint16_t t_ip2_times;
+  uint16_t t_fcs_times;
+  uint16_t t_pm_times;
+  uint8_t t_sw_times;
+  uint8_t tx_snr_capability;
+} sl_bt_evt_cs_read_remote_supported_capabilities_complete_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t status;
+  uint8_t config_id;
+  uint8_t state;
+} sl_bt_evt_cs_config_complete_t;
+
+typedef struct {
+  uint8_t connection;
+  uint16_t status;
+  uint8_t config_id;
+  uint8_t state;
+  uint8_t tone_antenna_config_selection;
+  int8_t selected_tx_power;
+  uint32_t subevent_len;
+  uint8_t subevents_per_event;
+  uint16_t subevent_interval;
+  uint16_t event_interval;
+  uint16_t procedure_interval;
+  uint16_t procedure_count;
+  uint16_t max_procedure_len;
+} sl_bt_evt_cs_procedure_enable_complete_t;
+
+typedef struct {
+  uint32_t header;
+  union {
+    sl_bt_evt_system_boot_t evt_system_boot;
+    sl_bt_evt_connection_parameters_t evt_connection_parameters;
+    sl_bt_evt_gatt_mtu_exchanged_t evt_gatt_mtu_exchanged;
+    sl_bt_evt_scanner_advertisement_report_t evt_scanner_legacy_advertisement_report;
+    sl_bt_evt_scanner_advertisement_report_t evt_scanner_extended_advertisement_report;
+    sl_bt_evt_cs_read_remote_supported_capabilities_complete_t evt_cs_read_remote_supported_capabilities_complete;
+    sl_bt_evt_cs_config_complete_t evt_cs_config_complete;
+    sl_bt_evt_cs_procedure_enable_complete_t evt_cs_procedure_enable_complete;
+  } data;
+} sl_bt_msg_t;
+
+void sl_bt_on_event(sl_bt_msg_t *evt);
+sl_status_t sl_bt_system_set_tx_power(int16_t min_power,
+                                      int16_t max_power,
+                                      int16_t *set_min,
+                                      int16_t *set_max);
+sl_status_t sl_bt_gap_get_identity_address(bd_addr *address, uint8_t *type);
+sl_status_t sl_bt_sm_increase_security(uint8_t connection);
+sl_status_t sl_bt_connection_get_security_status(uint8_t connection,
+                                                 uint8_t *security_mode,
+                                                 uint8_t *key_size,
+                                                 uint8_t *bonding_handle);
+sl_status_t sl_bt_cs_read_remote_supported_capabilities(uint8_t connection);
+// User message of the NCP, the stack copies the message before returning
+void sl_bt_send_evt_user_cs_service_message_to_host(uint8_t message_len, const uint8_t *message);
+bool sl_bt_event_pending(void);
+sl_status_t sl_bt_cs_read_local_supported_capabilities(uint8_t *num_config,
+                                                       uint16_t *max_consecutive_procedures,
+                                                       uint8_t *num_antennas,
+                                                       uint8_t *max_antenna_paths,
+                                                       uint8_t *roles,
+                                                       uint8_t *modes,
+                                                       uint8_t *rtt_capability,
+                                                       uint8_t *rtt_aa_only,
+                                                       uint8_t *rtt_sounding,
+                                                       uint8_t *rtt_random_payload,
+                                                       uint8_t *cs_sync_phys,
+                                                       uint16_t *subfeatures,
+                                                       uint16_t *t_ip1_times,
+                                                       uint16_t *t_ip2_times,
+                                                       uint16_t *t_fcs_times,
+                                                       uint16_t *t_pm_times,
+                                                       uint8_t *t_sw_times,
+                                                       uint8_t *tx_snr_capability);
+
+// -----------------------------------------------------------------------------
+// sl_bt_version.h
+
+#define SL_BT_VERSION_MAJOR               10
+#define SL_BT_VERSION_MINOR               0
+#define SL_BT_VERSION_PATCH               0
+#define SL_BT_VERSION_HASH                { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }
+
+// -----------------------------------------------------------------------------
+// sl_rtl_clib_api.h
+
+enum sl_rtl_error_code {
+  SL_RTL_ERROR_SUCCESS = 0,
+  SL_RTL_ERROR_ARGUMENT,
+  SL_RTL_ERROR_NOT_INITIALIZED
+};
+
+enum sl_rtl_cs_algo_mode {
+  SL_RTL_CS_ALGO_MODE_REAL_TIME_BASIC = 0,
+  SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY = 1,
+  SL_RTL_CS_ALGO_MODE_REAL_TIME_FAST = 2
+};
+
+#define SL_RTL_LOG_SDK_VERSION_CHAR_ARRAY_MAX_SIZE      64
+#define SL_RTL_LOG_COMMAND_LINE_OPTIONS_MAX_SIZE        64
+
+typedef void (*sl_rtl_log_callback_t)(uint8_t *log_data, size_t log_data_len);
+
+typedef struct {
+  sl_rtl_log_callback_t log_callback_function;
+  char sdk_version[SL_RTL_LOG_SDK_VERSION_CHAR_ARRAY_MAX_SIZE];
+  char command_line_options[SL_RTL_LOG_COMMAND_LINE_OPTIONS_MAX_SIZE];
+} sl_rtl_log_params;
+
+enum sl_rtl_error_code sl_rtl_log_init(void);
+enum sl_rtl_error_code sl_rtl_log_configure(sl_rtl_log_params *params);
+enum sl_rtl_error_code sl_rtl_log_deinit(void);
+
+// -----------------------------------------------------------------------------
+// cs_result.h
+
+typedef enum {
+  CS_RESULT_FIELD_DISTANCE_MAINMODE = 0,
+  CS_RESULT_FIELD_DISTANCE_SUBMODE,
+  CS_RESULT_FIELD_DISTANCE_RAW_MAINMODE,
+  CS_RESULT_FIELD_DISTANCE_RAW_SUBMODE,
+  CS_RESULT_FIELD_LIKELINESS_MAINMODE,
+  CS_RESULT_FIELD_LIKELINESS_SUBMODE,
+  CS_RESULT_FIELD_DISTANCE_RSSI,
+  CS_RESULT_FIELD_VELOCITY_MAINMODE,
+  CS_RESULT_FIELD_BIT_ERROR_RATE
+} cs_result_field_type_t;
+
+typedef struct {
+  uint8_t num_fields;
+  uint16_t size;
+} cs_result_session_data_t;
+
+sl_status_t cs_result_extract_field(cs_result_session_data_t *session_data,
+                                    cs_result_field_type_t field_type,
+                                    uint8_t *result,
+                                    uint8_t *value);
+
+// -----------------------------------------------------------------------------
+// cs_initiator_client.h, cs_initiator.h
+
+#define REFLECTOR_DEVICE_NAME                       "CS RFLCT"
+#define CS_INITIATOR_MIXED_MODE_MAIN_MODE_STEPS     2
+#define CS_INITIATOR_DEFAULT_MIN_MAIN_MODE_STEPS    3
+#define CS_INITIATOR_DEFAULT_MAX_MAIN_MODE_STEPS    5
+
+SL_ENUM(cs_channel_map_preset_t) {
+  CS_CHANNEL_MAP_PRESET_LOW = 0,
+  CS_CHANNEL_MAP_PRESET_MEDIUM,
+  CS_CHANNEL_MAP_PRESET_HIGH,
+  CS_CHANNEL_MAP_PRESET_CUSTOM
+};
+
+SL_ENUM(cs_sync_antenna_t) {
+  CS_SYNC_ANTENNA_1 = 1,
+  CS_SYNC_ANTENNA_2 = 2,
+  CS_SYNC_SWITCHING = 0xfe
+};
+
+SL_ENUM(cs_procedure_scheduling_t) {
+  CS_PROCEDURE_SCHEDULING_OPTIMIZED_FOR_FREQUENCY = 0,
+  CS_PROCEDURE_SCHEDULING_OPTIMIZED_FOR_ENERGY,
+  CS_PROCEDURE_SCHEDULING_CUSTOM
+};
+
+enum {
+  CS_ANTENNA_CONFIG_INDEX_SINGLE_ONLY = 0,
+  CS_ANTENNA_CONFIG_INDEX_DUAL_I_SINGLE_R = 1,
+  CS_ANTENNA_CONFIG_INDEX_SINGLE_I_DUAL_R = 4,
+  CS_ANTENNA_CONFIG_INDEX_DUAL_ONLY = 7
+};
+
+SL_ENUM(cs_error_event_t) {
+  CS_ERROR_EVENT_UNHANDLED = 0,
+  CS_ERROR_EVENT_TIMER_ELAPSED,
+  CS_ERROR_EVENT_CS_PROCEDURE_STOP_TIMER_FAILED,
+  CS_ERROR_EVENT_CS_PROCEDURE_UNEXPECTED_DATA,
+  CS_ERROR_EVENT_RTL_PROCESS_ERROR,
+  CS_ERROR_EVENT_INITIATOR_FAILED_TO_SET_INTERVALS,
+  CS_ERROR_EVENT_INITIATOR_PBR_ANTENNA_USAGE_NOT_SUPPORTED,
+  CS_ERROR_EVENT_INITIATOR_RTT_ANTENNA_USAGE_NOT_SUPPORTED,
+  CS_ERROR_EVENT_INITIATOR_FAILED_TO_INCREASE_SECURITY,
+  CS_ERROR_EVENT_CS_PROCEDURE_COUNTER_MISMATCH,
+  CS_ERROR_EVENT_RTL_ERROR,
+  CS_ERROR_EVENT_CS_PROCEDURE_START_FAILED,
+  CS_ERROR_EVENT_INITIATOR_FAILED_TO_DELETE_INSTANCE
+};
+
+typedef struct {
+  uint8_t procedure_scheduling;
+  uint8_t conn_phy;
+  uint8_t cs_sync_phy;
+  uint8_t cs_main_mode;
+  uint8_t cs_sub_mode;
+  uint8_t min_main_mode_steps;
+  uint8_t max_main_mode_steps;
+  uint8_t main_mode_repetition;
+  uint8_t mode0_step;
+  uint8_t channel_map_repetition;
+  uint8_t ch3c_jump;
+  uint8_t ch3c_shape;
+  uint8_t num_antennas;
+  uint8_t cs_tone_antenna_config_idx_req;
+  uint8_t cs_tone_antenna_config_idx;
+  uint8_t rtt_type;
+  uint8_t channel_selection_type;
+  uint8_t cs_sync_antenna_req;
+  uint8_t cs_sync_antenna;
+  uint8_t config_id;
+  uint8_t preferred_peer_antenna;
+  uint8_t create_context;
+  int8_t tx_pwr_delta;
+  int8_t max_tx_power_dbm;
+  float rssi_ref_tx_power;
+  uint32_t min_subevent_len;
+  uint32_t max_subevent_len;
+  uint16_t min_connection_interval;
+  uint16_t max_connection_interval;
+  uint16_t min_procedure_interval;
+  uint16_t max_procedure_interval;
+  uint16_t max_procedure_duration;
+  uint16_t max_procedure_count;
+  uint16_t latency;
+  uint16_t timeout;
+  uint16_t mtu;
+  uint16_t min_ce_length;
+  uint16_t max_ce_length;
+  uint8_t snr_control_initiator;
+  uint8_t snr_control_reflector;
+  uint8_t use_real_time_ras_mode;
+  uint8_t channel_map_preset;
+  sl_bt_cs_channel_map_t channel_map;
+} cs_initiator_config_t;
+
+typedef struct {
+  uint8_t algo_mode;
+  bool rtl_logging_enabled;
+} rtl_config_t;
+
+// Built from cs_initiator_config.h like the one of the CS initiator component
+#define INITIATOR_CONFIG_DEFAULT                                                    \
+  {                                                                                 \
+    .procedure_scheduling = CS_INITIATOR_DEFAULT_PROCEDURE_SCHEDULING,              \
+    .conn_phy = CS_INITIATOR_DEFAULT_CONN_PHY,                                      \
+    .cs_sync_phy = CS_INITIATOR_DEFAULT_CS_SYNC_PHY,                                \
+    .cs_main_mode = CS_INITIATOR_DEFAULT_CS_MAIN_MODE,                              \
+    .cs_sub_mode = CS_INITIATOR_DEFAULT_CS_SUB_MODE,                                \
+    .min_main_mode_steps = CS_INITIATOR_DEFAULT_MIN_MAIN_MODE_STEPS,                \
+    .max_main_mode_steps = CS_INITIATOR_DEFAULT_MAX_MAIN_MODE_STEPS,                \
+    .main_mode_repetition = 0,                                                      \
+    .mode0_step = CS_INITIATOR_DEFAULT_MODE0_STEPS,                                 \
+    .channel_map_repetition = 1,                                                    \
+    .ch3c_jump = 2,                                                                 \
+    .ch3c_shape = CS_INITIATOR_DEFAULT_CH3C_SHAPE,                                  \
+    .num_antennas = 0,                                                              \
+    .cs_tone_antenna_config_idx_req = CS_INITIATOR_DEFAULT_CS_TONE_ANTENNA_CONFIG_IDX_REQ, \
+    .cs_tone_antenna_config_idx = 0,                                                \
+    .rtt_type = CS_INITIATOR_DEFAULT_RTT_TYPE,                                      \
+    .channel_selection_type = CS_INITIATOR_DEFAULT_CHANNEL_SELECTION_TYPE,          \
+    .cs_sync_antenna_req = CS_INITIATOR_DEFAULT_CS_SYNC_ANTENNA_REQ,                \
+    .cs_sync_antenna = 0,                                                           \
+    .config_id = 0,                                                                 \
+    .preferred_peer_antenna = CS_INITIATOR_DEFAULT_PREFERRED_PEER_ANTENNA,          \
+    .create_context = CS_INITIATOR_DEFAULT_CREATE_CONTEXT,                          \
+    .tx_pwr_delta = 0,                                                              \
+    .max_tx_power_dbm = CS_INITIATOR_DEFAULT_MAX_TX_POWER,                          \
+    .rssi_ref_tx_power = CS_INITIATOR_DEFAULT_RSSI_REF_TX_POWER,                    \
+    .min_subevent_len = 0x4e20,                                                     \
+    .max_subevent_len = 0x4e20,                                                     \
+    .min_connection_interval = CS_INITIATOR_DEFAULT_MIN_CONNECTION_INTERVAL,        \
+    .max_connection_interval = CS_INITIATOR_DEFAULT_MAX_CONNECTION_INTERVAL,        \
+    .min_procedure_interval = CS_INITIATOR_DEFAULT_MIN_PROCEDURE_INTERVAL,          \
+    .max_procedure_interval = CS_INITIATOR_DEFAULT_MAX_PROCEDURE_INTERVAL,          \
+    .max_procedure_duration = 0xFFFF,                                               \
+    .max_procedure_count = CS_INITIATOR_DEFAULT_MAX_PROCEDURE_COUNT,                \
+    .latency = CS_INITIATOR_DEFAULT_CONNECTION_PERIPHERAL_LATENCY,                  \
+    .timeout = CS_INITIATOR_DEFAULT_TIMEOUT,                                        \
+    .mtu = 247,                                                                     \
+    .min_ce_length = CS_INITIATOR_DEFAULT_MIN_CE_LENGTH,                            \
+    .max_ce_length = CS_INITIATOR_DEFAULT_MAX_CE_LENGTH,                            \
+    .snr_control_initiator = 0xff,                                                  \
+    .snr_control_reflector = 0xff,                                                  \
+    .use_real_time_ras_mode = CS_INITIATOR_RAS_MODE_USE_REAL_TIME_MODE,             \
+    .channel_map_preset = CS_INITIATOR_DEFAULT_CHANNEL_MAP_PRESET,                  \
+    .channel_map = { { 0 } }                                                        \
+  }
+
+#define RTL_CONFIG_DEFAULT                                                          \
+  {                                                                                 \
+    .algo_mode = CS_INITIATOR_DEFAULT_ALGO_MODE,                                    \
+    .rtl_logging_enabled = false                                                    \
+  }
+
+typedef struct {
+  uint8_t connection;
+  float progress_percentage;
+} cs_intermediate_result_t;
+
+typedef struct {
+  uint32_t ranging_data_size;
+  uint8_t *ranging_data;
+} cs_rd_t;
+
+#define CS_MAX_STEP_COUNT                 256u
+
+typedef struct {
+  uint8_t num_steps;
+  uint8_t step_channels[CS_MAX_STEP_COUNT];
+  cs_rd_t initiator;
+  cs_rd_t reflector;
+} cs_ranging_data_t;
+
+typedef void (*cs_result_cb_t)(const uint8_t conn_handle,
+                               const uint16_t ranging_counter,
+                               const uint8_t *result,
+                               const cs_result_session_data_t *result_data,
+                               const cs_ranging_data_t *ranging_data,
+                               const void *user_data);
+typedef void (*cs_intermediate_result_cb_t)(const cs_intermediate_result_t *intermediate_result,
+                                            const void *user_data);
+typedef void (*cs_error_cb_t)(uint8_t conn_handle,
+                              cs_error_event_t err_evt,
+                              sl_status_t sc);
+
+void cs_initiator_init(void);
+sl_status_t cs_initiator_create(const uint8_t conn_handle,
+                                cs_initiator_config_t *initiator_config,
+                                const rtl_config_t *rtl_config,
+                                cs_result_cb_t result_cb,
+                                cs_intermediate_result_cb_t intermediate_result_cb,
+                                cs_error_cb_t error_cb,
+                                uint8_t *instance_id);
+sl_status_t cs_initiator_delete(const uint8_t conn_handle);
+void cs_initiator_apply_channel_map_preset(cs_channel_map_preset_t preset,
+                                           uint8_t *channel_map);
+sl_status_t cs_initiator_get_intervals(uint8_t main_mode,
+                                       uint8_t sub_mode,
+                                       cs_procedure_scheduling_t procedure_scheduling,
+                                       uint8_t channel_map_preset,
+                                       uint8_t algo_mode,
+                                       uint8_t antenna_config,
+                                       uint8_t use_real_time_ras_mode,
+                                       uint16_t *conn_interval,
+                                       uint16_t *proc_interval);
+
+// -----------------------------------------------------------------------------
+// cs_initiator_cli.h
+
+uint8_t cs_initiator_cli_get_antenna_config_index(void);
+uint8_t cs_initiator_cli_get_cs_sync_antenna_usage(void);
+uint8_t cs_initiator_cli_get_sub_mode(void);
+uint8_t cs_initiator_cli_get_mode(void);
+uint8_t cs_initiator_cli_get_conn_phy(void);
+uint8_t cs_initiator_cli_get_procedure_counter(void);
+uint8_t cs_initiator_cli_get_algo_mode(void);
+uint8_t cs_initiator_cli_get_preset(void);
+
+// -----------------------------------------------------------------------------
+// cs_initiator_display.h, cs_initiator_display_core.h
+
+#define CS_INITIATOR_DISPLAY_STATUS_CONNECTED       1
+
+sl_status_t cs_initiator_display_init(void);
+void cs_initiator_display_set_measurement_mode(uint8_t mode, uint8_t algo_mode);
+void cs_initiator_display_update_data(uint8_t instance_num,
+                                      uint8_t conn_handle,
+                                      uint8_t status,
+                                      float distance,
+                                      float rssi_distance,
+                                      float likeliness,
+                                      float bit_error_rate,
+                                      float distance_raw,
+                                      float progress_percentage,
+                                      uint8_t algo_mode,
+                                      uint8_t cs_mode);
+void cs_initiator_display_update(void);
+void cs_initiator_display_start_scanning(void);
+
+// -----------------------------------------------------------------------------
+// cs_ras_client.h, cs_antenna.h
+
+#define CS_RAS_SERVICE_UUID                         0x185B
+
+sl_status_t cs_antenna_configure(uint8_t wired);
+
+// -----------------------------------------------------------------------------
+// ble_peer_manager_*.h
+
+enum {
+  BLE_PEER_MANAGER_ON_CONN_OPENED_PERIPHERAL = 0,
+  BLE_PEER_MANAGER_ON_CONN_OPENED_CENTRAL,
+  BLE_PEER_MANAGER_ON_CONN_CLOSED,
+  BLE_PEER_MANAGER_ON_ADV_STOPPED,
+  BLE_PEER_MANAGER_ERROR
+};
+
+typedef struct {
+  uint8_t evt_id;
+  uint8_t connection_id;
+} ble_peer_manager_evt_type_t;
+
+void ble_peer_manager_on_event_initiator(ble_peer_manager_evt_type_t *event);
+void ble_peer_manager_central_init(void);
+sl_status_t ble_peer_manager_central_create_connection(void);
+sl_status_t ble_peer_manager_central_close_connection(uint8_t connection);
+bd_addr *ble_peer_manager_get_bt_address(uint8_t connection);
+void ble_peer_manager_filter_init(void);
+sl_status_t ble_peer_manager_set_filter_device_name(const char *device_name,
+                                                    uint8_t device_name_len,
+                                                    bool is_prefix);
+sl_status_t ble_peer_manager_set_filter_service_uuid16(sl_bt_uuid_16_t *service_uuid16);
+sl_status_t ble_peer_manager_set_filter_bt_address(bd_addr *address);
+
+// -----------------------------------------------------------------------------
+// app_timer.h
+
+typedef struct app_timer app_timer_t;
+typedef void (*app_timer_callback_t)(app_timer_t *timer, void *data);
+
+// The fake keeps its bookkeeping in the timer like the real one does
+struct app_timer {
+  uint64_t due_ms;
+  uint32_t timeout_ms;
+  uint32_t generation;
+  app_timer_callback_t callback;
+  void *data;
+  bool periodic;
+  bool running;
+};
+
+sl_status_t app_timer_start(app_timer_t *timer,
+                            uint32_t timeout_ms,
+                            app_timer_callback_t callback,
+                            void *callback_data,
+                            bool is_periodic);
+sl_status_t app_timer_stop(app_timer_t *timer);
+
+// -----------------------------------------------------------------------------
+// sl_sleeptimer.h
+
+uint32_t sl_sleeptimer_get_tick_count(void);
+uint64_t sl_sleeptimer_get_tick_count64(void);
+uint32_t sl_sleeptimer_tick_to_ms(uint32_t tick);
+sl_status_t sl_sleeptimer_tick64_to_ms(uint64_t tick, uint64_t *ms);
+uint32_t sl_sleeptimer_get_timer_frequency(void);
+
+// -----------------------------------------------------------------------------
+// sl_memory_manager.h
+
+typedef enum {
+  BLOCK_TYPE_LONG_TERM = 0,
+  BLOCK_TYPE_SHORT_TERM
+} sl_memory_block_type_t;
+
+sl_status_t sl_memory_alloc(size_t size, sl_memory_block_type_t type, void **block);
+size_t sl_memory_get_free_heap_size(void);
+
+// -----------------------------------------------------------------------------
+// sl_power_manager.h
+
+typedef enum {
+  SL_POWER_MANAGER_EM0 = 0,
+  SL_POWER_MANAGER_EM1,
+  SL_POWER_MANAGER_EM2
+} sl_power_manager_em_t;
+
+void sl_power_manager_add_em_requirement(sl_power_manager_em_t em);
+void sl_power_manager_remove_em_requirement(sl_power_manager_em_t em);
+
+// -----------------------------------------------------------------------------
+// sl_core.h
+
+// The host build runs in one thread, the critical sections only have to nest
+// and balance like on the target.
+typedef uint32_t CORE_irqState_t;
+
+#define CORE_DECLARE_IRQ_STATE            CORE_irqState_t irqState
+#define CORE_ENTER_ATOMIC()               (irqState = fake_core_enter_atomic())
+#define CORE_EXIT_ATOMIC()                fake_core_exit_atomic(irqState)
+
+CORE_irqState_t fake_core_enter_atomic(void);
+void fake_core_exit_atomic(CORE_irqState_t state);
+
+// -----------------------------------------------------------------------------
+// nvm3_default.h
+
+typedef uint32_t Ecode_t;
+typedef uint32_t nvm3_ObjectKey_t;
+typedef struct nvm3_Handle nvm3_Handle_t;
+
+#define ECODE_NVM3_OK                     ((Ecode_t)0)
+#define ECODE_NVM3_ERR_KEY_NOT_FOUND      ((Ecode_t)0xE000A)
+
+extern nvm3_Handle_t *nvm3_defaultHandle;
+
+Ecode_t nvm3_readData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, void *value, size_t len);
+Ecode_t nvm3_writeData(nvm3_Handle_t *h, nvm3_ObjectKey_t key, const void *value, size_t len);
+Ecode_t nvm3_deleteObject(nvm3_Handle_t *h, nvm3_ObjectKey_t key);
+
+// -----------------------------------------------------------------------------
+// sl_iostream.h, sl_iostream_handles.h
+
+typedef struct sl_iostream sl_iostream_t;
+
+extern sl_iostream_t *sl_iostream_recommended_console_stream;
+
+sl_status_t sl_iostream_write(sl_iostream_t *stream, const void *buffer, size_t buffer_length);
+sl_status_t sl_iostream_printf(sl_iostream_t *stream, const char *format, ...)
+__attribute__((format(printf, 2, 3)));
+
+// -----------------------------------------------------------------------------
+// sli_bgapi_trace.h, iostream_bgapi_trace.h
+
+extern sl_iostream_t *iostream_bgapi_trace_handle;
+
+size_t sli_bgapi_trace_log_custom_message(uint8_t *data, size_t len);
+void sli_bgapi_trace_start(void);
+void sli_bgapi_trace_sync(void);
+
+// -----------------------------------------------------------------------------
+// app_log.h
+
+#define APP_LOG_NL                        "\n"
+#define APP_LOG_ENABLE                    1
+#define APP_LOG_LEVEL_DEBUG               0
+#define APP_LOG_LEVEL_INFO                1
+#define APP_LOG_LEVEL_WARNING             2
+#define APP_LOG_LEVEL_ERROR               3
+#define APP_LOG_LEVEL_CRITICAL            4
+
+#define app_log(...)                      fake_app_log(APP_LOG_LEVEL_INFO, __VA_ARGS__)
+#define app_log_debug(...)                fake_app_log(APP_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define app_log_info(...)                 fake_app_log(APP_LOG_LEVEL_INFO, __VA_ARGS__)
+#define app_log_warning(...)              fake_app_log(APP_LOG_LEVEL_WARNING, __VA_ARGS__)
+#define app_log_error(...)                fake_app_log(APP_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define app_log_critical(...)             fake_app_log(APP_LOG_LEVEL_CRITICAL, __VA_ARGS__)
+
+#define app_log_status_error_f(sc, ...)   ((void)(sc), fake_app_log(APP_LOG_LEVEL_ERROR, __VA_ARGS__))
+
+void fake_app_log(uint8_t level, const char *format, ...)
+__attribute__((format(printf, 2, 3)));
+sl_iostream_t *app_log_iostream_get(void);
+void app_log_iostream_set(sl_iostream_t *stream);
+
+// -----------------------------------------------------------------------------
+// app_assert.h
+
+#define app_assert(expr, ...)                                    \
+  do {                                                           \
+    if (!(expr)) {                                               \
+      fake_assert_failed(__FILE__, __LINE__, __VA_ARGS__);       \
+    }                                                            \
+  } while (0)
+
+#define app_assert_status(sc)                                    \
+  app_assert((sc) == SL_STATUS_OK, "status 0x%04lx\n", (unsigned long)(sc))
+
+#define app_assert_status_f(sc, ...)                             \
+  app_assert((sc) == SL_STATUS_OK, __VA_ARGS__)
+
+void fake_assert_failed(const char *file, int line, const char *format, ...)
+__attribute__((format(printf, 3, 4), noreturn));
+
+// -----------------------------------------------------------------------------
+// sl_cli.h, sl_cli_instances.h
+
+typedef struct {
+  int argc;
+  char **argv;
+} sl_cli_command_arg_t;
+
+typedef void (*sl_cli_command_func_t)(sl_cli_command_arg_t *arguments);
+
+typedef struct {
+  sl_cli_command_func_t function;
+  const char *help;
+  const char *arg_help;
+  uint8_t arg_type_list[];
+} sl_cli_command_info_t;
+
+typedef struct {
+  const char *name;
+  const sl_cli_command_info_t *command;
+  bool is_shortcut;
+} sl_cli_command_entry_t;
+
+typedef struct sl_cli_command_group {
+  struct {
+    struct sl_cli_command_group *next;
+  } node;
+  bool in_use;
+  const sl_cli_command_entry_t *command_table;
+} sl_cli_command_group_t;
+
+typedef struct sl_cli *sl_cli_handle_t;
+
+enum {
+  SL_CLI_ARG_UINT8 = 0x01,
+  SL_CLI_ARG_UINT16 = 0x02,
+  SL_CLI_ARG_UINT32 = 0x03,
+  SL_CLI_ARG_UINT8OPT = 0x11,
+  SL_CLI_ARG_UINT32OPT = 0x13,
+  SL_CLI_ARG_END = 0xFF
+};
+
+#define SL_CLI_UNIT_SEPARATOR             "\t"
+#define SL_CLI_COMMAND(function, help, arg_help, ...) \
+  { (function), (help), (arg_help), __VA_ARGS__ }
+
+extern sl_cli_handle_t sl_cli_default_handle;
+
+bool sl_cli_command_add_command_group(sl_cli_handle_t handle, sl_cli_command_group_t *group);
+int sl_cli_get_argument_count(sl_cli_command_arg_t *arguments);
+uint8_t sl_cli_get_argument_uint8(sl_cli_command_arg_t *arguments, int n);
+uint32_t sl_cli_get_argument_uint32(sl_cli_command_arg_t *arguments, int n);
+
+#endif // FAKE_SDK_H
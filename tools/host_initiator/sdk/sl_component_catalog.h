@@ -0,0 +1,2 @@
+// Host build, see fake_sdk.h
+#include "fake_sdk.h"
@@ -0,0 +1,2 @@
+// Host build variant: adaptive procedure interval
+#define CS_INITIATOR_ADAPTIVE_INTERVAL        1
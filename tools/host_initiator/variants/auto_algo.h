@@ -0,0 +1,2 @@
+// Host build variant: algorithm mode chosen per tag by its movement
+#define CS_INITIATOR_AUTO_ALGO_MODE           1
@@ -0,0 +1,2 @@
+// Host build variant: binary measurement output
+#define CS_INITIATOR_OUTPUT_FORMAT            CS_INITIATOR_OUTPUT_FORMAT_BINARY
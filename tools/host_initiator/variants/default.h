@@ -0,0 +1 @@
+// Host build variant: the configuration of bt_cs_soc_initiator/config as is
@@ -0,0 +1,9 @@
+// Host build variant: priority weighted procedure scheduling. The short
+// procedure interval leaves the scheduler airtime to share.
+#define CS_INITIATOR_PRIORITY_SCHEDULING      1
+#define CS_INITIATOR_DEFAULT_MIN_PROCEDURE_INTERVAL 3
+#define CS_INITIATOR_DEFAULT_MAX_PROCEDURE_INTERVAL 3
+#define CS_INITIATOR_PROFILES                 1
+#define CS_INITIATOR_PROFILE_LIST                                                                    \
+  { { "C0:FE:CA:00:00:01", NULL, 0, INITIATOR_PROFILE_KEEP, INITIATOR_PROFILE_KEEP,                   \
+      4 } }
@@ -0,0 +1,8 @@
+// Host build variant: configuration profiles matched by address and name
+#define CS_INITIATOR_PROFILES                 1
+#define CS_INITIATOR_PROFILE_LIST                                                                    \
+  { { "C0:FE:CA:00:00:01", NULL, 20, INITIATOR_PROFILE_KEEP, INITIATOR_PROFILE_KEEP, 0 },            \
+    { "c0:fe:ca:00:00:0", "OTHER", 400, INITIATOR_PROFILE_KEEP, INITIATOR_PROFILE_KEEP, 0 },         \
+    { "C0:FE:CA:00:00:02", "cs rf", 200, INITIATOR_PROFILE_KEEP,                                     \
+      SL_RTL_CS_ALGO_MODE_STATIC_HIGH_ACCURACY, 0 },                                                 \
+    { "C0:FE:CA:00:00:01", NULL, 40, INITIATOR_PROFILE_KEEP, INITIATOR_PROFILE_KEEP, 0 } }
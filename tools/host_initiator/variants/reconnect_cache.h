@@ -0,0 +1,2 @@
+// Host build variant: reconnect cache of the antenna count and the intervals
+#define CS_INITIATOR_RECONNECT_CACHE          1
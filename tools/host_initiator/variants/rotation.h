@@ -0,0 +1,8 @@
+// Host build variant: tag rotation over seven tags with one connection slot
+#define CS_INITIATOR_TAG_ROTATION             1
+#define CS_INITIATOR_MAX_CONNECTIONS          1
+#define CS_INITIATOR_TAG_ROTATION_REVISIT_MS  5000
+#define CS_INITIATOR_TAG_ROTATION_LIST        { "C0:FE:CA:00:00:01", "C0:FE:CA:00:00:02", \
+                                                "C0:FE:CA:00:00:03", "C0:FE:CA:00:00:04", \
+                                                "C0:FE:CA:00:00:05", "C0:FE:CA:00:00:06", \
+                                                "C0:FE:CA:00:00:07" }
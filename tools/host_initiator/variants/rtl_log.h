@@ -0,0 +1,3 @@
+// Host build variant: trace channel on at boot, the RTL log is buffered for it
+#define SL_CATALOG_BGAPI_TRACE_PRESENT
+#define ALWAYS_INIT_TRACE                     1
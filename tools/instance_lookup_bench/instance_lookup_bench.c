@@ -0,0 +1,326 @@
+/***************************************************************************//**
+ * @file
+ * @brief Benchmark of the connection handle to initiator instance lookup.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -Wextra -o instance_lookup_bench instance_lookup_bench.c
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// As in bt_cs_soc_initiator/app.c
+#define INVALID_CONNECTION_HANDLE     0xFFu
+#define INSTANCE_NUM_INVALID          UINT8_MAX
+#define CONN_HANDLE_COUNT             (UINT8_MAX + 1u)
+
+#define MAX_INSTANCES                 64u
+#define LOOKUPS_PER_ROUND             8u    // Events of one procedure
+#define CHURN_PERIOD                  16u   // Rounds between a reconnection
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Both ways of finding the instance of a connection handle. The instances
+// are kept in an array of the size of the application's instance struct, so
+// the scan touches the same memory it does on the target.
+typedef struct {
+  uint8_t *instances;
+  size_t instance_size;
+  uint8_t count;
+  // Map and free stack of app.c
+  uint8_t instance_by_conn_handle[CONN_HANDLE_COUNT];
+  uint8_t free_instances[MAX_INSTANCES];
+  uint8_t free_instance_count;
+} pool_t;
+
+typedef bool (*lookup_t)(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+typedef bool (*create_t)(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+typedef void (*delete_t)(pool_t *pool, uint8_t conn_handle);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static uint32_t random_state = 1u;
+// Keeps the compiler from dropping the lookups
+static volatile uint32_t sink;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static uint32_t get_random(void);
+static uint8_t *get_handle(pool_t *pool, uint8_t instance_num);
+static void pool_init(pool_t *pool, uint8_t count, size_t instance_size);
+static bool scan_lookup(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+static bool scan_create(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+static void scan_delete(pool_t *pool, uint8_t conn_handle);
+static bool map_lookup(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+static bool map_create(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num);
+static void map_delete(pool_t *pool, uint8_t conn_handle);
+static double run(uint8_t count, size_t instance_size, uint32_t rounds,
+                  lookup_t lookup, create_t create, delete_t remove, bool *valid);
+static double get_time_ns(void);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * xorshift32, the same sequence on every run
+ *****************************************************************************/
+static uint32_t get_random(void)
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+// Connection handle member of an instance, the first one as in app.c
+static uint8_t *get_handle(pool_t *pool, uint8_t instance_num)
+{
+  return &pool->instances[(size_t)instance_num * pool->instance_size];
+}
+
+static void pool_init(pool_t *pool, uint8_t count, size_t instance_size)
+{
+  pool->instances = calloc(count, instance_size);
+  pool->instance_size = instance_size;
+  pool->count = count;
+  for (uint8_t i = 0u; i < count; i++) {
+    *get_handle(pool, i) = INVALID_CONNECTION_HANDLE;
+  }
+  memset(pool->instance_by_conn_handle, INSTANCE_NUM_INVALID, sizeof(pool->instance_by_conn_handle));
+  pool->free_instance_count = 0u;
+  for (uint8_t i = count; i > 0u; i--) {
+    pool->free_instances[pool->free_instance_count++] = (uint8_t)(i - 1u);
+  }
+}
+
+/******************************************************************************
+ * Linear scan, as get_instance_number() and the create and delete paths did
+ *****************************************************************************/
+static bool scan_lookup(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num)
+{
+  for (uint8_t i = 0u; i < pool->count; i++) {
+    if (*get_handle(pool, i) == conn_handle) {
+      *instance_num = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool scan_create(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num)
+{
+  if (!scan_lookup(pool, INVALID_CONNECTION_HANDLE, instance_num)) {
+    return false;
+  }
+  *get_handle(pool, *instance_num) = conn_handle;
+  return true;
+}
+
+static void scan_delete(pool_t *pool, uint8_t conn_handle)
+{
+  uint8_t i;
+  if (scan_lookup(pool, conn_handle, &i)) {
+    *get_handle(pool, i) = INVALID_CONNECTION_HANDLE;
+  }
+}
+
+/******************************************************************************
+ * Direct indexed map and free stack, as app.c does now
+ *****************************************************************************/
+static bool map_lookup(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num)
+{
+  if (pool->instance_by_conn_handle[conn_handle] == INSTANCE_NUM_INVALID) {
+    return false;
+  }
+  *instance_num = pool->instance_by_conn_handle[conn_handle];
+  return true;
+}
+
+static bool map_create(pool_t *pool, uint8_t conn_handle, uint8_t *instance_num)
+{
+  if (pool->free_instance_count == 0u) {
+    return false;
+  }
+  *instance_num = pool->free_instances[--pool->free_instance_count];
+  pool->instance_by_conn_handle[conn_handle] = *instance_num;
+  *get_handle(pool, *instance_num) = conn_handle;
+  return true;
+}
+
+static void map_delete(pool_t *pool, uint8_t conn_handle)
+{
+  uint8_t i = pool->instance_by_conn_handle[conn_handle];
+  if (i == INSTANCE_NUM_INVALID) {
+    return;
+  }
+  pool->instance_by_conn_handle[conn_handle] = INSTANCE_NUM_INVALID;
+  *get_handle(pool, i) = INVALID_CONNECTION_HANDLE;
+  pool->free_instances[pool->free_instance_count++] = i;
+}
+
+/******************************************************************************
+ * Fill the pool with connections, then run rounds of the events of one
+ * procedure of a random connection, plus a lookup of a connection that is
+ * not an initiator instance. Every CHURN_PERIOD rounds a connection is
+ * replaced by a new one. Returns ns per operation, and checks that every
+ * lookup finds the instance holding the handle.
+ *****************************************************************************/
+static double run(uint8_t count, size_t instance_size, uint32_t rounds,
+                  lookup_t lookup, create_t create, delete_t remove, bool *valid)
+{
+  pool_t pool;
+  uint8_t handles[MAX_INSTANCES];
+  uint8_t next_handle = 1u;
+  uint8_t instance_num;
+  uint64_t operations = 0u;
+
+  random_state = 1u;
+  pool_init(&pool, count, instance_size);
+  *valid = true;
+  for (uint8_t i = 0u; i < count; i++) {
+    handles[i] = next_handle++;
+    *valid &= create(&pool, handles[i], &instance_num);
+  }
+
+  double start_ns = get_time_ns();
+  for (uint32_t round = 0u; round < rounds; round++) {
+    uint8_t handle = handles[get_random() % count];
+    for (uint32_t i = 0u; i < LOOKUPS_PER_ROUND; i++) {
+      if (!lookup(&pool, handle, &instance_num) || *get_handle(&pool, instance_num) != handle) {
+        *valid = false;
+      }
+      sink += instance_num;
+    }
+    // A connection without an instance, e.g. from another role
+    if (lookup(&pool, INVALID_CONNECTION_HANDLE - 1u, &instance_num)) {
+      *valid = false;
+    }
+    operations += LOOKUPS_PER_ROUND + 1u;
+    if (round % CHURN_PERIOD == 0u) {
+      uint8_t replaced = (uint8_t)(get_random() % count);
+      remove(&pool, handles[replaced]);
+      // Handles 1..253, the highest one is kept for the miss above
+      next_handle = (next_handle >= INVALID_CONNECTION_HANDLE - 2u) ? 1u : (uint8_t)(next_handle + 1u);
+      while (scan_lookup(&pool, next_handle, &instance_num)) {
+        next_handle++;
+      }
+      handles[replaced] = next_handle;
+      *valid &= create(&pool, next_handle, &instance_num);
+      operations += 2u;
+    }
+  }
+  double ns = (get_time_ns() - start_ns) / (double)operations;
+  free(pool.instances);
+  return ns;
+}
+
+static double get_time_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --rounds N               procedures per instance count (default 2000000)\n"
+         "  --instance-size N        bytes per instance (default 512)\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark
+
+int main(int argc, char **argv)
+{
+  static const uint8_t counts[] = { 4u, 16u, 32u };
+  uint32_t rounds = 2000000u;
+  size_t instance_size = 512u;
+  static const struct option options[] = {
+    { "rounds", required_argument, NULL, 'r' },
+    { "instance-size", required_argument, NULL, 's' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  bool failed = false;
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'r':
+        rounds = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        instance_size = (size_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (rounds == 0u || instance_size == 0u) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("%u procedures of %u lookups, a miss and a reconnection every %u procedures, "
+         "%zu bytes per instance\n\n",
+         rounds, LOOKUPS_PER_ROUND, CHURN_PERIOD, instance_size);
+  printf("Instances  Linear scan   Map + free stack  Speed-up\n");
+  for (size_t i = 0u; i < sizeof(counts) / sizeof(counts[0]); i++) {
+    bool scan_valid;
+    bool map_valid;
+    double scan_ns = run(counts[i], instance_size, rounds, scan_lookup, scan_create, scan_delete, &scan_valid);
+    double map_ns = run(counts[i], instance_size, rounds, map_lookup, map_create, map_delete, &map_valid);
+    failed |= !scan_valid || !map_valid;
+    printf("%9u  %8.2f ns  %13.2f ns  %7.2fx%s\n",
+           counts[i],
+           scan_ns,
+           map_ns,
+           scan_ns / map_ns,
+           (scan_valid && map_valid) ? "" : "  WRONG INSTANCE");
+  }
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
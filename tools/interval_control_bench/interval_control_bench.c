@@ -0,0 +1,344 @@
+/***************************************************************************//**
+ * @file
+ * @brief Airtime of a mixed fleet with the adaptive procedure interval.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -I../../bt_cs_soc_initiator -I../../bt_cs_soc_initiator/config
+//       -o interval_control_bench interval_control_bench.c
+//       ../../bt_cs_soc_initiator/interval_control.c ../../bt_cs_soc_initiator/motion.c -lm
+// The controller settings are those of app_config.h and can be changed with -D,
+// e.g. -DCS_INITIATOR_ADAPTIVE_MAX_FACTOR=16. Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "interval_control.h"
+#include "motion.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define CONNECTION_INTERVAL_UNIT_MS   1.25
+#define MIN_DISTANCE_MM               1000.0
+#define MAX_DISTANCE_MM               10000.0
+#define PARKED_DISTANCE_MM            3000.0
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Fleet and radio settings
+typedef struct {
+  uint32_t tags;
+  uint32_t moving_tags;
+  double duty;
+  double cycle_ms;
+  double speed_mm_s;
+  double noise_mm;
+  double velocity_noise_mm_s;
+  double duration_ms;
+  uint16_t connection_interval;
+  uint16_t procedure_interval;
+  double procedure_ms;
+  double restart_ms;
+} fleet_t;
+
+// Outcome of one tag
+typedef struct {
+  uint32_t procedures;
+  uint32_t restarts;
+  uint32_t reactions;
+  double reaction_sum_ms;
+  double reaction_max_ms;
+} tag_result_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static double gauss(void);
+static double get_moving_time_ms(const fleet_t *fleet, double phase_ms, double time_ms);
+static double get_distance_mm(const fleet_t *fleet, double moving_time_ms);
+static void simulate_tag(const fleet_t *fleet, bool mobile, double phase_ms, tag_result_t *result);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+static double gauss(void)
+{
+  double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+  double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+  return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+/******************************************************************************
+ * Time a moving tag has spent moving up to a point in time. It moves for the
+ * first duty share of every cycle, starting phase_ms into a cycle.
+ *****************************************************************************/
+static double get_moving_time_ms(const fleet_t *fleet, double phase_ms, double time_ms)
+{
+  double active_ms = fleet->duty * fleet->cycle_ms;
+  double cycle_time_ms = time_ms + phase_ms;
+  double cycles = floor(cycle_time_ms / fleet->cycle_ms);
+  double in_cycle_ms = cycle_time_ms - cycles * fleet->cycle_ms;
+  return cycles * active_ms + fmin(in_cycle_ms, active_ms);
+}
+
+/******************************************************************************
+ * Distance of a moving tag, back and forth between the minimum and maximum
+ *****************************************************************************/
+static double get_distance_mm(const fleet_t *fleet, double moving_time_ms)
+{
+  double span_mm = MAX_DISTANCE_MM - MIN_DISTANCE_MM;
+  double travel_mm = fmod(moving_time_ms * fleet->speed_mm_s / 1000.0, 2.0 * span_mm);
+  return MIN_DISTANCE_MM + ((travel_mm < span_mm) ? travel_mm : 2.0 * span_mm - travel_mm);
+}
+
+/******************************************************************************
+ * Run the procedures of one tag through the movement detector and the
+ * interval controller, as app.c does with every filtered result. A changed
+ * interval recreates the initiator instance, which takes restart_ms.
+ *****************************************************************************/
+static void simulate_tag(const fleet_t *fleet, bool mobile, double phase_ms, tag_result_t *result)
+{
+  motion_t motion;
+  interval_control_t ctrl;
+  double active_ms = fleet->duty * fleet->cycle_ms;
+  double reacted_cycle = -1.0;
+
+  motion_init(&motion);
+  interval_control_init(&ctrl, fleet->procedure_interval);
+  for (double time_ms = 0.0; time_ms < fleet->duration_ms;) {
+    double cycle_time_ms = time_ms + phase_ms;
+    double cycle = floor(cycle_time_ms / fleet->cycle_ms);
+    double in_cycle_ms = cycle_time_ms - cycle * fleet->cycle_ms;
+    bool moves = mobile && in_cycle_ms < active_ms;
+    double distance_mm = mobile
+                         ? get_distance_mm(fleet, get_moving_time_ms(fleet, phase_ms, time_ms))
+                         : PARKED_DISTANCE_MM;
+    double speed_mm_s = fabs((moves ? fleet->speed_mm_s : 0.0) + fleet->velocity_noise_mm_s * gauss());
+
+    result->procedures++;
+    bool moving = motion_update(&motion,
+                                (int32_t)lround(distance_mm + fleet->noise_mm * gauss()),
+                                (uint32_t)lround(speed_mm_s));
+    bool changed = interval_control_update(&ctrl, moving, (uint32_t)time_ms);
+    if (moves && fleet->duty < 1.0 && cycle != reacted_cycle && moving && time_ms >= in_cycle_ms
+        && interval_control_get_interval(&ctrl) == fleet->procedure_interval) {
+      // Time from the start of the movement until the tag is served at the
+      // base rate again. A movement under way at the start is not counted.
+      double reaction_ms = in_cycle_ms;
+      reacted_cycle = cycle;
+      result->reactions++;
+      result->reaction_sum_ms += reaction_ms;
+      if (reaction_ms > result->reaction_max_ms) {
+        result->reaction_max_ms = reaction_ms;
+      }
+    }
+    time_ms += fleet->connection_interval * CONNECTION_INTERVAL_UNIT_MS * interval_control_get_interval(&ctrl);
+    if (changed) {
+      result->restarts++;
+      time_ms += fleet->restart_ms;
+    }
+  }
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --tags N                 number of tags (default 10)\n"
+         "  --moving N               tags that move part of the time, the others are parked (default 5)\n"
+         "  --duty P                 share of the time a moving tag moves 0..1 (default 0.3)\n"
+         "  --cycle S                movement cycle of a moving tag (default 120)\n"
+         "  --speed MM_S             speed of a moving tag, back and forth over 1..10 m (default 1000)\n"
+         "  --noise MM               standard deviation of the filtered distance (default 30)\n"
+         "  --velocity-noise MM_S    standard deviation of the velocity (default 50)\n"
+         "  --duration S             simulated time (default 3600)\n"
+         "  --connection-interval N  connection interval in 1.25 ms units (default 8)\n"
+         "  --procedure-interval N   configured procedure interval in connection events (default 80)\n"
+         "  --procedure-ms MS        airtime of one procedure (default 10)\n"
+         "  --restart-ms MS          time without procedures after an instance is recreated (default 300)\n"
+         "  --seed N                 random seed (default 1)\n",
+         name);
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark
+
+int main(int argc, char **argv)
+{
+  fleet_t fleet = {
+    .tags = 10u,
+    .moving_tags = 5u,
+    .duty = 0.3,
+    .cycle_ms = 120000.0,
+    .speed_mm_s = 1000.0,
+    .noise_mm = 30.0,
+    .velocity_noise_mm_s = 50.0,
+    .duration_ms = 3600000.0,
+    .connection_interval = 8u,
+    .procedure_interval = 80u,
+    .procedure_ms = 10.0,
+    .restart_ms = 300.0
+  };
+  unsigned int seed = 1u;
+  static const struct option options[] = {
+    { "tags", required_argument, NULL, 'n' },
+    { "moving", required_argument, NULL, 'm' },
+    { "duty", required_argument, NULL, 'd' },
+    { "cycle", required_argument, NULL, 'c' },
+    { "speed", required_argument, NULL, 'v' },
+    { "noise", required_argument, NULL, 'e' },
+    { "velocity-noise", required_argument, NULL, 'w' },
+    { "duration", required_argument, NULL, 't' },
+    { "connection-interval", required_argument, NULL, 'i' },
+    { "procedure-interval", required_argument, NULL, 'p' },
+    { "procedure-ms", required_argument, NULL, 'a' },
+    { "restart-ms", required_argument, NULL, 'r' },
+    { "seed", required_argument, NULL, 'S' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        fleet.tags = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'm':
+        fleet.moving_tags = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'd':
+        fleet.duty = strtod(optarg, NULL);
+        break;
+      case 'c':
+        fleet.cycle_ms = 1000.0 * strtod(optarg, NULL);
+        break;
+      case 'v':
+        fleet.speed_mm_s = strtod(optarg, NULL);
+        break;
+      case 'e':
+        fleet.noise_mm = strtod(optarg, NULL);
+        break;
+      case 'w':
+        fleet.velocity_noise_mm_s = strtod(optarg, NULL);
+        break;
+      case 't':
+        fleet.duration_ms = 1000.0 * strtod(optarg, NULL);
+        break;
+      case 'i':
+        fleet.connection_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        fleet.procedure_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'a':
+        fleet.procedure_ms = strtod(optarg, NULL);
+        break;
+      case 'r':
+        fleet.restart_ms = strtod(optarg, NULL);
+        break;
+      case 'S':
+        seed = (unsigned int)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (fleet.tags == 0u || fleet.moving_tags > fleet.tags || fleet.duty < 0.0 || fleet.duty > 1.0
+      || fleet.cycle_ms <= 0.0 || fleet.duration_ms <= 0.0
+      || fleet.connection_interval == 0u || fleet.procedure_interval == 0u) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  double base_period_ms = fleet.connection_interval * CONNECTION_INTERVAL_UNIT_MS * fleet.procedure_interval;
+  uint32_t fixed_procedures = fleet.tags * (uint32_t)ceil(fleet.duration_ms / base_period_ms);
+  uint32_t procedures = 0u;
+  uint32_t restarts = 0u;
+  uint32_t reactions = 0u;
+  double reaction_sum_ms = 0.0;
+  double reaction_max_ms = 0.0;
+
+  srand(seed);
+  printf("%u tags, %u of them moving %.0f %% of the time at %.0f mm/s, %.0f s\n",
+         fleet.tags,
+         fleet.moving_tags,
+         100.0 * fleet.duty,
+         fleet.speed_mm_s,
+         fleet.duration_ms / 1000.0);
+  printf("Base interval %u x %.2f ms = %.3f Hz, up to %u times slower after %u still results, "
+         "kept for at least %.1f s\n\n",
+         fleet.procedure_interval,
+         fleet.connection_interval * CONNECTION_INTERVAL_UNIT_MS,
+         1000.0 / base_period_ms,
+         CS_INITIATOR_ADAPTIVE_MAX_FACTOR,
+         CS_INITIATOR_ADAPTIVE_STILL_RESULTS,
+         CS_INITIATOR_ADAPTIVE_MIN_DWELL_MS / 1000.0);
+  printf("tag  kind    procedures  rate [Hz]  restarts\n");
+  for (uint32_t i = 0u; i < fleet.tags; i++) {
+    tag_result_t result = { 0 };
+    bool mobile = i < fleet.moving_tags;
+    // Spread the movements of the tags over the cycle
+    double phase_ms = fleet.cycle_ms * i / fleet.tags;
+    simulate_tag(&fleet, mobile, phase_ms, &result);
+    printf("%-4u %-7s %10u %10.3f %9u\n",
+           i,
+           mobile ? "moving" : "parked",
+           result.procedures,
+           1000.0 * result.procedures / fleet.duration_ms,
+           result.restarts);
+    procedures += result.procedures;
+    restarts += result.restarts;
+    reactions += result.reactions;
+    reaction_sum_ms += result.reaction_sum_ms;
+    reaction_max_ms = fmax(reaction_max_ms, result.reaction_max_ms);
+  }
+
+  printf("\n           procedures  airtime [s]  restarts\n");
+  printf("fixed      %10u %12.1f %9u\n",
+         fixed_procedures, fixed_procedures * fleet.procedure_ms / 1000.0, 0u);
+  printf("adaptive   %10u %12.1f %9u\n",
+         procedures, procedures * fleet.procedure_ms / 1000.0, restarts);
+  printf("\nAirtime saved: %.1f %%\n", 100.0 * (1.0 - (double)procedures / fixed_procedures));
+  if (reactions > 0u) {
+    printf("Back to the base rate after a tag starts moving: mean %.2f s, max %.2f s (%u movements)\n",
+           reaction_sum_ms / reactions / 1000.0,
+           reaction_max_ms / 1000.0,
+           reactions);
+  }
+  return EXIT_SUCCESS;
+}
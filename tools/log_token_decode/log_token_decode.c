@@ -0,0 +1,569 @@
+/***************************************************************************//**
+ * @file
+ * @brief Decoder of the tokenized log messages of the initiator and reflector.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -o log_token_decode log_token_decode.c
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <elf.h>
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Macros
+
+// Frame format of bt_cs_soc_initiator/log_token.h
+#define FRAME_DELIMITER               0x00
+#define FRAME_TYPE_LOG                0x04
+#define HEADER_LEN                    4u
+#define CRC_LEN                       2u
+#define CRC16_INIT                    0xFFFFu
+#define CRC16_POLY                    0x1021u
+#define MAX_CHUNK_LEN                 1024u
+
+#define SECTION_NAME                  "log_tokens"
+#define MAX_SPEC_LEN                  32u
+#define MAX_TEXT_LEN                  512u
+
+// Levels of app_log.h
+#define LEVEL_COUNT                   5u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+typedef struct {
+  char *data;
+  size_t size;
+} token_table_t;
+
+typedef struct {
+  const uint8_t *data;
+  size_t len;
+  size_t pos;
+  bool overrun;
+} args_t;
+
+typedef struct {
+  bool raw;
+  bool show_level;
+  unsigned long frames;
+  unsigned long errors;
+} options_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static bool load_tokens(const char *path, token_table_t *table);
+static bool find_section(FILE *file, const char *name, long *offset, size_t *size);
+static void decode_stream(FILE *input, const token_table_t *table, options_t *options);
+static void handle_chunk(const uint8_t *chunk,
+                         size_t len,
+                         const token_table_t *table,
+                         options_t *options);
+static bool decode_frame(const uint8_t *chunk,
+                         size_t len,
+                         const token_table_t *table,
+                         options_t *options);
+static void render(const char *format, args_t *args, char *text, size_t text_size);
+static uint32_t get_u32(args_t *args);
+static uint64_t get_u64(args_t *args);
+static uint16_t crc16(const uint8_t *data, size_t len);
+static size_t cobs_decode(const uint8_t *data, size_t len, uint8_t *out, size_t out_size);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static const char *const level_names[LEVEL_COUNT] = {
+  "[D] ", "[I] ", "[W] ", "[E] ", "[C] "
+};
+
+// -----------------------------------------------------------------------------
+// Public function definitions
+
+int main(int argc, char *argv[])
+{
+  static const struct option long_options[] = {
+    { "level", no_argument, NULL, 'l' },
+    { "raw", no_argument, NULL, 'r' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  options_t options = { .raw = false, .show_level = false, .frames = 0u, .errors = 0u };
+  token_table_t table;
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "lrh", long_options, NULL)) != -1) {
+    switch (opt) {
+      case 'l':
+        options.show_level = true;
+        break;
+      case 'r':
+        options.raw = true;
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (optind >= argc || argc - optind > 2) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (!load_tokens(argv[optind], &table)) {
+    return EXIT_FAILURE;
+  }
+
+  FILE *input = stdin;
+  if (argc - optind == 2) {
+    input = fopen(argv[optind + 1], "rb");
+    if (input == NULL) {
+      perror(argv[optind + 1]);
+      free(table.data);
+      return EXIT_FAILURE;
+    }
+  }
+  decode_stream(input, &table, &options);
+  if (input != stdin) {
+    fclose(input);
+  }
+  fprintf(stderr, "%lu messages, %lu invalid frames\n", options.frames, options.errors);
+  free(table.data);
+  return EXIT_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Load the format strings of the application from its ELF file
+ *****************************************************************************/
+static bool load_tokens(const char *path, token_table_t *table)
+{
+  FILE *file = fopen(path, "rb");
+  long offset;
+  bool ok = false;
+
+  if (file == NULL) {
+    perror(path);
+    return false;
+  }
+  table->data = NULL;
+  table->size = 0u;
+  if (!find_section(file, SECTION_NAME, &offset, &table->size)) {
+    fprintf(stderr, "%s: no " SECTION_NAME " section\n", path);
+  } else if ((table->data = malloc(table->size + 1u)) != NULL
+             && fseek(file, offset, SEEK_SET) == 0
+             && fread(table->data, 1u, table->size, file) == table->size) {
+    // Keep the last string terminated even in a damaged file.
+    table->data[table->size] = '\0';
+    ok = true;
+  } else {
+    fprintf(stderr, "%s: cannot read the " SECTION_NAME " section\n", path);
+  }
+  fclose(file);
+  return ok;
+}
+
+/******************************************************************************
+ * Find a section of a little endian ELF32 or ELF64 file by name
+ *****************************************************************************/
+static bool find_section(FILE *file, const char *name, long *offset, size_t *size)
+{
+  unsigned char ident[EI_NIDENT];
+  uint64_t shoff;
+  uint16_t shentsize, shnum, shstrndx;
+  bool is64;
+
+  if (fread(ident, 1u, sizeof(ident), file) != sizeof(ident)
+      || memcmp(ident, ELFMAG, SELFMAG) != 0
+      || ident[EI_DATA] != ELFDATA2LSB) {
+    return false;
+  }
+  is64 = (ident[EI_CLASS] == ELFCLASS64);
+  rewind(file);
+  if (is64) {
+    Elf64_Ehdr header;
+    if (fread(&header, sizeof(header), 1u, file) != 1u) {
+      return false;
+    }
+    shoff = header.e_shoff;
+    shentsize = header.e_shentsize;
+    shnum = header.e_shnum;
+    shstrndx = header.e_shstrndx;
+  } else {
+    Elf32_Ehdr header;
+    if (fread(&header, sizeof(header), 1u, file) != 1u) {
+      return false;
+    }
+    shoff = header.e_shoff;
+    shentsize = header.e_shentsize;
+    shnum = header.e_shnum;
+    shstrndx = header.e_shstrndx;
+  }
+
+  // Section offset, size and name offset of every section header
+  uint64_t *sections = calloc(shnum, 3u * sizeof(uint64_t));
+  if (sections == NULL || shstrndx >= shnum) {
+    free(sections);
+    return false;
+  }
+  for (uint16_t i = 0u; i < shnum; i++) {
+    if (fseek(file, (long)(shoff + (uint64_t)i * shentsize), SEEK_SET) != 0) {
+      free(sections);
+      return false;
+    }
+    if (is64) {
+      Elf64_Shdr section;
+      if (fread(&section, sizeof(section), 1u, file) != 1u) {
+        free(sections);
+        return false;
+      }
+      sections[3u * i] = section.sh_offset;
+      sections[3u * i + 1u] = section.sh_size;
+      sections[3u * i + 2u] = section.sh_name;
+    } else {
+      Elf32_Shdr section;
+      if (fread(&section, sizeof(section), 1u, file) != 1u) {
+        free(sections);
+        return false;
+      }
+      sections[3u * i] = section.sh_offset;
+      sections[3u * i + 1u] = section.sh_size;
+      sections[3u * i + 2u] = section.sh_name;
+    }
+  }
+
+  bool found = false;
+  char section_name[sizeof(SECTION_NAME) + 1u];
+  for (uint16_t i = 0u; i < shnum && !found; i++) {
+    size_t len;
+    if (fseek(file, (long)(sections[3u * shstrndx] + sections[3u * i + 2u]), SEEK_SET) != 0) {
+      break;
+    }
+    len = fread(section_name, 1u, sizeof(section_name), file);
+    if (len > strlen(name) && memcmp(section_name, name, strlen(name) + 1u) == 0) {
+      *offset = (long)sections[3u * i];
+      *size = (size_t)sections[3u * i + 1u];
+      found = true;
+    }
+  }
+  free(sections);
+  return found;
+}
+
+/******************************************************************************
+ * Split the stream at the delimiters and handle every chunk
+ *****************************************************************************/
+static void decode_stream(FILE *input, const token_table_t *table, options_t *options)
+{
+  uint8_t chunk[MAX_CHUNK_LEN];
+  size_t len = 0u;
+  int c;
+
+  while ((c = fgetc(input)) != EOF) {
+    if (c == FRAME_DELIMITER) {
+      handle_chunk(chunk, len, table, options);
+      len = 0u;
+    } else if (len < sizeof(chunk)) {
+      chunk[len++] = (uint8_t)c;
+    } else {
+      // Text without delimiter, pass it through in pieces.
+      handle_chunk(chunk, len, table, options);
+      chunk[0] = (uint8_t)c;
+      len = 1u;
+    }
+  }
+  handle_chunk(chunk, len, table, options);
+  fflush(stdout);
+}
+
+/******************************************************************************
+ * Print a chunk as message if it is a valid frame, as text otherwise.
+ * Text of loggers that are not tokenized arrives between the frames.
+ *****************************************************************************/
+static void handle_chunk(const uint8_t *chunk,
+                         size_t len,
+                         const token_table_t *table,
+                         options_t *options)
+{
+  if (len == 0u || decode_frame(chunk, len, table, options)) {
+    return;
+  }
+  if (!options->raw) {
+    fwrite(chunk, 1u, len, stdout);
+  }
+}
+
+/******************************************************************************
+ * Decode and print a token frame
+ *****************************************************************************/
+static bool decode_frame(const uint8_t *chunk,
+                         size_t len,
+                         const token_table_t *table,
+                         options_t *options)
+{
+  uint8_t raw[MAX_CHUNK_LEN];
+  char text[MAX_TEXT_LEN];
+  size_t raw_len = cobs_decode(chunk, len, raw, sizeof(raw));
+
+  if (raw_len < HEADER_LEN + CRC_LEN || raw[0] != FRAME_TYPE_LOG) {
+    return false;
+  }
+  raw_len -= CRC_LEN;
+  if (crc16(raw, raw_len) != (uint16_t)(raw[raw_len] | (raw[raw_len + 1u] << 8))) {
+    return false;
+  }
+
+  uint8_t level = raw[1];
+  size_t token = (size_t)(raw[2] | (raw[3] << 8));
+  args_t args = { .data = &raw[HEADER_LEN], .len = raw_len - HEADER_LEN, .pos = 0u, .overrun = false };
+
+  options->frames++;
+  if (token >= table->size) {
+    // ELF file does not match the firmware
+    options->errors++;
+    printf("<unknown token 0x%04zx>\n", token);
+    return true;
+  }
+  render(&table->data[token], &args, text, sizeof(text));
+  if (args.overrun) {
+    options->errors++;
+  }
+  if (options->show_level) {
+    fputs((level < LEVEL_COUNT) ? level_names[level] : "[?] ", stdout);
+  }
+  fputs(text, stdout);
+  return true;
+}
+
+/******************************************************************************
+ * Format a message the way printf on the device does. Integers are 32 bits
+ * wide except for the ll modifier, floating point values were sent as float.
+ *****************************************************************************/
+static void render(const char *format, args_t *args, char *text, size_t text_size)
+{
+  size_t len = 0u;
+
+  while (*format != '\0' && len + 1u < text_size) {
+    if (*format != '%') {
+      text[len++] = *format++;
+      continue;
+    }
+
+    // Copy flags, width and precision, resolve '*' from the arguments.
+    char spec[MAX_SPEC_LEN];
+    size_t spec_len = 0u;
+    int long_count = 0;
+    spec[spec_len++] = *format++;
+    while (*format != '\0' && strchr("-+ #0123456789.*", *format) != NULL
+           && spec_len + 12u < sizeof(spec)) {
+      if (*format == '*') {
+        spec_len += (size_t)snprintf(&spec[spec_len], sizeof(spec) - spec_len,
+                                     "%d", (int32_t)get_u32(args));
+      } else {
+        spec[spec_len++] = *format;
+      }
+      format++;
+    }
+    while (*format != '\0' && strchr("hlzjtL", *format) != NULL) {
+      long_count += (*format == 'l') ? 1 : 0;
+      format++;
+    }
+    char conversion = *format;
+    if (conversion == '\0') {
+      break;
+    }
+    format++;
+
+    char out[MAX_TEXT_LEN];
+    out[0] = '\0';
+    spec[spec_len] = '\0';
+    switch (conversion) {
+      case 'd':
+      case 'i':
+        if (long_count >= 2) {
+          strcat(spec, "lld");
+          snprintf(out, sizeof(out), spec, (long long)get_u64(args));
+        } else {
+          strcat(spec, "d");
+          snprintf(out, sizeof(out), spec, (int32_t)get_u32(args));
+        }
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+        if (long_count >= 2) {
+          spec[spec_len] = 'l';
+          spec[spec_len + 1u] = 'l';
+          spec[spec_len + 2u] = conversion;
+          spec[spec_len + 3u] = '\0';
+          snprintf(out, sizeof(out), spec, (unsigned long long)get_u64(args));
+        } else {
+          spec[spec_len] = conversion;
+          spec[spec_len + 1u] = '\0';
+          snprintf(out, sizeof(out), spec, get_u32(args));
+        }
+        break;
+      case 'c':
+        strcat(spec, "c");
+        snprintf(out, sizeof(out), spec, (int)get_u32(args));
+        break;
+      case 'p':
+        snprintf(out, sizeof(out), "0x%08x", get_u32(args));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G': {
+        uint32_t bits = get_u32(args);
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        spec[spec_len] = conversion;
+        spec[spec_len + 1u] = '\0';
+        snprintf(out, sizeof(out), spec, (double)value);
+        break;
+      }
+      case 's': {
+        const char *value = "";
+        if (args->pos < args->len
+            && memchr(&args->data[args->pos], '\0', args->len - args->pos) != NULL) {
+          value = (const char *)&args->data[args->pos];
+          args->pos += strlen(value) + 1u;
+        } else {
+          args->overrun = true;
+        }
+        strcat(spec, "s");
+        snprintf(out, sizeof(out), spec, value);
+        break;
+      }
+      case '%':
+        out[0] = '%';
+        out[1] = '\0';
+        break;
+      default:
+        snprintf(out, sizeof(out), "%s%c", spec, conversion);
+        break;
+    }
+    for (size_t i = 0u; out[i] != '\0' && len + 1u < text_size; i++) {
+      text[len++] = out[i];
+    }
+  }
+  text[len] = '\0';
+}
+
+static uint32_t get_u32(args_t *args)
+{
+  uint32_t value = 0u;
+  if (args->pos + 4u > args->len) {
+    args->overrun = true;
+    return 0u;
+  }
+  for (size_t i = 0u; i < 4u; i++) {
+    value |= (uint32_t)args->data[args->pos++] << (8u * i);
+  }
+  return value;
+}
+
+static uint64_t get_u64(args_t *args)
+{
+  uint64_t value = 0u;
+  if (args->pos + 8u > args->len) {
+    args->overrun = true;
+    return 0u;
+  }
+  for (size_t i = 0u; i < 8u; i++) {
+    value |= (uint64_t)args->data[args->pos++] << (8u * i);
+  }
+  return value;
+}
+
+/******************************************************************************
+ * CRC-16/CCITT-FALSE
+ *****************************************************************************/
+static uint16_t crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = CRC16_INIT;
+  for (size_t i = 0u; i < len; i++) {
+    crc ^= (uint16_t)((uint16_t)data[i] << 8);
+    for (uint8_t bit = 0u; bit < 8u; bit++) {
+      crc = (crc & 0x8000u) ? (uint16_t)((crc << 1) ^ CRC16_POLY) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static size_t cobs_decode(const uint8_t *data, size_t len, uint8_t *out, size_t out_size)
+{
+  size_t in_pos = 0u;
+  size_t out_len = 0u;
+
+  while (in_pos < len) {
+    uint8_t code = data[in_pos++];
+    if (code == FRAME_DELIMITER || (in_pos + code - 1u) > len) {
+      return 0u;
+    }
+    for (uint8_t i = 1u; i < code; i++) {
+      if (out_len >= out_size) {
+        return 0u;
+      }
+      out[out_len++] = data[in_pos++];
+    }
+    if (code < 0xFFu && in_pos < len) {
+      if (out_len >= out_size) {
+        return 0u;
+      }
+      out[out_len++] = FRAME_DELIMITER;
+    }
+  }
+  return out_len;
+}
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [options] <application.elf|.out> [capture]\n"
+          "Decode the tokenized log messages of a capture, or of stdin if no\n"
+          "capture is given. The ELF file must be the one that runs on the device.\n"
+          "  -l, --level  prefix every message with its level\n"
+          "  -r, --raw    drop the text between the frames\n"
+          "  -h, --help   show this help\n",
+          name);
+}
@@ -0,0 +1,408 @@
+/***************************************************************************//**
+ * @file
+ * @brief Decoder and throughput benchmark of the binary output frames.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Host tool, build with:
+//   gcc -O2 -Wall -Wextra -I../../bt_cs_soc_initiator -o output_frame_decode
+//       output_frame_decode.c ../../bt_cs_soc_initiator/output_frame.c
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "output_frame.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define MAX_LINE_LEN                  128u
+#define MAX_NOISE_LEN                 32u
+#define UART_BITS_PER_BYTE            10u   // Start, 8 data and stop bit
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Splits the stream at the delimiters
+typedef struct {
+  uint8_t frame[OUTPUT_FRAME_MAX_LEN];
+  size_t len;
+  bool overlong;
+} splitter_t;
+
+// Frame counts of a stream
+typedef struct {
+  uint64_t measurements;
+  uint64_t tags;
+  uint64_t zones;
+  uint64_t invalid;
+} decode_stats_t;
+
+// -----------------------------------------------------------------------------
+// Static variables
+
+static uint32_t random_state = 1u;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static bool split(splitter_t *splitter, uint8_t byte, size_t *frame_len);
+static bool decode(const splitter_t *splitter,
+                   size_t frame_len,
+                   decode_stats_t *stats,
+                   bool print,
+                   output_frame_measurement_t *measurement);
+static uint32_t get_random(void);
+static void get_measurement(uint32_t n, output_frame_measurement_t *measurement);
+static bool is_same(const output_frame_measurement_t *a, const output_frame_measurement_t *b);
+static size_t get_text_measurement_len(const output_frame_measurement_t *measurement);
+static double get_time_ns(void);
+static int run_decode(const char *path);
+static int run_bench(uint32_t result_count, uint32_t baud);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Add a byte of the stream. Returns true with the length of the frame when a
+ * delimiter ends a chunk. The empty chunk between the trailing delimiter of
+ * one frame and the leading delimiter of the next one is skipped.
+ *****************************************************************************/
+static bool split(splitter_t *splitter, uint8_t byte, size_t *frame_len)
+{
+  if (byte != OUTPUT_FRAME_DELIMITER) {
+    if (splitter->len < sizeof(splitter->frame)) {
+      splitter->frame[splitter->len++] = byte;
+    } else {
+      splitter->overlong = true;
+    }
+    return false;
+  }
+  bool complete = (splitter->len > 0u) || splitter->overlong;
+  // An overlong chunk is reported with a length the decoder rejects
+  *frame_len = splitter->overlong ? 0u : splitter->len;
+  splitter->len = 0u;
+  splitter->overlong = false;
+  return complete;
+}
+
+/******************************************************************************
+ * Decode a chunk, count it and optionally print it
+ *****************************************************************************/
+static bool decode(const splitter_t *splitter,
+                   size_t frame_len,
+                   decode_stats_t *stats,
+                   bool print,
+                   output_frame_measurement_t *measurement)
+{
+  uint8_t type;
+  output_frame_tag_t tag;
+  output_frame_zone_t zone;
+
+  if (frame_len == 0u
+      || !output_frame_decode(splitter->frame, frame_len, &type, measurement, &tag, &zone)) {
+    stats->invalid++;
+    if (print) {
+      printf("invalid frame\n");
+    }
+    return false;
+  }
+  switch (type) {
+    case OUTPUT_FRAME_TYPE_MEASUREMENT:
+      stats->measurements++;
+      if (print) {
+        printf("measurement tag %u counter %u time %lu ms distance %ld mm likeliness %.4f rssi distance %ld mm\n",
+               measurement->tag_index,
+               measurement->ranging_counter,
+               (unsigned long)measurement->timestamp_ms,
+               (long)measurement->distance_mm,
+               measurement->likeliness / 10000.0,
+               (long)measurement->rssi_distance_mm);
+      }
+      return true;
+    case OUTPUT_FRAME_TYPE_TAG:
+      stats->tags++;
+      if (print) {
+        printf("tag %u address %02X:%02X:%02X:%02X:%02X:%02X\n",
+               tag.tag_index,
+               tag.address[5], tag.address[4], tag.address[3],
+               tag.address[2], tag.address[1], tag.address[0]);
+      }
+      return false;
+    case OUTPUT_FRAME_TYPE_ZONE:
+      stats->zones++;
+      if (print) {
+        printf("zone tag %u time %lu ms zone %u previous zone %u distance %ld mm\n",
+               zone.tag_index,
+               (unsigned long)zone.timestamp_ms,
+               zone.zone,
+               zone.previous_zone,
+               (long)zone.distance_mm);
+      }
+      return false;
+    default:
+      // Valid CRC, but a type this tool does not know
+      stats->invalid++;
+      if (print) {
+        printf("unknown frame type 0x%02X\n", type);
+      }
+      return false;
+  }
+}
+
+/******************************************************************************
+ * xorshift32, the same sequence on every run
+ *****************************************************************************/
+static uint32_t get_random(void)
+{
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+/******************************************************************************
+ * Measurement of a tag at up to 30 m, like the initiator outputs it
+ *****************************************************************************/
+static void get_measurement(uint32_t n, output_frame_measurement_t *measurement)
+{
+  measurement->tag_index = (uint8_t)(n % 4u);
+  measurement->ranging_counter = (uint16_t)(n / 4u);
+  measurement->timestamp_ms = n * 375u;
+  measurement->distance_mm = (int32_t)(get_random() % 30000u);
+  measurement->likeliness = (uint16_t)(get_random() % 10001u);
+  measurement->rssi_distance_mm = (int32_t)(get_random() % 30000u);
+}
+
+/******************************************************************************
+ * Compare the members, the structs have padding
+ *****************************************************************************/
+static bool is_same(const output_frame_measurement_t *a, const output_frame_measurement_t *b)
+{
+  return a->tag_index == b->tag_index
+         && a->ranging_counter == b->ranging_counter
+         && a->timestamp_ms == b->timestamp_ms
+         && a->distance_mm == b->distance_mm
+         && a->likeliness == b->likeliness
+         && a->rssi_distance_mm == b->rssi_distance_mm;
+}
+
+/******************************************************************************
+ * Length of the JSON line the initiator writes for a measurement
+ *****************************************************************************/
+static size_t get_text_measurement_len(const output_frame_measurement_t *measurement)
+{
+  char line[MAX_LINE_LEN];
+  return (size_t)snprintf(line, sizeof(line),
+                          "{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"distance\": %ld}\r\n",
+                          0u, 0u, 0u, 0u, 0u, measurement->tag_index,
+                          (long)measurement->distance_mm);
+}
+
+static double get_time_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/******************************************************************************
+ * Print every frame of a capture
+ *****************************************************************************/
+static int run_decode(const char *path)
+{
+  splitter_t splitter = { 0 };
+  decode_stats_t stats = { 0 };
+  output_frame_measurement_t measurement;
+  size_t frame_len;
+  int c;
+
+  FILE *capture = (strcmp(path, "-") == 0) ? stdin : fopen(path, "rb");
+  if (capture == NULL) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  while ((c = fgetc(capture)) != EOF) {
+    if (split(&splitter, (uint8_t)c, &frame_len)) {
+      (void)decode(&splitter, frame_len, &stats, true, &measurement);
+    }
+  }
+  if (capture != stdin) {
+    fclose(capture);
+  }
+  fprintf(stderr, "%llu measurement, %llu tag, %llu zone and %llu invalid frames\n",
+          (unsigned long long)stats.measurements,
+          (unsigned long long)stats.tags,
+          (unsigned long long)stats.zones,
+          (unsigned long long)stats.invalid);
+  return EXIT_SUCCESS;
+}
+
+/******************************************************************************
+ * Encode and decode a stream of measurements, check that frames are found
+ * again after noise and compare the UART throughput of both formats.
+ *****************************************************************************/
+static int run_bench(uint32_t result_count, uint32_t baud)
+{
+  uint8_t *stream = malloc((size_t)result_count * OUTPUT_FRAME_MAX_LEN);
+  splitter_t splitter = { 0 };
+  decode_stats_t stats = { 0 };
+  output_frame_measurement_t measurement;
+  size_t stream_len = 0u;
+  size_t text_len = 0u;
+  size_t frame_len;
+  bool failed = false;
+
+  if (stream == NULL) {
+    fprintf(stderr, "Out of memory\n");
+    return EXIT_FAILURE;
+  }
+
+  double start_ns = get_time_ns();
+  for (uint32_t n = 0u; n < result_count; n++) {
+    get_measurement(n, &measurement);
+    stream_len += output_frame_encode_measurement(&measurement, &stream[stream_len]);
+  }
+  double encode_ns = (get_time_ns() - start_ns) / result_count;
+
+  uint32_t matched = 0u;
+  start_ns = get_time_ns();
+  for (size_t i = 0u; i < stream_len; i++) {
+    if (split(&splitter, stream[i], &frame_len)) {
+      (void)decode(&splitter, frame_len, &stats, false, &measurement);
+    }
+  }
+  double decode_ns = (get_time_ns() - start_ns) / result_count;
+
+  // Same sequence again to compare the decoded values
+  random_state = 1u;
+  stats = (decode_stats_t){ 0 };
+  for (size_t i = 0u; i < stream_len; i++) {
+    output_frame_measurement_t decoded;
+    if (split(&splitter, stream[i], &frame_len)
+        && decode(&splitter, frame_len, &stats, false, &decoded)) {
+      get_measurement((uint32_t)stats.measurements - 1u, &measurement);
+      text_len += get_text_measurement_len(&measurement);
+      matched += is_same(&decoded, &measurement) ? 1u : 0u;
+    }
+  }
+  if (matched != result_count || stats.invalid != 0u) {
+    printf("Round trip: %u of %u measurements decoded unchanged, %llu invalid frames\n",
+           matched, result_count, (unsigned long long)stats.invalid);
+    failed = true;
+  }
+
+  // Noise before a frame, e.g. a partial frame or log text when the receiver
+  // is attached. The leading delimiter ends the noise, so the frame is found.
+  uint32_t recovered = 0u;
+  for (size_t noise_len = 1u; noise_len <= MAX_NOISE_LEN; noise_len++) {
+    splitter = (splitter_t){ 0 };
+    stats = (decode_stats_t){ 0 };
+    for (size_t i = 0u; i < noise_len; i++) {
+      (void)split(&splitter, (uint8_t)(1u + get_random() % 255u), &frame_len);
+    }
+    for (size_t i = 0u; i < stream_len && stats.measurements == 0u; i++) {
+      if (split(&splitter, stream[i], &frame_len)) {
+        (void)decode(&splitter, frame_len, &stats, false, &measurement);
+      }
+    }
+    random_state = 1u;
+    output_frame_measurement_t first;
+    get_measurement(0u, &first);
+    recovered += is_same(&first, &measurement) ? 1u : 0u;
+  }
+  failed |= (recovered != MAX_NOISE_LEN);
+
+  double bytes_per_s = (double)baud / UART_BITS_PER_BYTE;
+  double binary_len = (double)stream_len / result_count;
+  double text_line_len = (double)text_len / result_count;
+  printf("%u measurements, encode %.1f ns, split and decode %.1f ns per frame\n",
+         result_count, encode_ns, decode_ns);
+  printf("First frame found after 1..%u noise bytes: %u of %u\n\n",
+         MAX_NOISE_LEN, recovered, MAX_NOISE_LEN);
+  printf("Format   Bytes/result  Results/s at %lu baud\n", (unsigned long)baud);
+  printf("Binary   %12.1f  %8.0f\n", binary_len, bytes_per_s / binary_len);
+  printf("Text     %12.1f  %8.0f\n", text_line_len, bytes_per_s / text_line_len);
+  free(stream);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options] capture|-\n"
+         "       %s --bench N [--baud B]\n"
+         "  --bench N                encode and decode N measurements instead (e.g. 1000000)\n"
+         "  --baud B                 UART baud rate of the throughput figures (default 115200)\n",
+         name, name);
+}
+
+// -----------------------------------------------------------------------------
+// Decoder
+
+int main(int argc, char **argv)
+{
+  uint32_t result_count = 0u;
+  uint32_t baud = 115200u;
+  static const struct option options[] = {
+    { "bench", required_argument, NULL, 'n' },
+    { "baud", required_argument, NULL, 'b' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        result_count = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+        baud = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (result_count != 0u && baud != 0u && optind == argc) {
+    return run_bench(result_count, baud);
+  }
+  if (result_count != 0u || optind != argc - 1) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  return run_decode(argv[optind]);
+}
@@ -0,0 +1,332 @@
+/***************************************************************************//**
+ * @file
+ * @brief Replay of a recorded session through the event driven output policy.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// Host tool, build with:
+//   gcc -O2 -Wall -I../../bt_cs_soc_initiator -o output_replay output_replay.c
+//       ../../bt_cs_soc_initiator/output_frame.c ../../bt_cs_soc_initiator/output_policy.c
+// Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "output_frame.h"
+#include "output_policy.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define MAX_TAGS                      256u
+#define MAX_LINE_LEN                  128u
+
+// Defaults of bt_cs_soc_initiator/config/app_config.h
+#define DEFAULT_DEADBAND_MM           50u
+#define DEFAULT_HEARTBEAT_MS          5000u
+#define DEFAULT_HYSTERESIS_MM         200u
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Output volume of one format
+typedef struct {
+  uint64_t frames;
+  uint64_t bytes;
+} replay_volume_t;
+
+typedef struct {
+  bool active;
+  uint8_t address[6];
+  output_policy_t policy;
+  uint64_t results;
+  uint64_t distances;
+  uint64_t zone_changes;
+} replay_tag_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static bool parse_zones(const char *list, output_policy_config_t *config);
+static size_t get_text_measurement_len(const replay_tag_t *tag, int32_t distance_mm);
+static size_t get_text_zone_len(const replay_tag_t *tag, uint8_t zone, uint8_t previous_zone);
+static void add(replay_volume_t *volume, size_t bytes);
+static void print_volume(const char *format, const replay_volume_t *all, const replay_volume_t *policy);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Parse a comma separated list of zone boundaries in mm
+ *****************************************************************************/
+static bool parse_zones(const char *list, output_policy_config_t *config)
+{
+  char *end;
+
+  config->zone_count = 0u;
+  while (*list != '\0') {
+    if (config->zone_count == OUTPUT_POLICY_MAX_ZONES) {
+      return false;
+    }
+    config->zone_mm[config->zone_count++] = (uint32_t)strtoul(list, &end, 0);
+    if (end == list || (*end != ',' && *end != '\0')) {
+      return false;
+    }
+    list = (*end == ',') ? end + 1 : end;
+  }
+  return output_policy_check_config(config);
+}
+
+/******************************************************************************
+ * Length of the JSON lines written by the initiator in the text format
+ *****************************************************************************/
+static size_t get_text_measurement_len(const replay_tag_t *tag, int32_t distance_mm)
+{
+  char line[MAX_LINE_LEN];
+  return (size_t)snprintf(line, sizeof(line),
+                          "{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"distance\": %ld}\r\n",
+                          tag->address[5], tag->address[4], tag->address[3],
+                          tag->address[2], tag->address[1], tag->address[0],
+                          (long)distance_mm);
+}
+
+static size_t get_text_zone_len(const replay_tag_t *tag, uint8_t zone, uint8_t previous_zone)
+{
+  char line[MAX_LINE_LEN];
+  return (size_t)snprintf(line, sizeof(line),
+                          "{\"id\": \"%02X:%02X:%02X:%02X:%02X:%02X\", \"zone\": %u, \"previous_zone\": %u}\r\n",
+                          tag->address[5], tag->address[4], tag->address[3],
+                          tag->address[2], tag->address[1], tag->address[0],
+                          zone,
+                          previous_zone);
+}
+
+static void add(replay_volume_t *volume, size_t bytes)
+{
+  volume->frames++;
+  volume->bytes += bytes;
+}
+
+static void print_volume(const char *format, const replay_volume_t *all, const replay_volume_t *policy)
+{
+  double reduction = (all->bytes != 0u)
+                     ? 100.0 * (1.0 - (double)policy->bytes / (double)all->bytes) : 0.0;
+  printf("%-8s %10llu %12llu %10llu %12llu %9.1f %%\n",
+         format,
+         (unsigned long long)all->frames,
+         (unsigned long long)all->bytes,
+         (unsigned long long)policy->frames,
+         (unsigned long long)policy->bytes,
+         reduction);
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options] capture.bin\n"
+         "  capture.bin              binary output of the initiator (CS_INITIATOR_OUTPUT_FORMAT_BINARY)\n"
+         "                           recorded with the event driven output disabled\n"
+         "  --deadband MM            smallest distance change output, 0 for all (default %u)\n"
+         "  --heartbeat MS           output at least this often, 0 to disable (default %u)\n"
+         "  --hysteresis MM          distance past a zone boundary to change zone (default %u)\n"
+         "  --zones MM,MM,...        zone boundaries, ascending, up to %u (default none)\n",
+         name,
+         DEFAULT_DEADBAND_MM,
+         DEFAULT_HEARTBEAT_MS,
+         DEFAULT_HYSTERESIS_MM,
+         OUTPUT_POLICY_MAX_ZONES);
+}
+
+// -----------------------------------------------------------------------------
+// Replay
+
+int main(int argc, char **argv)
+{
+  output_policy_config_t config = {
+    .deadband_mm = DEFAULT_DEADBAND_MM,
+    .heartbeat_ms = DEFAULT_HEARTBEAT_MS,
+    .hysteresis_mm = DEFAULT_HYSTERESIS_MM,
+    .zone_count = 0u
+  };
+  static const struct option options[] = {
+    { "deadband", required_argument, NULL, 'd' },
+    { "heartbeat", required_argument, NULL, 'b' },
+    { "hysteresis", required_argument, NULL, 'y' },
+    { "zones", required_argument, NULL, 'z' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  static replay_tag_t tags[MAX_TAGS];
+  replay_volume_t binary_all = { 0 };
+  replay_volume_t binary_policy = { 0 };
+  replay_volume_t text_all = { 0 };
+  replay_volume_t text_policy = { 0 };
+  uint64_t invalid_frames = 0u;
+  uint8_t frame[OUTPUT_FRAME_MAX_LEN];
+  size_t frame_len = 0u;
+  bool overlong = false;
+  int opt;
+  int c;
+
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'd':
+        config.deadband_mm = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+        config.heartbeat_ms = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'y':
+        config.hysteresis_mm = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'z':
+        if (!parse_zones(optarg, &config)) {
+          fprintf(stderr, "Invalid zone list: %s\n", optarg);
+          return EXIT_FAILURE;
+        }
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (optind != argc - 1) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+  FILE *capture = fopen(argv[optind], "rb");
+  if (capture == NULL) {
+    perror(argv[optind]);
+    return EXIT_FAILURE;
+  }
+
+  // Split the stream at the delimiters and feed every measurement to the
+  // policy of its tag, as apply_output_policy() of the initiator does.
+  while ((c = fgetc(capture)) != EOF) {
+    if (c != OUTPUT_FRAME_DELIMITER) {
+      if (frame_len < sizeof(frame)) {
+        frame[frame_len++] = (uint8_t)c;
+      } else {
+        overlong = true;
+      }
+      continue;
+    }
+    // Frames start and end with a delimiter, so there is nothing between the
+    // end of one frame and the start of the next.
+    if (frame_len == 0u && !overlong) {
+      continue;
+    }
+    uint8_t type;
+    output_frame_measurement_t measurement;
+    output_frame_tag_t tag_frame;
+    output_frame_zone_t zone_frame;
+    bool valid = !overlong
+                 && output_frame_decode(frame, frame_len, &type, &measurement, &tag_frame, &zone_frame);
+    size_t wire_len = frame_len + 2u;
+    frame_len = 0u;
+    overlong = false;
+    if (!valid) {
+      invalid_frames++;
+      continue;
+    }
+    if (type == OUTPUT_FRAME_TYPE_TAG) {
+      replay_tag_t *tag = &tags[tag_frame.tag_index];
+      memcpy(tag->address, tag_frame.address, sizeof(tag->address));
+      tag->active = false;
+      continue;
+    }
+    if (type != OUTPUT_FRAME_TYPE_MEASUREMENT) {
+      continue;
+    }
+
+    replay_tag_t *tag = &tags[measurement.tag_index];
+    if (!tag->active) {
+      // New connection on this tag index
+      output_policy_init(&tag->policy, &config);
+      tag->active = true;
+    }
+    tag->results++;
+    add(&binary_all, wire_len);
+    add(&text_all, get_text_measurement_len(tag, measurement.distance_mm));
+
+    uint8_t previous_zone = OUTPUT_POLICY_ZONE_UNKNOWN;
+    uint8_t events = output_policy_update(&tag->policy,
+                                          measurement.distance_mm,
+                                          measurement.timestamp_ms,
+                                          &previous_zone);
+    if (events & OUTPUT_POLICY_EVENT_ZONE) {
+      output_frame_zone_t zone = {
+        .tag_index = measurement.tag_index,
+        .timestamp_ms = measurement.timestamp_ms,
+        .zone = tag->policy.zone,
+        .previous_zone = previous_zone,
+        .distance_mm = measurement.distance_mm
+      };
+      uint8_t encoded[OUTPUT_FRAME_MAX_LEN];
+      add(&binary_policy, output_frame_encode_zone(&zone, encoded));
+      add(&text_policy, get_text_zone_len(tag, tag->policy.zone, previous_zone));
+      tag->zone_changes++;
+    }
+    if (events & OUTPUT_POLICY_EVENT_DISTANCE) {
+      add(&binary_policy, wire_len);
+      add(&text_policy, get_text_measurement_len(tag, measurement.distance_mm));
+      tag->distances++;
+    }
+  }
+  fclose(capture);
+
+  printf("Deadband %lu mm, heartbeat %lu ms, %u zone boundaries, hysteresis %lu mm\n\n",
+         (unsigned long)config.deadband_mm,
+         (unsigned long)config.heartbeat_ms,
+         config.zone_count,
+         (unsigned long)config.hysteresis_mm);
+  printf("Tag   Results  Distances  Zone changes\n");
+  for (uint32_t i = 0u; i < MAX_TAGS; i++) {
+    if (tags[i].results != 0u) {
+      printf("%3u %9llu %10llu %13llu\n",
+             i,
+             (unsigned long long)tags[i].results,
+             (unsigned long long)tags[i].distances,
+             (unsigned long long)tags[i].zone_changes);
+    }
+  }
+  printf("\nFormat       Every result             With policy       Reduction\n"
+         "             frames        bytes     frames        bytes\n");
+  print_volume("binary", &binary_all, &binary_policy);
+  print_volume("text", &text_all, &text_policy);
+  if (invalid_frames != 0u) {
+    printf("\n%llu invalid frame(s) skipped\n", (unsigned long long)invalid_frames);
+  }
+  return EXIT_SUCCESS;
+}
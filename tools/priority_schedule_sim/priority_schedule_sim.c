@@ -0,0 +1,344 @@
+/***************************************************************************//**
+ * @file
+ * @brief Discrete event simulation of the priority weighted procedure scheduling.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2025 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+
+// Host tool, build with:
+//   gcc -O2 -Wall -I../../bt_cs_soc_initiator -I../../bt_cs_soc_initiator/config
+//       -o priority_schedule_sim priority_schedule_sim.c
+//       ../../bt_cs_soc_initiator/priority_schedule.c -lm
+// The scheduler settings are those of app_config.h and can be changed with -D,
+// e.g. -DCS_INITIATOR_PRIORITY_AIRTIME_PERCENT=80. Run with --help for the options.
+
+// -----------------------------------------------------------------------------
+// Includes
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "priority_schedule.h"
+
+// -----------------------------------------------------------------------------
+// Macros
+
+#define CONNECTION_INTERVAL_UNIT_MS   1.25
+#define MAX_TAGS                      PRIORITY_SCHEDULE_MAX_TAGS
+#define DEFAULT_PRIORITIES            "4,2,1,1,1,1,1,1"
+
+// -----------------------------------------------------------------------------
+// Enums, structs, typedefs
+
+// Radio settings
+typedef struct {
+  uint16_t connection_interval;
+  uint16_t base_interval;
+  double procedure_ms;
+  double drift_ppm;
+  double duration_ms;
+  uint8_t priorities[MAX_TAGS];
+  uint32_t priority_count;
+} setup_t;
+
+// A link of the initiator
+typedef struct {
+  uint8_t priority;
+  uint16_t interval;
+  double event_ms;        // Connection interval with the clock drift of the tag
+  double due_ms;          // Connection event of the next procedure
+  uint32_t procedures;
+  uint32_t deferred;      // Procedures moved to a later connection event
+  uint32_t collisions;    // Procedures that found the radio busy
+} link_t;
+
+// Outcome of one run
+typedef struct {
+  uint32_t procedures;
+  uint32_t collisions;
+  uint32_t deferred;
+  uint32_t min_procedures; // Of the tag served the least
+  double busy_ms;
+} run_result_t;
+
+// -----------------------------------------------------------------------------
+// Static function declarations
+
+static bool parse_priorities(const char *list, setup_t *setup);
+static void simulate(const setup_t *setup, link_t *links, uint32_t count, run_result_t *result);
+static void run(const setup_t *setup, uint32_t count, bool scheduled, bool verbose,
+                run_result_t *result);
+static void usage(const char *name);
+
+// -----------------------------------------------------------------------------
+// Static function definitions
+
+/******************************************************************************
+ * Parse a comma separated priority list. The tags take the priorities in
+ * turn, the list is repeated if there are more tags.
+ *****************************************************************************/
+static bool parse_priorities(const char *list, setup_t *setup)
+{
+  char *end;
+  setup->priority_count = 0u;
+  while (*list != '\0' && setup->priority_count < MAX_TAGS) {
+    unsigned long priority = strtoul(list, &end, 0);
+    if (end == list || priority > UINT8_MAX) {
+      return false;
+    }
+    setup->priorities[setup->priority_count++] = (uint8_t)priority;
+    list = (*end == ',') ? end + 1 : end;
+  }
+  return setup->priority_count > 0u;
+}
+
+/******************************************************************************
+ * Run the procedures of all links on one radio. The controller spreads the
+ * anchors evenly over the connection interval, and every link drifts with
+ * the clock of its tag. A procedure that is due while the radio serves
+ * another procedure is deferred to the next connection event of its link,
+ * and its next procedure is due one procedure interval after it started.
+ *****************************************************************************/
+static void simulate(const setup_t *setup, link_t *links, uint32_t count, run_result_t *result)
+{
+  double busy_until_ms = 0.0;
+
+  for (;;) {
+    link_t *link = NULL;
+    for (uint32_t i = 0u; i < count; i++) {
+      if (link == NULL || links[i].due_ms < link->due_ms) {
+        link = &links[i];
+      }
+    }
+    if (link->due_ms >= setup->duration_ms) {
+      break;
+    }
+    if (link->due_ms < busy_until_ms) {
+      link->collisions++;
+      while (link->due_ms < busy_until_ms) {
+        link->due_ms += link->event_ms;
+        link->deferred++;
+      }
+      continue;
+    }
+    busy_until_ms = link->due_ms + setup->procedure_ms;
+    result->busy_ms += setup->procedure_ms;
+    link->procedures++;
+    link->due_ms += link->interval * link->event_ms;
+  }
+  result->min_procedures = UINT32_MAX;
+  for (uint32_t i = 0u; i < count; i++) {
+    if (links[i].procedures < result->min_procedures) {
+      result->min_procedures = links[i].procedures;
+    }
+    result->procedures += links[i].procedures;
+    result->collisions += links[i].collisions;
+    result->deferred += links[i].deferred;
+  }
+}
+
+/******************************************************************************
+ * Simulate a number of tags, with the intervals of the scheduler or with the
+ * base interval for every tag.
+ *****************************************************************************/
+static void run(const setup_t *setup, uint32_t count, bool scheduled, bool verbose,
+                run_result_t *result)
+{
+  priority_schedule_tag_t tags[MAX_TAGS];
+  uint16_t intervals[MAX_TAGS];
+  link_t links[MAX_TAGS];
+  double event_ms = setup->connection_interval * CONNECTION_INTERVAL_UNIT_MS;
+
+  for (uint32_t i = 0u; i < count; i++) {
+    tags[i].priority = setup->priorities[i % setup->priority_count];
+    tags[i].connection_interval = setup->connection_interval;
+    tags[i].base_interval = setup->base_interval;
+    intervals[i] = setup->base_interval;
+  }
+  if (scheduled) {
+    priority_schedule_compute(tags, (uint8_t)count, intervals);
+  }
+  memset(links, 0, sizeof(links));
+  for (uint32_t i = 0u; i < count; i++) {
+    double drift = setup->drift_ppm * (2.0 * rand() / RAND_MAX - 1.0);
+    links[i].priority = tags[i].priority;
+    links[i].interval = intervals[i];
+    links[i].event_ms = event_ms * (1.0 + drift / 1e6);
+    // Even anchor selection
+    links[i].due_ms = event_ms * i / count;
+  }
+  memset(result, 0, sizeof(*result));
+  simulate(setup, links, count, result);
+
+  if (!verbose) {
+    return;
+  }
+  printf("tag  priority  interval  airtime [permille]  target [Hz]  rate [Hz]  collisions  deferred\n");
+  for (uint32_t i = 0u; i < count; i++) {
+    printf("%-4u %8u %9u %19lu %12.3f %10.3f %11u %9u\n",
+           i,
+           links[i].priority,
+           links[i].interval,
+           (unsigned long)priority_schedule_get_airtime_permille(setup->connection_interval,
+                                                                 links[i].interval),
+           1000.0 / (links[i].interval * event_ms),
+           1000.0 * links[i].procedures / setup->duration_ms,
+           links[i].collisions,
+           links[i].deferred);
+  }
+}
+
+static void usage(const char *name)
+{
+  printf("Usage: %s [options]\n"
+         "  --min-tags N             smallest number of tags (default 4)\n"
+         "  --max-tags N             largest number of tags (default 8)\n"
+         "  --priorities LIST        comma separated priorities, repeated for more tags (default %s)\n"
+         "  --connection-interval N  connection interval of every tag in 1.25 ms units (default 15)\n"
+         "  --base-interval N        shortest procedure interval in connection events (default 2)\n"
+         "  --procedure-ms MS        airtime of one procedure (default %u)\n"
+         "  --drift-ppm PPM          peak clock drift of a tag (default 50)\n"
+         "  --duration S             simulated time (default 600)\n"
+         "  --seed N                 random seed of the drifts (default 1)\n",
+         name,
+         DEFAULT_PRIORITIES,
+         CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS);
+}
+
+// -----------------------------------------------------------------------------
+// Simulation
+
+int main(int argc, char **argv)
+{
+  setup_t setup = {
+    .connection_interval = 15u,
+    .base_interval = 2u,
+    .procedure_ms = CS_INITIATOR_PRIORITY_PROCEDURE_TIME_MS,
+    .drift_ppm = 50.0,
+    .duration_ms = 600000.0
+  };
+  uint32_t min_tags = 4u;
+  uint32_t max_tags = 8u;
+  unsigned int seed = 1u;
+  static const struct option options[] = {
+    { "min-tags", required_argument, NULL, 'n' },
+    { "max-tags", required_argument, NULL, 'x' },
+    { "priorities", required_argument, NULL, 'p' },
+    { "connection-interval", required_argument, NULL, 'i' },
+    { "base-interval", required_argument, NULL, 'b' },
+    { "procedure-ms", required_argument, NULL, 'a' },
+    { "drift-ppm", required_argument, NULL, 'd' },
+    { "duration", required_argument, NULL, 't' },
+    { "seed", required_argument, NULL, 'S' },
+    { "help", no_argument, NULL, 'h' },
+    { NULL, 0, NULL, 0 }
+  };
+  int opt;
+
+  (void)parse_priorities(DEFAULT_PRIORITIES, &setup);
+  while ((opt = getopt_long(argc, argv, "h", options, NULL)) != -1) {
+    switch (opt) {
+      case 'n':
+        min_tags = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'x':
+        max_tags = (uint32_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        if (!parse_priorities(optarg, &setup)) {
+          usage(argv[0]);
+          return EXIT_FAILURE;
+        }
+        break;
+      case 'i':
+        setup.connection_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+        setup.base_interval = (uint16_t)strtoul(optarg, NULL, 0);
+        break;
+      case 'a':
+        setup.procedure_ms = strtod(optarg, NULL);
+        break;
+      case 'd':
+        setup.drift_ppm = strtod(optarg, NULL);
+        break;
+      case 't':
+        setup.duration_ms = 1000.0 * strtod(optarg, NULL);
+        break;
+      case 'S':
+        seed = (unsigned int)strtoul(optarg, NULL, 0);
+        break;
+      default:
+        usage(argv[0]);
+        return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+  }
+  if (min_tags == 0u || max_tags < min_tags || max_tags > MAX_TAGS
+      || setup.connection_interval == 0u || setup.base_interval == 0u
+      || setup.procedure_ms <= 0.0 || setup.duration_ms <= 0.0) {
+    usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("Connection interval %.2f ms, base interval %u, procedure %.1f ms, "
+         "budget %u %%, drift %.0f ppm, %.0f s\n",
+         setup.connection_interval * CONNECTION_INTERVAL_UNIT_MS,
+         setup.base_interval,
+         setup.procedure_ms,
+         CS_INITIATOR_PRIORITY_AIRTIME_PERCENT,
+         setup.drift_ppm,
+         setup.duration_ms / 1000.0);
+  for (uint32_t count = min_tags; count <= max_tags; count++) {
+    run_result_t scheduled;
+    run_result_t unscheduled;
+    srand(seed);
+    printf("\n%u tags\n", count);
+    run(&setup, count, true, true, &scheduled);
+    srand(seed);
+    run(&setup, count, false, false, &unscheduled);
+    printf("             procedures  rate [Hz]  lowest [Hz]  collisions  deferred  radio busy [%%]\n");
+    printf("scheduled    %10u %10.3f %12.3f %11u %9u %15.1f\n",
+           scheduled.procedures,
+           1000.0 * scheduled.procedures / setup.duration_ms,
+           1000.0 * scheduled.min_procedures / setup.duration_ms,
+           scheduled.collisions,
+           scheduled.deferred,
+           100.0 * scheduled.busy_ms / setup.duration_ms);
+    printf("base only    %10u %10.3f %12.3f %11u %9u %15.1f\n",
+           unscheduled.procedures,
+           1000.0 * unscheduled.procedures / setup.duration_ms,
+           1000.0 * unscheduled.min_procedures / setup.duration_ms,
+           unscheduled.collisions,
+           unscheduled.deferred,
+           100.0 * unscheduled.busy_ms / setup.duration_ms);
+  }
+  return EXIT_SUCCESS;
+}